@@ -8,7 +8,7 @@
 namespace Calc
 {
 
-static uint16_t CalcParseTable_ActionTable[28][13] =
+static const uint16_t CalcParseTable_ActionTable[28][13] =
 {
     {0x0000, 0x0000, 0x8008, 0x0000, 0x8002, 0x0000, 0x0000, 0x0000, 0x0000, 0x8001, 0x0000, 0x8007, 0x8005},
     {0x0000, 0x0000, 0x8008, 0x0000, 0x8002, 0x0000, 0x0000, 0x0000, 0x0000, 0x8001, 0x0000, 0x800B, 0x0000},
@@ -40,7 +40,7 @@ static uint16_t CalcParseTable_ActionTable[28][13] =
     {0x0000, 0x400F, 0x400F, 0x800E, 0x800F, 0x800D, 0x8010, 0x8011, 0x0000, 0x400F, 0x0000, 0x400F, 0x400F}
 };
 
-static uint16_t CalcParseTable_GotoTable[28][4] =
+static const uint16_t CalcParseTable_GotoTable[28][4] =
 {
     {0x0009, 0x0004, 0x0006, 0x0003},
     {0xFFFF, 0xFFFF, 0x000A, 0xFFFF},
@@ -72,31 +72,31 @@ static uint16_t CalcParseTable_GotoTable[28][4] =
     {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF}
 };
 
-static uint32_t CalcParseTable_ReduceProduction[17][4] =
+static const SGParser::ParseTable::ReduceProduction CalcParseTable_ReduceProduction[17] =
 {
     {1, 0, 0, 0}, {2, 0, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {1, 2, 0, 0}, {1, 2, 0, 0}, {2, 2, 0, 0}, {3, 2, 0, 0},
     {3, 2, 0, 0}, {3, 2, 0, 0}, {3, 2, 0, 0}, {3, 2, 0, 0}, {3, 2, 0, 0}, {3, 3, 0, 0}, {3, 3, 0, 0}
 };
 
-static uint16_t CalcParseTable_Nonterminals[4] =
+static const SGParser::ParseTable::NonTerminal CalcParseTable_Nonterminals[4] =
 {
-    0x0000, 0xFFFF, 0xFFFF, 0xFFFF
+    {0x0000}, {0xFFFFFFFF}, {0xFFFFFFFF}, {0xFFFFFFFF}
 };
 
-static uint8_t CalcParseTable_Terminals[13] =
+static const SGParser::ParseTable::Terminal CalcParseTable_Terminals[13] =
 {
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0
+    {1}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0},
+    {0}, {0}, {0}
 };
 
-static uint8_t CalcParseTable_StateInfos[28][2] =
+static const SGParser::ParseTable::StateInfo CalcParseTable_StateInfos[28] =
 {
-    {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0},
-    {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0},
-    {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}
+    {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000},
+    {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000},
+    {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}
 };
 
-static SGParser::StaticParseTable CalcParseTable =
+static const SGParser::StaticParseTable CalcParseTable =
 {
     SGParser::ParseTableType::LALR,
     28u,
@@ -106,15 +106,21 @@ static SGParser::StaticParseTable CalcParseTable =
     4u,
     CalcParseTable_GotoTable[0u],
     17u,
-    CalcParseTable_ReduceProduction[0u],
+    CalcParseTable_ReduceProduction,
     4u,
     CalcParseTable_Nonterminals,
     13u,
     CalcParseTable_Terminals,
     28u,
-    CalcParseTable_StateInfos[0u],
+    CalcParseTable_StateInfos,
     0u,
-    nullptr
+    nullptr,
+    {0u, nullptr, nullptr, nullptr, nullptr, nullptr},
+    {0u, nullptr, nullptr, nullptr, nullptr, nullptr},
+    nullptr,
+    nullptr,
+    {0u, nullptr, nullptr, nullptr, nullptr, nullptr},
+    {0u, nullptr, nullptr, nullptr, nullptr, nullptr}
 };
 
 } // namespace Calc
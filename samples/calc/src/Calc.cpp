@@ -12,15 +12,20 @@ int main(int argc, char const* argv[]) {
     using namespace Calc;
     try {
         CalcParser parser;
+        bool       parsed;
         if (argc > 1) {
             fstream fileStream{argv[1]};
-            parser.Evaluate(fileStream);
+            parsed = parser.Evaluate(fileStream);
         } else {
-            parser.Evaluate(cin);
+            parsed = parser.Evaluate(cin);
         }
         auto const& numbers = parser.GetEvaluatedNumbers();
         copy(numbers.begin(), numbers.end(), ostream_iterator<CalcParser::Number>(cout, " "));
         cout << endl;
+        if (!parsed) {
+            cerr << parser.GetParseError() << endl;
+            return 1;
+        }
         return 0;
     } catch (exception const& failure) {
         cerr << failure.what() << endl;
@@ -35,6 +35,7 @@ private:
     ParseTable  table;
     NumberSet   numbers;
     VariableMap variables;
+    std::string parseError;
 
 public:
     CalcParser() {
@@ -42,12 +43,14 @@ public:
         table.Create(CalcParseTable);
     }
 
-    void Evaluate(std::string const& text) {
+    // Evaluates the text, returning false if it fails to parse (see GetParseError)
+    // The numbers evaluated before the failure are kept
+    bool Evaluate(std::string const& text) {
         std::stringstream sstream{text};
-        Evaluate(sstream);
+        return Evaluate(sstream);
     }
 
-    void Evaluate(std::istream& stream) {
+    bool Evaluate(std::istream& stream) {
         StdStreamAdapter                input{stream};
         DFATokenizer<GenericToken>      tokenizer{&automata, &input};
         Parse<ParseStackGenericElement> parser;
@@ -56,11 +59,16 @@ public:
             throw std::runtime_error("failed to create parser");
 
         numbers.clear();
+        parseError.clear();
 
-        parser.DoParse(*this);
+        if (parser.DoParse(*this))
+            return true;
+        parseError = parser.IsStackOverflow() ? "Expression nested too deeply" : "Syntax error";
+        return false;
     }
 
-    NumberSet const& GetEvaluatedNumbers() const noexcept { return numbers; }
+    NumberSet const&   GetEvaluatedNumbers() const noexcept { return numbers; }
+    std::string const& GetParseError() const noexcept       { return parseError; }
 
     // Overriden parse handler reduce function
     bool Reduce(Parse<ParseStackGenericElement>& parse, unsigned productionID) override {
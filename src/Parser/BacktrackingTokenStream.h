@@ -8,6 +8,7 @@
 #include "Tokenizer.h"
 
 #include <map>
+#include <utility>
 
 namespace SGParser
 {
@@ -15,6 +16,7 @@ namespace SGParser
 // ***** Backtracking token stream
 
 // Will read tokens from source stream, and allow to backtrack in them based on markers
+// Tokens are read from the source in bulk, straight into the block storage
 template <class Token = TokenCode>
 class BacktrackingTokenStream final : public TokenStream<Token>
 {
@@ -57,7 +59,7 @@ public:
     // Return false if no marker was defined for that index
     bool   ReleaseMarker(size_t markerIndex);
 
-    // Returns number of tokens buffered after the marker
+    // Returns number of tokens reported after the marker
     size_t GetBufferedLength(size_t markerIndex) const;
 
     // Backtracks to a certain marker
@@ -69,7 +71,7 @@ public:
     // Backtracks to absolute position
     bool   SeekTo(size_t index) noexcept;
 
-    // Advances to buffer end and resets stream length
+    // Advances to the furthest reported position and resets stream length
     void   AdvanceToBufferEnd(size_t streamLength = MaxSize) noexcept;
 
     // Sets stream length (of how many characters will be reported from that point on)
@@ -102,7 +104,7 @@ private:
     size_t              ThisPos;
     size_t              RememberLength; // Number of previous tokens to remember
     size_t              LengthLeft;     // Number of tokens left to report
-    size_t              Pos;            // Current position (furthest position in source stream)
+    size_t              Pos;            // Furthest position reported from the buffered tokens
     bool                SourceEOFFlag;  // Flag set, if source is at EOF
 
     // Tracked starting positions (mark which elements we have to remember)
@@ -112,6 +114,9 @@ private:
 
     // Releases extra buffers that are no longer needed
     void ReleaseExtraBuffers() noexcept;
+
+    // Reads the next tokens from the source stream into the rest of the current block
+    void ReadSourceTokens();
 };
 
 
@@ -164,6 +169,7 @@ void BacktrackingTokenStream<Token>::ResetStream(TokenStream<Token>* psourceStre
 
     pThisBlock        = pFirstBlock;
     pThisBlock->Index = 0u;
+    pThisBlock->Count = 0u;
     ThisPos           = 0u;
     // Reset variables
     pSourceStream     = psourceStream;
@@ -194,6 +200,33 @@ void BacktrackingTokenStream<Token>::ReleaseExtraBuffers() noexcept {
         delete std::exchange(pFirstBlock, pFirstBlock->pNext);
 }
 
+// Reads the next tokens from the source stream into the rest of the current block
+template <class Token>
+void BacktrackingTokenStream<Token>::ReadSourceTokens() {
+    SG_ASSERT(ThisPos == pThisBlock->Count && !SourceEOFFlag);
+
+    // A non-zero count always gives at least one token (EOF at the end of the source)
+    const auto count = pSourceStream->GetTokens(pThisBlock->Tokens + ThisPos,
+                                                StreamBlock::BufferSize - ThisPos);
+    SG_ASSERT(count != 0u);
+
+    // A full block is always followed by the next one
+    // Enforce basic exception safety: the tokens are only added to the block once
+    // the next block is allocated, so if that fails BacktrackingTokenStream stays consistent
+    if (ThisPos + count == StreamBlock::BufferSize) {
+        auto pnewBlock    = new StreamBlock;
+        pnewBlock->Index  = pThisBlock->Index + StreamBlock::BufferSize;
+        pThisBlock->pNext = pnewBlock;
+    }
+
+    pThisBlock->Count += count;
+    if (pThisBlock->Tokens[pThisBlock->Count - 1u].Code == TokenCode::TokenEOF)
+        SourceEOFFlag = true;
+
+    // Check for freeing any extra buffers
+    ReleaseExtraBuffers();
+}
+
 // *** Marker & backtracking management
 
 // Releases all markers
@@ -305,14 +338,14 @@ bool BacktrackingTokenStream<Token>::SeekTo(size_t index) noexcept {
     return true;
 }
 
-// Advances to buffer end and resets stream length
+// Advances to the furthest reported position and resets stream length
 template <class Token>
 void BacktrackingTokenStream<Token>::AdvanceToBufferEnd(size_t streamLength) noexcept {
-    // Advance to last block
-    while (pThisBlock->Count == StreamBlock::BufferSize)
+    // Advance to the block containing the position
+    while (pThisBlock->pNext && pThisBlock->pNext->Index <= Pos)
         pThisBlock = pThisBlock->pNext;
     // Set position, and length
-    ThisPos    = pThisBlock->Count;
+    ThisPos    = Pos - pThisBlock->Index;
     LengthLeft = pSourceStream ? streamLength : 0u;
 }
 
@@ -338,45 +371,22 @@ Token& BacktrackingTokenStream<Token>::GetNextToken(Token& token) {
         return token;
     }
 
-    // If we are behind the end (backtracked)
-    // return next consecutive token
-    if (ThisPos < pThisBlock->Count) {
-        token = pThisBlock->Tokens[ThisPos];
-        ++ThisPos;
-        if (ThisPos == StreamBlock::BufferSize) {
-            ThisPos    = 0u;
-            pThisBlock = pThisBlock->pNext;
-        }
-        return token;
+    // Once all buffered tokens are read, refill the block from the source stream
+    if (ThisPos == pThisBlock->Count) {
+        // If source ended earlier, just return EOF value
+        if (SourceEOFFlag)
+            return pSourceStream->GetNextToken(token);
+        ReadSourceTokens();
     }
 
-    // Read next token from original stream
-    pSourceStream->GetNextToken(token);
-    pThisBlock->Tokens[ThisPos] = token;
-
-    // If source ended earlier, just return EOF value
-    if (SourceEOFFlag)
-        return token;
-    if (token.Code == TokenCode::TokenEOF)
-        SourceEOFFlag = true;
-
-    // Increase pointer
-    ++ThisPos;
-    ++pThisBlock->Count;
-    // Final position in stream
-    ++Pos;
-    if (ThisPos == StreamBlock::BufferSize) {
-        // Enforce basic exception safety
-        // If new StreamBlock fails then ThisPos will stay equal
-        // to StreamBlock::BufferSize and next call to GetNextToken
-        // will fail (but BacktrackingTokenStream will stay in safe-to-delete state)
-        const auto newBlock = new StreamBlock;
-        ThisPos             = 0u;
-        pThisBlock->pNext   = newBlock;
-        pThisBlock          = pThisBlock->pNext;
-        pThisBlock->Index   = Pos;
-        // Check for freeing any extra buffers
-        ReleaseExtraBuffers();
+    // Return next consecutive token
+    token = pThisBlock->Tokens[ThisPos];
+    // Token at the furthest position is reported for the first time
+    if (pThisBlock->Index + ThisPos == Pos)
+        ++Pos;
+    if (++ThisPos == StreamBlock::BufferSize) {
+        ThisPos    = 0u;
+        pThisBlock = pThisBlock->pNext;
     }
     return token;
 }
@@ -0,0 +1,252 @@
+// Filename:  BatchTokenizer.h
+// Content:   Batch tokenizer for many small independent inputs
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_BATCHTOKENIZER_H
+#define INC_SGPARSER_BATCHTOKENIZER_H
+
+#include "DFATokenizer.h"
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace SGParser
+{
+
+// ***** Batch tokenizer
+
+// Tokenizes many short independent records (i.e. log lines), LaneCount records at once
+// Scanning a lexeme is a chain of dependent table lookups, one per byte, which leaves
+// the CPU waiting on every load for a short record. Here every lane scans a record of its
+// own, and the lanes take their steps in turns, so that the loads of the different chains
+// overlap. When a record is finished, its lane takes the next record not started yet
+// Every record is tokenized as a separate input, exactly as DFATokenizer<ViewToken> would,
+// including the expression actions and the keywords; characters are single bytes
+template <size_t LaneCount = 8u>
+class BatchTokenizer final
+{
+public:
+    static_assert(LaneCount != 0u, "BatchTokenizer needs at least one lane");
+
+    using Record = std::basic_string_view<CharT>;
+
+    // Constructor
+    explicit BatchTokenizer(const DFA* pdfa) noexcept : pDFA{pdfa} {}
+
+    // Tokenizes the records, reporting every token to handler(recordIndex, token)
+    // The tokens of a record are reported in order, ending with its EOF token, with the
+    // offsets from the record beginning; the tokens of the different records are interleaved
+    template <class Handler>
+    void Tokenize(const Record* precords, size_t count, Handler&& handler);
+
+    // Tokenizes the records into a vector of tokens for each record
+    void Tokenize(const Record* precords, size_t count,
+                  std::vector<std::vector<ViewToken>>& tokens) {
+        tokens.resize(count);
+        for (auto& recordTokens : tokens)
+            recordTokens.clear();
+        Tokenize(precords, count, [&](size_t record, const ViewToken& token) {
+            tokens[record].push_back(token);
+        });
+    }
+
+private:
+    // Record being tokenized, and the lexeme being scanned in it
+    struct Lane final
+    {
+        const char*           pData              = nullptr;
+        size_t                Size               = 0u;
+        size_t                Record             = 0u;
+
+        size_t                Head               = 0u; // Lexeme beginning
+        size_t                Pos                = 0u; // Next byte to scan
+        unsigned              State              = 0u;
+        unsigned              LastLexemeID       = DFA::EmptyTransition;
+        size_t                LastEnd            = 0u;
+
+        unsigned              ExpressionStackTop = 0u;
+        std::vector<unsigned> ExpressionStack;
+    };
+
+    const DFA* pDFA;
+
+    // Reports a token of the lane record
+    template <class Handler>
+    static void ReportToken(const Lane& lane, Handler& handler, unsigned code,
+                            size_t offset, size_t length) {
+        ViewToken token;
+        token.Code   = code;
+        token.Offset = offset;
+        token.Length = length;
+        handler(lane.Record, token);
+    }
+
+    // Takes a step on the next byte as DFATokenizer does, recording the longest lexeme
+    // recognized; returns true if the lexeme can't be any longer
+    // The step is taken without branches, since whether a lane stops is hard to predict
+    // The self-loop skipping isn't used, since it pays off only for long lexemes
+    template <class Entry>
+    bool Step(const DFA::StateView<Entry>& states, Lane& lane) const noexcept {
+        const auto state  = states.GetTransitionState(lane.State, uint8_t(lane.pData[lane.Pos]));
+        const auto moved  = state != DFA::EmptyTransition;
+        lane.State        = moved ? state : lane.State;
+        lane.Pos         += moved ? 1u : 0u;
+        const auto accept = moved ? pDFA->GetAcceptState(state) : 0u;
+        lane.LastLexemeID = accept != 0u ? accept : lane.LastLexemeID;
+        lane.LastEnd      = accept != 0u ? lane.Pos : lane.LastEnd;
+        return !moved || lane.Pos == lane.Size;
+    }
+
+    // Starts scanning the next lexeme, or reports the EOF token at the end of the record
+    // Returns false if the record is finished
+    template <class Handler>
+    bool StartLexeme(Lane& lane, Handler& handler) const;
+
+    // Reports the token of the lexeme scanned and performs its action, as DFATokenizer does
+    template <class Handler>
+    void FinishLexeme(Lane& lane, Handler& handler) const;
+
+    // Tokenizes the records with the state lookups of the view (see Tokenize)
+    template <class Entry, class Handler>
+    void Tokenize(const DFA::StateView<Entry>& states, const Record* precords, size_t count,
+                  Handler& handler);
+};
+
+// *** BatchTokenizer implementation
+
+// Starts scanning the next lexeme
+template <size_t LaneCount>
+template <class Handler>
+bool BatchTokenizer<LaneCount>::StartLexeme(Lane& lane, Handler& handler) const {
+    if (lane.Head == lane.Size) {
+        ReportToken(lane, handler, TokenCode::TokenEOF, lane.Size, 0u);
+        return false;
+    }
+    lane.Pos          = lane.Head;
+    lane.State        = pDFA->GetExpressionStartState(lane.ExpressionStackTop);
+    lane.LastLexemeID = DFA::EmptyTransition;
+    return true;
+}
+
+
+// Reports the token of the lexeme scanned and performs its action
+template <size_t LaneCount>
+template <class Handler>
+void BatchTokenizer<LaneCount>::FinishLexeme(Lane& lane, Handler& handler) const {
+    const auto head = lane.Head;
+
+    // Error - nothing recognized, skip the character in error
+    if (lane.LastLexemeID == DFA::EmptyTransition) {
+        lane.Head = head + 1u;
+        ReportToken(lane, handler, TokenCode::TokenError, head, 1u);
+        return;
+    }
+
+    lane.Head = lane.LastEnd;
+    auto lexemeId = lane.LastLexemeID;
+    // Tell a keyword apart from the lexeme it was matched as
+    if (pDFA->HasKeywords(lexemeId))
+        lexemeId = pDFA->GetKeywordTable().Find(lexemeId, lane.pData + head, lane.Head - head);
+
+    const auto& lexinfo = pDFA->GetLexemeInfo(lexemeId);
+    const auto  code    = lexinfo.TokenCode;
+
+    // Perform an action, if any
+    switch (lexinfo.Action & LexemeInfo::ActionMask) {
+        case LexemeInfo::ActionPush:
+            lane.ExpressionStack.push_back(lane.ExpressionStackTop);
+            // Fall through to goto
+            [[fallthrough]];
+
+        case LexemeInfo::ActionGoto:
+            lane.ExpressionStackTop = lexinfo.Action & LexemeInfo::ActionValueMask;
+            break;
+
+        case LexemeInfo::ActionPop:
+            if (!lane.ExpressionStack.empty()) {
+                lane.ExpressionStackTop = lane.ExpressionStack.back();
+                lane.ExpressionStack.pop_back();
+            } else { // Empty stack, error
+                lane.ExpressionStackTop = 0u;
+                ReportToken(lane, handler, TokenCode::TokenError, head, lane.Head - head);
+                return;
+            }
+            break;
+    }
+
+    // if code == 0, then ignore token
+    if (code != 0u)
+        ReportToken(lane, handler, code, head, lane.Head - head);
+}
+
+
+// Tokenizes the records, reporting every token to the handler
+template <size_t LaneCount>
+template <class Handler>
+void BatchTokenizer<LaneCount>::Tokenize(const Record* precords, size_t count,
+                                         Handler&& handler) {
+    SG_ASSERT(pDFA && pDFA->IsValid());
+    pDFA->VisitStates(
+        [&](const auto& states) { Tokenize(states, precords, count, handler); });
+}
+
+// Tokenizes the records with the state lookups of the view
+template <size_t LaneCount>
+template <class Entry, class Handler>
+void BatchTokenizer<LaneCount>::Tokenize(const DFA::StateView<Entry>& states,
+                                         const Record* precords, size_t count,
+                                         Handler& handler) {
+
+    // Lanes with a record are kept first
+    std::array<Lane, LaneCount> lanes;
+    size_t                      activeCount = 0u;
+    size_t                      nextRecord  = 0u;
+
+    // Gives the lane the next record with a lexeme to scan, finishing the empty ones
+    const auto startRecord = [&](Lane& lane) {
+        while (nextRecord != count) {
+            lane.pData              = precords[nextRecord].data();
+            lane.Size               = precords[nextRecord].size();
+            lane.Record             = nextRecord++;
+            lane.Head               = 0u;
+            lane.ExpressionStackTop = 0u;
+            lane.ExpressionStack.clear();
+            if (StartLexeme(lane, handler))
+                return true;
+        }
+        return false;
+    };
+
+    while (activeCount != LaneCount && startRecord(lanes[activeCount]))
+        ++activeCount;
+
+    while (activeCount != 0u) {
+        // Take steps in all the lanes, until a lexeme can't be any longer in some of them
+        // The lanes don't depend on each other, so their steps are executed overlapped
+        std::array<size_t, LaneCount> stoppedLanes;
+        size_t                        stoppedCount = 0u;
+        do {
+            for (size_t i = 0u; i < activeCount; ++i) {
+                stoppedLanes[stoppedCount] = i;
+                stoppedCount += Step(states, lanes[i]) ? 1u : 0u;
+            }
+        } while (stoppedCount == 0u);
+
+        // Go on with the next lexeme in the stopped lanes, starting from the last one,
+        // so that the lanes left without records can be replaced with the last active one
+        while (stoppedCount != 0u) {
+            const auto index = stoppedLanes[--stoppedCount];
+            auto&      lane  = lanes[index];
+            FinishLexeme(lane, handler);
+            if (!StartLexeme(lane, handler) && !startRecord(lane) && index != --activeCount)
+                std::swap(lane, lanes[activeCount]);
+        }
+    }
+}
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_BATCHTOKENIZER_H
@@ -0,0 +1,160 @@
+// Filename:  ByteScanSet.cpp
+// Content:   ByteScanSet class implementation
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+//
+// Vector search classifies 16 (or 32) bytes at once by two table lookups on the byte nibbles
+// (pshufb); it is exact for any set of bytes. The implementation is chosen once at runtime.
+
+#include "ByteScanSet.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#define SG_BYTESCANSET_X64
+#endif
+
+// Functions using instruction set extensions must be marked for GCC and Clang
+#if defined(SG_BYTESCANSET_X64) && (defined(__GNUC__) || defined(__clang__))
+#define SG_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define SG_TARGET_AVX2  __attribute__((target("avx2")))
+#else
+#define SG_TARGET_SSSE3
+#define SG_TARGET_AVX2
+#endif
+
+namespace SGParser
+{
+
+// ***** Byte scan set
+
+const char* ByteScanSet::FindFirstScalar(const ByteScanSet& set, const char* pbegin,
+                                         const char* pend) noexcept {
+    while (pbegin < pend && !set.Members[uint8_t(*pbegin)])
+        ++pbegin;
+    return pbegin;
+}
+
+
+#ifdef SG_BYTESCANSET_X64
+
+namespace
+{
+
+// Returns the position of the lowest set bit
+inline unsigned LowestBit(unsigned value) noexcept {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return unsigned(index);
+#else
+    return unsigned(__builtin_ctz(value));
+#endif
+}
+
+// Returns true if the CPU (and OS) supports AVX2
+bool HasAVX2() noexcept {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+    __cpuid(info, 1);
+    // OSXSAVE and AVX, then check that the OS saves the YMM state
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+        (_xgetbv(0) & 0x6u) != 0x6u)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// Returns true if the CPU supports SSSE3
+bool HasSSSE3() noexcept {
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+#else
+    return __builtin_cpu_supports("ssse3");
+#endif
+}
+
+} // namespace
+
+
+SG_TARGET_SSSE3
+const char* ByteScanSet::FindFirstSSSE3(const ByteScanSet& set, const char* pbegin,
+                                        const char* pend) noexcept {
+    const auto maskLow   = _mm_load_si128(reinterpret_cast<const __m128i*>(set.LowNibbleMaskLow));
+    const auto maskHigh  = _mm_load_si128(reinterpret_cast<const __m128i*>(set.LowNibbleMaskHigh));
+    const auto highBit   = _mm_set1_epi8(char(0x80));
+    const auto nibbleBit = _mm_set1_epi64x(int64_t(0x8040201008040201ull));
+
+    for (; pend - pbegin >= 16; pbegin += 16) {
+        const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pbegin));
+        // Bytes with the high bit set produce zero in the shuffle, so each
+        // mask only applies to its own half of the byte values
+        const auto low  = _mm_or_si128(_mm_shuffle_epi8(maskLow, data),
+                                       _mm_shuffle_epi8(maskHigh, _mm_xor_si128(data, highBit)));
+        const auto high = _mm_shuffle_epi8(nibbleBit,
+                                           _mm_andnot_si128(highBit, _mm_srli_epi64(data, 4)));
+        const auto miss = _mm_cmpeq_epi8(_mm_and_si128(low, high), _mm_setzero_si128());
+        const auto hits = unsigned(~_mm_movemask_epi8(miss)) & 0xFFFFu;
+        if (hits)
+            return pbegin + LowestBit(hits);
+    }
+    return FindFirstScalar(set, pbegin, pend);
+}
+
+
+SG_TARGET_AVX2
+const char* ByteScanSet::FindFirstAVX2(const ByteScanSet& set, const char* pbegin,
+                                       const char* pend) noexcept {
+    const auto pmaskLow  = reinterpret_cast<const __m128i*>(set.LowNibbleMaskLow);
+    const auto pmaskHigh = reinterpret_cast<const __m128i*>(set.LowNibbleMaskHigh);
+    const auto maskLow   = _mm256_broadcastsi128_si256(_mm_load_si128(pmaskLow));
+    const auto maskHigh  = _mm256_broadcastsi128_si256(_mm_load_si128(pmaskHigh));
+    const auto highBit   = _mm256_set1_epi8(char(0x80));
+    const auto nibbleBit = _mm256_set1_epi64x(int64_t(0x8040201008040201ull));
+
+    for (; pend - pbegin >= 32; pbegin += 32) {
+        const auto data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pbegin));
+        const auto low  = _mm256_or_si256(_mm256_shuffle_epi8(maskLow, data),
+                                          _mm256_shuffle_epi8(maskHigh,
+                                                              _mm256_xor_si256(data, highBit)));
+        const auto high = _mm256_shuffle_epi8(nibbleBit,
+                                              _mm256_andnot_si256(highBit,
+                                                                  _mm256_srli_epi64(data, 4)));
+        const auto miss = _mm256_cmpeq_epi8(_mm256_and_si256(low, high), _mm256_setzero_si256());
+        const auto hits = ~unsigned(_mm256_movemask_epi8(miss));
+        if (hits)
+            return pbegin + LowestBit(hits);
+    }
+    return FindFirstScalar(set, pbegin, pend);
+}
+
+#endif // SG_BYTESCANSET_X64
+
+
+const char* ByteScanSet::FindFirst(const char* pbegin, const char* pend) const noexcept {
+    using FindFunction = const char* (*)(const ByteScanSet&, const char*, const char*) noexcept;
+
+    // Select the implementation once
+    static const FindFunction pfind = []() -> FindFunction {
+#ifdef SG_BYTESCANSET_X64
+        if (HasAVX2())
+            return &FindFirstAVX2;
+        if (HasSSSE3())
+            return &FindFirstSSSE3;
+#endif
+        return &FindFirstScalar;
+    }();
+
+    return pfind(*this, pbegin, pend);
+}
+
+} // namespace SGParser
@@ -0,0 +1,76 @@
+// Filename:  ByteScanSet.h
+// Content:   Byte set supporting fast search of the first member byte
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_BYTESCANSET_H
+#define INC_SGPARSER_BYTESCANSET_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SGParser
+{
+
+// ***** ByteScanSet
+
+// Set of byte values, which can be searched for in a block of data
+// Search uses SIMD instructions when they are supported by the CPU
+// (selected at runtime), otherwise it falls back to a scalar table lookup
+class ByteScanSet final
+{
+public:
+    static constexpr size_t Size = 256u;
+
+    // Creates an empty set
+    constexpr ByteScanSet() noexcept = default;
+
+    // Creates a set from a 256-bit map of the member bytes (byte N is bit N % 64 of word N / 64)
+    // Can be evaluated at compile time, so the sets can be a part of static tables
+    constexpr ByteScanSet(uint64_t bits0, uint64_t bits1, uint64_t bits2, uint64_t bits3) noexcept {
+        const uint64_t bits[] = {bits0, bits1, bits2, bits3};
+        for (unsigned byte = 0u; byte < Size; ++byte)
+            if ((bits[byte / 64u] >> (byte % 64u)) & 1u)
+                Add(uint8_t(byte));
+    }
+
+    // Add a byte to the set
+    constexpr void Add(uint8_t byte) noexcept {
+        Members[byte] = true;
+
+        const auto bit = uint8_t(1u << ((byte >> 4u) & 7u));
+        if (byte < 0x80u)
+            LowNibbleMaskLow[byte & 0x0Fu] |= bit;
+        else
+            LowNibbleMaskHigh[byte & 0x0Fu] |= bit;
+    }
+
+    // Check if the byte is in the set
+    constexpr bool Contains(uint8_t byte) const noexcept { return Members[byte]; }
+
+    // Returns the first byte in the [pbegin, pend) range that belongs to the set
+    // Returns pend if there are no such bytes
+    const char* FindFirst(const char* pbegin, const char* pend) const noexcept;
+
+private:
+    // Nibble lookup masks used by the vector search: a bit for each of the 8 high nibble
+    // values indexed by the low nibble, separately for bytes below and above 0x80
+    alignas(16) uint8_t LowNibbleMaskLow[16]  = {};
+    alignas(16) uint8_t LowNibbleMaskHigh[16] = {};
+
+    // Scalar lookup table
+    bool                Members[Size]         = {};
+
+    // Search implementations
+    static const char*  FindFirstScalar(const ByteScanSet& set, const char* pbegin,
+                                        const char* pend) noexcept;
+#if defined(__x86_64__) || defined(_M_X64)
+    static const char*  FindFirstSSSE3(const ByteScanSet& set, const char* pbegin,
+                                       const char* pend) noexcept;
+    static const char*  FindFirstAVX2(const ByteScanSet& set, const char* pbegin,
+                                      const char* pend) noexcept;
+#endif
+};
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_BYTESCANSET_H
@@ -0,0 +1,129 @@
+// Filename:  CharClassTable.h
+// Content:   Dense character to character class lookup table
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_CHARCLASSTABLE_H
+#define INC_SGPARSER_CHARCLASSTABLE_H
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace SGParser
+{
+
+// *** CharClassTable class
+
+// Maps every character of the input alphabet directly to a value
+// Lookup is a single array access, which makes it suitable for the inner tokenizer loop
+// Characters outside of the table are treated as having no value
+template <class T, T EmptyValue = T{}, size_t TableSize = 256u>
+class CharClassTable final
+{
+public:
+    using value_type = T;
+
+    static constexpr size_t Size = TableSize;
+
+private:
+    using table_type = std::array<value_type, Size>;
+
+    // Iterates over the positions which have a value, in ascending order
+    // Dereferencing yields a {position, value reference} pair
+    template <class Table, class Value>
+    class Iterator final
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<size_t, Value&>;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = value_type;
+
+        Iterator(Table& table, size_t pos) noexcept : pTable(&table), Pos(pos) { SkipEmpty(); }
+
+        reference operator*() const noexcept { return {Pos, (*pTable)[Pos]}; }
+
+        Iterator& operator++() noexcept      { ++Pos; SkipEmpty(); return *this; }
+        Iterator  operator++(int) noexcept   { auto it = *this; ++*this; return it; }
+
+        bool operator==(const Iterator& other) const noexcept { return Pos == other.Pos; }
+        bool operator!=(const Iterator& other) const noexcept { return Pos != other.Pos; }
+
+    private:
+        Table* pTable;
+        size_t Pos;
+
+        void SkipEmpty() noexcept {
+            while (Pos < Size && (*pTable)[Pos] == EmptyValue)
+                ++Pos;
+        }
+    };
+
+public:
+    using iterator       = Iterator<table_type, value_type>;
+    using const_iterator = Iterator<const table_type, const value_type>;
+
+public:
+    CharClassTable() noexcept { values.fill(EmptyValue); }
+
+    // *** Value access
+
+    // Get the value from the structure
+    value_type GetValue(size_t pos) const noexcept {
+        return pos < Size ? values[pos] : EmptyValue;
+    }
+
+    // Value assignment
+    // Assigning the empty value removes an existing value
+    // Positions outside of the table are ignored
+    void SetValue(size_t pos, const value_type& value) noexcept {
+        if (pos >= Size)
+            return;
+        if (values[pos] == EmptyValue)
+            count += value != EmptyValue;
+        else if (value == EmptyValue)
+            --count;
+        values[pos] = value;
+    }
+
+    // Check if the table has a value for a specific position
+    bool HasValue(size_t pos) const noexcept {
+        return pos < Size && values[pos] != EmptyValue;
+    }
+
+    // Return the empty value used by this structure
+    constexpr value_type GetEmptyValue() const noexcept { return EmptyValue; }
+
+    // Return the dense table of values, indexed by position
+    const value_type* data() const noexcept { return values.data(); }
+
+    // *** Iterators
+
+    // NOTE: The values may be modified through iterators, but not set to empty
+    iterator       begin() noexcept       { return {values, 0u}; }
+    iterator       end() noexcept         { return {values, Size}; }
+    const_iterator begin() const noexcept { return {values, 0u}; }
+    const_iterator end() const noexcept   { return {values, Size}; }
+
+    // *** Utility functions
+
+    // Return the number of valid values
+    size_t size() const noexcept                { return count; }
+    // Return whether or not the table is empty
+    bool   empty() const noexcept               { return count == 0u; }
+    // Clear the table
+    void   clear() noexcept                     { values.fill(EmptyValue); count = 0u; }
+    // Swap the tables
+    void   swap(CharClassTable& other) noexcept { values.swap(other.values);
+                                                  std::swap(count, other.count); }
+
+private:
+    table_type values;
+    size_t     count = 0u;
+};
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_CHARCLASSTABLE_H
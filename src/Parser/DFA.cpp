@@ -6,63 +6,243 @@
 
 #include "DFA.h"
 
+#include <algorithm>
+#include <map>
+
 namespace SGParser
 {
 
 // ***** Deterministic Finite Automaton
 
 // Creates a DFA using a static DFA structure
-// Table data is cleared before the creation and will remain
-// clear in case of exceptions (basic exception safety is provided)
-void DFA::Create(const StaticDFA& staticDFA) {
+// The static data is used in place, so it must outlive the DFA
+void DFA::Create(const StaticDFA& staticDFA) noexcept {
     // Free the existing data
     Destroy();
 
-    // Try to reserve needed space
-    AcceptStates.reserve(staticDFA.TableHeight);
-    LexemeInfos.reserve(staticDFA.LexemeCount);
-    ExpressionStartStates.reserve(staticDFA.ExpressionCount);
-
-    // Temporary container for swap-initialization of TransitionTable
-    decltype(TransitionTable) newTransitionTable;
-    newTransitionTable.reserve(staticDFA.TableHeight);
-    for (size_t i = 0u; i < staticDFA.TableHeight; ++i) {
-        newTransitionTable.emplace_back();
-        newTransitionTable.back().reserve(staticDFA.TableWidth);
-        const auto src = staticDFA.pTransitionTable + staticDFA.TableWidth * i;
-        newTransitionTable.back().assign(src, src + staticDFA.TableWidth);
-    }
+    TransitionLookup       = {staticDFA.pTransitionTable, staticDFA.StateSize};
+    pRowOffsets            = staticDFA.pRowOffsets;
+    pAcceptStates          = staticDFA.pAcceptState;
+    pCharClasses           = staticDFA.pCharTable;
+    pLexemeInfos           = staticDFA.pLexemeInfos;
+    ExpressionStartLookup  = {staticDFA.pExpressionStartState, staticDFA.StateSize};
+    SelfLoopIndexLookup    = {staticDFA.pSelfLoopIndices, staticDFA.StateSize};
+    pSelfLoopExitSets      = staticDFA.pSelfLoopExitSets;
+    pWideBlockIndices      = staticDFA.pWideBlockIndices;
+    pWideBlocks            = staticDFA.pWideBlocks;
+    Keywords               = staticDFA.Keywords;
+    pKeywordOwners         = staticDFA.pKeywordOwners;
+    pPairTransitions       = staticDFA.pPairTransitions;
+    pPairRowOffsets        = staticDFA.pPairRowOffsets;
 
-    // Temporary container for swap-initialization of CharTable
-    decltype(CharTable) newCharTable;
-    // Static CharTable stored as unsigned {index, value} pairs
-    auto pChar = staticDFA.pCharTable;
-    for (size_t i = 0u; i < staticDFA.CharCount; ++i, pChar += 2u)
-        newCharTable.SetValue(pChar[0u], pChar[1u]);
-
-    // From this point we can (safely) initialize the actual data
-
-    // Swap-initialize the transition table
-    TransitionTable.swap(newTransitionTable);
-    // Initialize the accept states
-    AcceptStates.assign(staticDFA.pAcceptState, staticDFA.pAcceptState + staticDFA.TableHeight);
-    // Swap-initialize the character table
-    CharTable.swap(newCharTable);
-    // Initialize the lexeme infos
-    LexemeInfos.assign(staticDFA.pLexemeInfos, staticDFA.pLexemeInfos + staticDFA.LexemeCount);
-    // Initialize the expressions
-    ExpressionStartStates.assign(staticDFA.pExpressionStartState,
-                                 staticDFA.pExpressionStartState + staticDFA.ExpressionCount);
+    StateCount             = staticDFA.TableHeight;
+    TableWidth             = staticDFA.TableWidth;
+    CharCount              = staticDFA.CharCount;
+    LexemeCount            = staticDFA.LexemeCount;
+    ExpressionCount        = staticDFA.ExpressionCount;
+    WideBlockCount         = staticDFA.WideBlockCount;
 }
 
 
 // Destroy the DFA data and reset its variables
 void DFA::Destroy() noexcept {
     CharTable.clear();
-    TransitionTable.clear();
+    Transitions.clear();
+    RowOffsets.clear();
+    SelfLoopIndices.clear();
+    SelfLoopExitSets.clear();
+    WideBlockIndices.clear();
+    WideBlocks.clear();
+    KeywordInfos.clear();
+    KeywordDisplacements.clear();
+    KeywordText.clear();
+    KeywordOwners.clear();
+    PairTransitions.clear();
+    PairRowOffsets.clear();
     AcceptStates.clear();
     ExpressionStartStates.clear();
     LexemeInfos.clear();
+
+    TransitionLookup       = StateTable{};
+    pRowOffsets            = nullptr;
+    pAcceptStates          = nullptr;
+    pCharClasses           = nullptr;
+    pLexemeInfos           = nullptr;
+    ExpressionStartLookup  = StateTable{};
+    SelfLoopIndexLookup    = StateTable{};
+    pSelfLoopExitSets      = nullptr;
+    pWideBlockIndices      = nullptr;
+    pWideBlocks            = nullptr;
+    Keywords               = KeywordTable{};
+    pKeywordOwners         = nullptr;
+    pPairTransitions       = nullptr;
+    pPairRowOffsets        = nullptr;
+
+    StateCount             = 0u;
+    TableWidth             = 0u;
+    CharCount              = 0u;
+    LexemeCount            = 0u;
+    ExpressionCount        = 0u;
+    WideBlockCount         = 0u;
+}
+
+
+// Points the lookup tables to the owned tables
+void DFA::AttachOwnedTables() noexcept {
+    TransitionLookup       = {Transitions.data(), sizeof(StateType)};
+    pRowOffsets            = RowOffsets.data();
+    pAcceptStates          = AcceptStates.data();
+    pCharClasses           = CharTable.data();
+    pLexemeInfos           = LexemeInfos.data();
+    ExpressionStartLookup  = {ExpressionStartStates.data(), sizeof(StateType)};
+    SelfLoopIndexLookup    = {SelfLoopIndices.data(), sizeof(StateType)};
+    pSelfLoopExitSets      = SelfLoopExitSets.data();
+    pWideBlockIndices      = WideBlockIndices.data();
+    pWideBlocks            = WideBlocks.data();
+    Keywords               = {KeywordInfos.size(), KeywordInfos.data(),
+                              KeywordDisplacements.data(), KeywordText.data()};
+    pKeywordOwners         = KeywordOwners.empty() ? nullptr : KeywordOwners.data();
+    pPairTransitions       = PairTransitions.empty() ? nullptr : PairTransitions.data();
+    pPairRowOffsets        = PairRowOffsets.empty() ? nullptr : PairRowOffsets.data();
+
+    StateCount             = RowOffsets.size();
+    CharCount              = CharTable.size();
+    LexemeCount            = LexemeInfos.size();
+    ExpressionCount        = ExpressionStartStates.size();
+    WideBlockCount         = WideBlockIndices.size();
+}
+
+
+// Initializes the flat transition table from a set of rows
+// Rows that are zero-length or have no transitions are mapped to the shared dead row
+// Table data remains unchanged in case of exceptions (strong exception safety is provided)
+void DFA::AssignTransitionTable(const TransitionRows& rows, size_t width) {
+    const auto isDeadRow = [](const std::vector<StateType>& row) {
+        return std::all_of(row.begin(), row.end(),
+                           [](StateType state) { return state == EmptyTransition; });
+    };
+
+    const auto liveRowCount = rows.size() - size_t(std::count_if(rows.begin(), rows.end(),
+                                                                 isDeadRow));
+    const auto hasDeadRow   = liveRowCount != rows.size();
+
+    // Live rows are stored in state order, followed by the dead row (if any)
+    std::vector<StateType> newTransitions;
+    std::vector<uint32_t>  newRowOffsets;
+    newTransitions.reserve((liveRowCount + (hasDeadRow ? 1u : 0u)) * width);
+    newRowOffsets.reserve(rows.size());
+
+    const auto deadRowOffset = uint32_t(liveRowCount * width);
+    for (const auto& row: rows) {
+        if (isDeadRow(row)) {
+            newRowOffsets.push_back(deadRowOffset);
+            continue;
+        }
+        SG_ASSERT(row.size() == width);
+        newRowOffsets.push_back(uint32_t(newTransitions.size()));
+        newTransitions.insert(newTransitions.end(), row.begin(), row.end());
+    }
+    if (hasDeadRow)
+        newTransitions.resize(newTransitions.size() + width, EmptyTransition);
+
+    Transitions.swap(newTransitions);
+    RowOffsets.swap(newRowOffsets);
+    TableWidth = width;
+}
+
+
+// Initializes the two-level wide character table from the sorted, disjoint class ranges
+// Table data remains unchanged in case of exceptions (strong exception safety is provided)
+void DFA::AssignWideCharTable(const std::vector<WideCharClass>& classes) {
+    std::vector<uint16_t>  newBlockIndices;
+    std::vector<ClassType> newBlocks;
+
+    if (!classes.empty()) {
+        // Blocks are built one by one and looked up among the already stored ones
+        const auto blockCount = size_t(MaxChar) / WideBlockSize;
+        std::map<std::vector<ClassType>, uint16_t> blockMap;
+        std::vector<ClassType>                     block(WideBlockSize);
+        auto                                       iclass = classes.begin();
+        newBlockIndices.reserve(blockCount);
+
+        for (size_t iblock = 1u; iblock <= blockCount; ++iblock) {
+            const auto first = unsigned(iblock * WideBlockSize);
+            for (unsigned i = 0u; i < unsigned(WideBlockSize); ++i) {
+                const auto ch = first + i;
+                while (iclass != classes.end() && iclass->To < ch)
+                    ++iclass;
+                block[i] = iclass != classes.end() && iclass->From <= ch ? iclass->Class
+                                                                          : EmptyClass;
+            }
+
+            const auto [iblockMap, added] = blockMap.try_emplace(block,
+                                                                 uint16_t(blockMap.size()));
+            if (added)
+                newBlocks.insert(newBlocks.end(), block.begin(), block.end());
+            newBlockIndices.push_back(iblockMap->second);
+        }
+
+        // The last block index applies to all the following blocks
+        while (newBlockIndices.size() > 1u &&
+               newBlockIndices[newBlockIndices.size() - 2u] == newBlockIndices.back())
+            newBlockIndices.pop_back();
+    }
+
+    WideBlockIndices.swap(newBlockIndices);
+    WideBlocks.swap(newBlocks);
+}
+
+
+// Finds the states looping back to themselves and creates their exit byte sets
+void DFA::FindSelfLoops() {
+    std::vector<StateType>   newIndices(GetStateCount(), EmptyTransition);
+    std::vector<ByteScanSet> newExitSets;
+
+    // Multi-byte UTF-8 characters are made of bytes above 0x7F only, so such bytes
+    // can be skipped only if every character above 0x7F loops too (see GetSelfLoopExitSet)
+    const auto loopsOnWideChars = [this](unsigned state) {
+        if (WideBlockCount == 0u)
+            return false;
+        for (unsigned ch = 0x80u; ch < unsigned(CharTableType::Size); ++ch)
+            if (GetTransitionState(state, ch) != state)
+                return false;
+        // All the stored blocks are referenced, and the last one covers the rest
+        const auto wideCount = size_t(*std::max_element(pWideBlockIndices,
+                                                        pWideBlockIndices + WideBlockCount) +
+                                      1u) * WideBlockSize;
+        for (size_t i = 0u; i < wideCount; ++i)
+            if (pWideBlocks[i] == EmptyClass ||
+                TransitionLookup[pRowOffsets[state] + pWideBlocks[i]] != state)
+                return false;
+        return true;
+    };
+
+    for (unsigned state = 0u; state < unsigned(GetStateCount()); ++state) {
+        ByteScanSet exitSet;
+        bool        loops     = false;
+        const auto  loopsWide = loopsOnWideChars(state);
+        for (unsigned ch = 0u; ch < unsigned(ByteScanSet::Size); ++ch)
+            if (GetTransitionState(state, ch) == state && (ch < 0x80u || loopsWide))
+                loops = true;
+            else
+                exitSet.Add(uint8_t(ch));
+
+        if (loops) {
+            newIndices[state] = StateType(newExitSets.size());
+            newExitSets.push_back(exitSet);
+        }
+    }
+
+    SelfLoopIndices.swap(newIndices);
+    SelfLoopExitSets.swap(newExitSets);
+    SelfLoopIndexLookup = {SelfLoopIndices.data(), sizeof(StateType)};
+    pSelfLoopExitSets   = SelfLoopExitSets.data();
+}
+
+
+// Scans the data for lexemes, appending the lexemes found to the matches
+void DFA::Scan(const char* pdata, size_t size, std::vector<Match>& matches) const {
+    Scan(pdata, size, [&matches](const Match& match) { matches.push_back(match); });
 }
 
 
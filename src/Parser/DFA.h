@@ -7,8 +7,12 @@
 
 #include "SGString.h"
 #include "LexemeInfo.h"
-#include "MappedTable.h"
+#include "CharClassTable.h"
+#include "ByteScanSet.h"
+#include "KeywordTable.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 namespace SGParser
@@ -19,18 +23,31 @@ namespace SGParser
 // *** Static DFA structure declaration
 
 // Used for hard-coded DFA structures
+// The DFA created from this structure references the data directly, without copying it
+// The tables of states have entries of StateSize bytes (1, 2 or 4, see DFA::StateTable)
 struct StaticDFA final
 {
-    size_t      TableWidth;
-    size_t      TableHeight;
-    uint16_t*   pTransitionTable;
-    uint16_t*   pAcceptState;
-    size_t      CharCount;
-    uint8_t*    pCharTable;   // table of {index, value}
-    size_t      LexemeCount;
-    LexemeInfo* pLexemeInfos;
-    size_t      ExpressionCount;
-    uint16_t*   pExpressionStartState;
+    size_t             TableWidth;
+    size_t             TableHeight;            // number of states
+    size_t             StateSize;              // bytes in every state entry
+    const void*        pTransitionTable;       // rows of TableWidth state entries
+    const uint32_t*    pRowOffsets;            // offset of every state row in pTransitionTable
+    const uint16_t*    pAcceptState;
+    size_t             CharCount;
+    const uint16_t*    pCharTable;             // column of every byte value, 0xFFFF for none
+    size_t             LexemeCount;
+    const LexemeInfo*  pLexemeInfos;
+    size_t             ExpressionCount;
+    const void*        pExpressionStartState;  // state entries
+    const void*        pSelfLoopIndices;       // exit set of every state, all ones for none
+    const ByteScanSet* pSelfLoopExitSets;
+    size_t             WideBlockCount;
+    const uint16_t*    pWideBlockIndices;      // block of every 256 characters above 0xFF
+    const uint16_t*    pWideBlocks;            // column of every character in the blocks
+    KeywordTable       Keywords;
+    const uint8_t*     pKeywordOwners;         // 1 for every lexeme keywords are matched as
+    const uint32_t*    pPairTransitions;       // rows of (TableWidth + 1)^2 pair transitions
+    const uint32_t*    pPairRowOffsets;        // pair row of every state, 0xFFFFFFFF for none
 };
 
 
@@ -39,71 +56,304 @@ struct StaticDFA final
 class DFA
 {
 public:
-    using StateType = uint16_t;
+    using StateType = uint32_t;
+    // Transition table column (character class)
+    using ClassType = uint16_t;
 
     static constexpr StateType EmptyTransition = StateType(-1);
+    static constexpr ClassType EmptyClass      = ClassType(-1);
+
+    // Highest character (Unicode code point) the DFA can have transitions on
+    static constexpr unsigned  MaxChar         = 0x10FFFFu;
+
+    // Pair transition which can't be taken, and the pair row offset of the states without one
+    static constexpr uint32_t  EmptyPairTransition = uint32_t(-1);
+    static constexpr uint32_t  NoPairRow           = uint32_t(-1);
+    // Empty state of a pair transition half
+    static constexpr unsigned  EmptyPairState      = 0xFFFFu;
 
 public:
     // Creates an empty DFA
     DFA() = default;
 
     // Initializes the DFA using a static DFA structure
-    explicit DFA(const StaticDFA& staticDFA) {
+    explicit DFA(const StaticDFA& staticDFA) noexcept {
         Create(staticDFA);
     }
 
+    // No copy/move allowed
+    DFA(const DFA&)                = delete;
+    DFA(DFA&&) noexcept            = delete;
+    DFA& operator=(const DFA&)     = delete;
+    DFA& operator=(DFA&&) noexcept = delete;
+
     // Creates a DFA using a static DFA structure
-    // Table data is cleared before the creation and will remain
-    // clear in case of exceptions (basic exception safety is provided)
-    void     Create(const StaticDFA& staticDFA);
+    // The static data is used in place (nothing is copied or allocated),
+    // so it must outlive the DFA
+    void     Create(const StaticDFA& staticDFA) noexcept;
 
     // Destroy the DFA and reset it to empty
     void     Destroy() noexcept;
 
     // Determines whether the DFA is valid
-    bool     IsValid() const noexcept                        { return !TransitionTable.empty(); }
+    bool     IsValid() const noexcept                        { return StateCount != 0u; }
 
     // Returns the transition state
     unsigned GetTransitionState(unsigned state, unsigned ch) const {
         const auto index = GetCharIndex(ch);
-        return index < TransitionTable[state].size() ? TransitionTable[state][index]
-                                                     : EmptyTransition;
+        return index < TableWidth ? TransitionLookup[pRowOffsets[state] + index] : EmptyTransition;
     }
 
     // Return the accept state
-    unsigned GetAcceptState(unsigned state) const            { return AcceptStates[state]; }
+    unsigned GetAcceptState(unsigned state) const            { return pAcceptStates[state]; }
+
+    // Return the set of bytes leaving the state, if the state loops back to itself
+    // on some bytes; all the bytes outside of the set can be skipped in such state
+    // Bytes above 0x7F are outside of the set only if the state loops on all the characters
+    // above 0x7F, so the set is valid for both single byte and UTF-8 encoded characters
+    // Returns nullptr for states without self-loops
+    const ByteScanSet* GetSelfLoopExitSet(unsigned state) const {
+        const auto index = SelfLoopIndexLookup[state];
+        return index != EmptyTransition ? &pSelfLoopExitSets[index] : nullptr;
+    }
+
+    // Literal lexemes (keywords) which are also matched by a more general lexeme
+    // (i.e. an identifier) may be left out of the transition table; the text matched
+    // as such a lexeme is then looked up in the keyword table (see TokenizerBase::FindKeyword)
+
+    // Return whether keywords are matched as the lexeme
+    bool     HasKeywords(unsigned lexemeId) const {
+        return pKeywordOwners && pKeywordOwners[lexemeId] != 0u;
+    }
+
+    // Return the keyword table
+    const KeywordTable& GetKeywordTable() const noexcept     { return Keywords; }
+
+    // Pair transitions take two bytes at a time, with a single table lookup
+    // They are optional, and present only for some of the states (see DFAGen::CreatePairTable)
+    // The state after the first byte is in the low 16 bits of a pair transition,
+    // and the state after both bytes in the high 16 bits; the high bits are EmptyPairState
+    // if the pair can't be taken at once (the lookup has to go on one byte at a time then)
+    // Only the DFAs with fewer than EmptyPairState states can have pair transitions
+
+    // Return whether any of the states have pair transitions
+    bool     HasPairTransitions() const noexcept             { return pPairRowOffsets != nullptr; }
+
+    // Returns the pair transition on two bytes
+    uint32_t GetPairTransition(unsigned state, unsigned byte1, unsigned byte2) const {
+        const auto offset = pPairRowOffsets[state];
+        if (offset == NoPairRow)
+            return EmptyPairTransition;
+        // Bytes without a column share the extra last column
+        const auto width  = TableWidth + 1u;
+        return pPairTransitions[offset + std::min(size_t(pCharClasses[byte1]), TableWidth) * width +
+                                std::min(size_t(pCharClasses[byte2]), TableWidth)];
+    }
 
     // Return the expression start state for a given state
     unsigned GetExpressionStartState(unsigned state) const {
-        return ExpressionStartStates[state];
+        return ExpressionStartLookup[state];
     }
 
     // Return table size
-    size_t   GetStateCount() const noexcept                  { return TransitionTable.size(); }
+    size_t   GetStateCount() const noexcept                  { return StateCount; }
+
+    // Return the size of the state table entries in bytes (see StateTable)
+    size_t   GetStateSize() const noexcept {
+        return TransitionLookup.GetEntrySize();
+    }
 
     // Return the number of characters currently indexed
-    size_t   GetCharCount() const noexcept                   { return CharTable.size(); }
+    size_t   GetCharCount() const noexcept                   { return CharCount; }
 
     // Return the number of expression start states
-    size_t   GetExpressionStartStateCount() const noexcept {
-        return ExpressionStartStates.size();
-    }
+    size_t   GetExpressionStartStateCount() const noexcept   { return ExpressionCount; }
 
     // Return the number of lexemes (lexeme infos)
-    size_t   GetLexemeCount() const noexcept                 { return LexemeInfos.size(); }
+    size_t   GetLexemeCount() const noexcept                 { return LexemeCount; }
 
     // Returns the lexeme info
-    const LexemeInfo& GetLexemeInfo(unsigned lexemeId) const { return LexemeInfos[lexemeId]; }
+    const LexemeInfo& GetLexemeInfo(unsigned lexemeId) const { return pLexemeInfos[lexemeId]; }
+
+    // *** Scanning
+
+    // Lexeme found by Scan; the offset is from the beginning of the data
+    struct Match final
+    {
+        size_t   Offset;
+        size_t   Length;
+        unsigned LexemeID;
+    };
+
+    // Scans the data for lexemes with leftmost-longest matching, without tokenizing it
+    // (i.e. to find the identifiers in a huge file), reporting every lexeme found to
+    // handler(const Match&), in order
+    // Lexemes are matched as DFATokenizer does, including the keywords and the expression
+    // actions, with the self-loop skipping and the pair transitions, but directly over the
+    // data, with no buffering and no token objects; characters are single bytes
+    // The bytes which don't start any lexeme are skipped, and so are the lexemes ignored
+    // (with no token code)
+    template <class Handler>
+    void     Scan(const char* pdata, size_t size, Handler&& handler) const;
+
+    // Scans the data for lexemes, appending the lexemes found to the matches
+    void     Scan(const char* pdata, size_t size, std::vector<Match>& matches) const;
+
+    // *** Lookups with a fixed state entry size
+
+    // Lookups of the state tables with Entry entries (see GetStateSize), so that the
+    // scanning loops choose the entry size once, instead of on every lookup
+    template <class Entry>
+    class StateView final
+    {
+    public:
+        explicit StateView(const DFA& dfa) noexcept
+            : Dfa{dfa},
+              pTransitions{dfa.TransitionLookup.GetEntries<Entry>()},
+              pExpressionStartStates{dfa.ExpressionStartLookup.GetEntries<Entry>()},
+              pSelfLoopIndices{dfa.SelfLoopIndexLookup.GetEntries<Entry>()} {}
+
+        // Same as DFA::GetTransitionState
+        unsigned GetTransitionState(unsigned state, unsigned ch) const {
+            const auto index = Dfa.GetCharIndex(ch);
+            return index < Dfa.TableWidth
+                       ? StateTable::Widen(pTransitions[Dfa.pRowOffsets[state] + index])
+                       : EmptyTransition;
+        }
+
+        // Same as DFA::GetExpressionStartState
+        unsigned GetExpressionStartState(unsigned expression) const {
+            return StateTable::Widen(pExpressionStartStates[expression]);
+        }
+
+        // Same as DFA::GetSelfLoopExitSet
+        const ByteScanSet* GetSelfLoopExitSet(unsigned state) const {
+            const auto index = StateTable::Widen(pSelfLoopIndices[state]);
+            return index != EmptyTransition ? &Dfa.pSelfLoopExitSets[index] : nullptr;
+        }
+
+    private:
+        const DFA&   Dfa;
+        const Entry* pTransitions;
+        const Entry* pExpressionStartStates;
+        const Entry* pSelfLoopIndices;
+    };
+
+    // Calls visitor(const StateView<Entry>&) with the state entry type of the DFA,
+    // returning its result
+    template <class Visitor>
+    decltype(auto) VisitStates(Visitor&& visitor) const {
+        switch (TransitionLookup.GetEntrySize()) {
+            case sizeof(uint8_t):  return visitor(StateView<uint8_t>{*this});
+            case sizeof(uint16_t): return visitor(StateView<uint16_t>{*this});
+            default:               return visitor(StateView<uint32_t>{*this});
+        }
+    }
 
     // PrintDFADotty is a debugging routine to print a DFA to
     // a string suitable for display with the UC Berkeley dotty program
     void     PrintDFADotty(String& str) const;
 
 protected:
-    using CharTableType = MappedTable<unsigned, unsigned(-1)>;
-
-    std::vector<std::vector<StateType>> TransitionTable;
-    std::vector<StateType>              AcceptStates;
+    // Table of states with entries of 1, 2 or 4 bytes, read as StateType
+    // The all ones entry of every size is EmptyTransition
+    // Small DFAs are stored with narrow entries, so that more of the table stays in the cache
+    class StateTable final
+    {
+    public:
+        StateTable() = default;
+        StateTable(const void* pentries, size_t entrySize) noexcept
+            : pEntries{pentries}, EntrySize{entrySize} {
+            SG_ASSERT(entrySize == sizeof(uint8_t) || entrySize == sizeof(uint16_t) ||
+                      entrySize == sizeof(uint32_t));
+        }
+
+        unsigned operator[](size_t index) const {
+            switch (EntrySize) {
+                case sizeof(uint8_t):  return Widen(static_cast<const uint8_t*>(pEntries)[index]);
+                case sizeof(uint16_t): return Widen(static_cast<const uint16_t*>(pEntries)[index]);
+                default:               return static_cast<const uint32_t*>(pEntries)[index];
+            }
+        }
+
+        size_t GetEntrySize() const noexcept { return EntrySize; }
+
+        // Returns the entries, which must be of the Entry type
+        template <class Entry>
+        const Entry* GetEntries() const noexcept {
+            SG_ASSERT(EntrySize == sizeof(Entry));
+            return static_cast<const Entry*>(pEntries);
+        }
+
+        template <class T>
+        static unsigned Widen(T entry) noexcept {
+            return entry != T(-1) ? unsigned(entry) : EmptyTransition;
+        }
+
+    private:
+        const void* pEntries  = nullptr;
+        size_t      EntrySize = sizeof(StateType);
+    };
+
+    // Dense lookup of character class (transition table column) for every input byte
+    using CharTableType = CharClassTable<ClassType, EmptyClass>;
+
+    // Characters above the byte range are looked up in a two-level table: the block
+    // of every CharTableType::Size characters selects a column table for the block
+    // Identical blocks are stored once, and the trailing identical blocks are not stored
+    // at all (the last stored block index applies to the rest of the characters)
+    static constexpr size_t WideBlockSize = CharTableType::Size;
+
+    // Range of characters above the byte range sharing a character class
+    struct WideCharClass final
+    {
+        unsigned  From;
+        unsigned  To;
+        ClassType Class;
+    };
+
+    using TransitionRows = std::vector<std::vector<StateType>>;
+
+    // *** Tables used by the lookups
+    // They point either to the owned tables below, or directly to the static DFA data
+
+    // Transition table rows of TableWidth entries stored in one contiguous block
+    // States without any transitions share a single dead row
+    StateTable         TransitionLookup;
+    // Offset of each state row within the transitions
+    const uint32_t*    pRowOffsets            = nullptr;
+    const uint16_t*    pAcceptStates          = nullptr;
+    // Column of each of the CharTableType::Size byte values
+    const ClassType*   pCharClasses           = nullptr;
+    const LexemeInfo*  pLexemeInfos           = nullptr;
+    StateTable         ExpressionStartLookup;
+    // Exit byte set index for each state, EmptyTransition for states without self-loops
+    StateTable         SelfLoopIndexLookup;
+    const ByteScanSet* pSelfLoopExitSets      = nullptr;
+    // Block index of each wide character block, starting from the first block past the bytes
+    const uint16_t*    pWideBlockIndices      = nullptr;
+    const ClassType*   pWideBlocks            = nullptr;
+    KeywordTable       Keywords;
+    const uint8_t*     pKeywordOwners         = nullptr;
+    // Pair transition rows of (TableWidth + 1)^2 entries, and the row offset of each state
+    // (nullptr if no state has one)
+    const uint32_t*    pPairTransitions       = nullptr;
+    const uint32_t*    pPairRowOffsets        = nullptr;
+
+    size_t             StateCount             = 0u;
+    size_t             TableWidth             = 0u;
+    size_t             CharCount              = 0u;
+    size_t             LexemeCount            = 0u;
+    size_t             ExpressionCount        = 0u;
+    size_t             WideBlockCount         = 0u;
+
+    // *** Owned tables, used when the DFA is not created from static data
+    // The states are always stored with StateType entries
+
+    std::vector<StateType>              Transitions;
+    std::vector<uint32_t>               RowOffsets;
+
+    std::vector<uint16_t>               AcceptStates;
 
     // Lexeme infos for each lexeme
     std::vector<LexemeInfo>             LexemeInfos;
@@ -113,12 +363,147 @@ protected:
 
     CharTableType                       CharTable;
 
-    // Return the transition state for a given character and state
+    std::vector<StateType>              SelfLoopIndices;
+    std::vector<ByteScanSet>            SelfLoopExitSets;
+
+    std::vector<uint16_t>               WideBlockIndices;
+    std::vector<ClassType>              WideBlocks;
+
+    std::vector<KeywordInfo>            KeywordInfos;
+    std::vector<int32_t>                KeywordDisplacements;
+    String                              KeywordText;
+    // Empty if there are no keywords
+    std::vector<uint8_t>                KeywordOwners;
+
+    // Empty if there are no pair transitions
+    std::vector<uint32_t>               PairTransitions;
+    std::vector<uint32_t>               PairRowOffsets;
+
+    // Points the lookup tables to the owned tables
+    // Must be called after the owned tables are modified
+    void     AttachOwnedTables() noexcept;
+
+    // Initializes the flat transition table from a set of rows
+    // Rows that are zero-length or have no transitions are mapped to the shared dead row
+    void     AssignTransitionTable(const TransitionRows& rows, size_t width);
+
+    // Initializes the two-level wide character table from the sorted, disjoint class ranges
+    void     AssignWideCharTable(const std::vector<WideCharClass>& classes);
+
+    // Finds the states looping back to themselves and creates their exit byte sets
+    // Must be called after the transition and character tables are attached
+    void     FindSelfLoops();
+
+    // Scans the data for lexemes with the state lookups of the view (see Scan)
+    template <class Entry, class Handler>
+    void     ScanStates(const StateView<Entry>& states, const char* pdata, size_t size,
+                        Handler& handler) const;
+
+    // Return the transition table column (character class) for a given character
     unsigned GetCharIndex(unsigned ch) const {
-        return CharTable.GetValue(ch);
+        return ch < CharTableType::Size ? pCharClasses[ch] : GetWideCharIndex(ch);
+    }
+
+    // Return the transition table column for a character above the byte range
+    unsigned GetWideCharIndex(unsigned ch) const {
+        if (WideBlockCount == 0u || ch > MaxChar)
+            return EmptyTransition;
+        const auto block = std::min(ch / WideBlockSize - 1u, WideBlockCount - 1u);
+        return pWideBlocks[pWideBlockIndices[block] * WideBlockSize + ch % WideBlockSize];
     }
 };
 
+
+// *** DFA scanning implementation
+
+template <class Handler>
+void DFA::Scan(const char* pdata, size_t size, Handler&& handler) const {
+    SG_ASSERT(IsValid());
+    VisitStates([&](const auto& states) { ScanStates(states, pdata, size, handler); });
+}
+
+// Scans the data for lexemes with the state lookups of the view
+template <class Entry, class Handler>
+void DFA::ScanStates(const StateView<Entry>& states, const char* pdata, size_t size,
+                     Handler& handler) const {
+    const auto            pbegin     = pdata;
+    const auto            pend       = pdata + size;
+    unsigned              expression = 0u;
+    std::vector<unsigned> expressionStack;
+
+    for (auto phead = pbegin; phead != pend;) {
+        // Find the longest lexeme starting at the head
+        auto     state        = states.GetExpressionStartState(expression);
+        unsigned lastLexemeID = EmptyTransition;
+        auto     plastTail    = phead;
+
+        for (auto p = phead; p != pend;) {
+            // Take the next two bytes at once if the pair transitions allow it
+            const auto pair = HasPairTransitions() && pend - p > 1
+                                  ? GetPairTransition(state, uint8_t(p[0]), uint8_t(p[1]))
+                                  : EmptyPairTransition;
+            if ((pair >> 16u) != EmptyPairState) {
+                if (const auto accept = GetAcceptState(pair & 0xFFFFu); accept != 0u) {
+                    lastLexemeID = accept;
+                    plastTail    = p + 1;
+                }
+                state  = pair >> 16u;
+                p     += 2;
+            } else {
+                state = states.GetTransitionState(state, uint8_t(*p));
+                if (state == EmptyTransition)
+                    break;
+                ++p;
+            }
+
+            // Skip all the bytes which keep the state looping back to itself
+            if (const auto pexitSet = states.GetSelfLoopExitSet(state))
+                p = pexitSet->FindFirst(p, pend);
+
+            if (const auto accept = GetAcceptState(state); accept != 0u) {
+                lastLexemeID = accept;
+                plastTail    = p;
+            }
+        }
+
+        // Nothing recognized, skip the byte
+        if (lastLexemeID == EmptyTransition) {
+            ++phead;
+            continue;
+        }
+
+        // Tell a keyword apart from the lexeme it was matched as
+        const auto length = size_t(plastTail - phead);
+        if (HasKeywords(lastLexemeID))
+            lastLexemeID = Keywords.Find(lastLexemeID, phead, length);
+
+        // Perform an action, if any
+        const auto& lexinfo = GetLexemeInfo(lastLexemeID);
+        switch (lexinfo.Action & LexemeInfo::ActionMask) {
+            case LexemeInfo::ActionPush:
+                expressionStack.push_back(expression);
+                // Fall through to goto
+                [[fallthrough]];
+
+            case LexemeInfo::ActionGoto:
+                expression = lexinfo.Action & LexemeInfo::ActionValueMask;
+                break;
+
+            case LexemeInfo::ActionPop:
+                // Popping the empty stack is an error for the tokenizer; here it just
+                // goes back to the first expression
+                expression = expressionStack.empty() ? 0u : expressionStack.back();
+                if (!expressionStack.empty())
+                    expressionStack.pop_back();
+                break;
+        }
+
+        if (lexinfo.TokenCode != 0u)
+            handler(Match{size_t(phead - pbegin), length, lastLexemeID});
+        phead = plastTail;
+    }
+}
+
 } // namespace SGParser
 
 #endif // INC_SGPARSER_DFA_H
@@ -9,6 +9,8 @@
 #include "LexemeInfo.h"
 #include "DFA.h"
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace SGParser
@@ -36,13 +38,53 @@ public:
     // Return next token / EOF Token
     Token& GetNextToken(Token& token) override;
 
+    // Fill in up to count tokens, stopping after EOF
+    size_t GetTokens(Token* ptokens, size_t count) override;
+
+    // *** Expression state
+    // The current expression and the stack of the pushed ones; together with
+    // the input position they determine how the rest of the input is tokenized
+
+    unsigned                     GetExpression() const noexcept      { return ExpressionStackTop; }
+    const std::vector<unsigned>& GetExpressionStack() const noexcept { return ExpressionStack; }
+
+    // Continue tokenizing in a given expression state
+    void SetExpressionState(unsigned expression, const std::vector<unsigned>& stack);
+
+    // Returns the lowest expression stack depth reached since the previous call,
+    // or -1 if the empty stack was popped, and restarts tracking from the current depth
+    ptrdiff_t TakeExpressionStackLowMark() noexcept;
+
+    // *** Checkpoints
+    // State at a token boundary, from which tokenizing can be resumed later
+    // Available for contiguous input only, which can be accessed at any offset
+
+    using typename TokenizerImpl<Token>::PosTracker;
+
+    struct Checkpoint final
+    {
+        size_t                Offset     = 0u; // Byte offset of the boundary
+        PosTracker            Pos;             // Position tracked at the boundary
+        unsigned              Expression = 0u;
+        std::vector<unsigned> ExpressionStack;
+    };
+
+    // Returns the state after the last token returned
+    Checkpoint GetCheckpoint() const;
+    // Continues tokenizing from a checkpoint; the input may be different from the one the
+    // checkpoint was taken on (i.e. edited), as long as the data before the offset is the same
+    void       RestoreCheckpoint(const Checkpoint& checkpoint);
+
+    // Returns the offset where scanning stopped for the last token returned; the longest
+    // match search reads the input up to the character at this offset, inclusive
+    size_t     GetScanStopOffset() const noexcept { return GetInputOffset(ScanStop); }
+
 private:
     using CodeType = typename Token::CodeType;
 
     using typename TokenizerBase::ByteReader;
     using typename TokenizerImpl<Token>::InputCharReader;
     using typename TokenizerImpl<Token>::BufferPos;
-    using typename TokenizerImpl<Token>::PosTracker;
     using TokenizerImpl<Token>::SetInputStream;
     using TokenizerImpl<Token>::HeadPos;
     using TokenizerImpl<Token>::TailPos;
@@ -50,12 +92,32 @@ private:
     using TokenizerImpl<Token>::GetTailPos;
     using TokenizerImpl<Token>::SetTailPos;
     using TokenizerImpl<Token>::AdjustHead;
+    using TokenizerImpl<Token>::FindKeyword;
+    using TokenizerImpl<Token>::GetInputOffset;
+    using TokenizerImpl<Token>::SetTailOffset;
 
     const DFA* pDFA               = nullptr;
     unsigned   ExpressionStackTop = DFA::EmptyTransition;
+    // Tail position where the last scanning stopped
+    BufferPos  ScanStop;
 
     // Expression stack, controls starting state
     std::vector<unsigned> ExpressionStack;
+    ptrdiff_t             ExpressionStackLowMark = 0;
+
+    // Gets next token with the state lookups of the view (see GetNextToken)
+    template <class Entry>
+    Token& GetNextToken(const DFA::StateView<Entry>& states, Token& token);
+
+    // Returns the pair transition on the next two bytes (see DFA::GetPairTransition),
+    // or DFA::EmptyPairTransition if they aren't both loaded or the characters aren't bytes
+    uint32_t GetPairTransition(unsigned state, const InputCharReader& charReader) const {
+        if constexpr (InputCharReader::ByteChars)
+            if (pDFA->HasPairTransitions())
+                if (const auto next = charReader.PeekLoadedChar(); next >= 0)
+                    return pDFA->GetPairTransition(state, charReader.GetChar(), unsigned(next));
+        return DFA::EmptyPairTransition;
+    }
 };
 
 // *** DFA Tokenizer implementation
@@ -67,14 +129,53 @@ bool DFATokenizer<Token>::Create(const DFA* pdfa, InputStream* pinputStream) {
     pDFA = pdfa;
 
     // Starting with expressions 0 in dfa
-    ExpressionStackTop = 0u;
+    ExpressionStackTop     = 0u;
     ExpressionStack.clear();
+    ExpressionStackLowMark = 0;
     return true;
 }
 
+// Continue tokenizing in a given expression state
+template <class Token>
+void DFATokenizer<Token>::SetExpressionState(unsigned expression,
+                                             const std::vector<unsigned>& stack) {
+    ExpressionStackTop     = expression;
+    ExpressionStack        = stack;
+    ExpressionStackLowMark = ptrdiff_t(stack.size());
+}
+
+// Returns the lowest expression stack depth reached since the previous call
+template <class Token>
+ptrdiff_t DFATokenizer<Token>::TakeExpressionStackLowMark() noexcept {
+    return std::exchange(ExpressionStackLowMark, ptrdiff_t(ExpressionStack.size()));
+}
+
+// Returns the state after the last token returned
+template <class Token>
+typename DFATokenizer<Token>::Checkpoint DFATokenizer<Token>::GetCheckpoint() const {
+    return {GetInputOffset(GetTailPos()), TailPos, ExpressionStackTop, ExpressionStack};
+}
+
+// Continues tokenizing from a checkpoint
+template <class Token>
+void DFATokenizer<Token>::RestoreCheckpoint(const Checkpoint& checkpoint) {
+    SetTailOffset(checkpoint.Offset);
+    HeadPos = checkpoint.Pos;
+    TailPos = checkpoint.Pos;
+    SetExpressionState(checkpoint.Expression, checkpoint.ExpressionStack);
+}
+
 // Gets next token, return TokenCode
 template <class Token>
 Token& DFATokenizer<Token>::GetNextToken(Token& token) {
+    return pDFA->VisitStates(
+        [&](const auto& states) -> Token& { return GetNextToken(states, token); });
+}
+
+// Gets next token with the state lookups of the view
+template <class Token>
+template <class Entry>
+Token& DFATokenizer<Token>::GetNextToken(const DFA::StateView<Entry>& states, Token& token) {
     CodeType        code;
     InputCharReader charReader{ByteReader{*this}, TailPos};
 
@@ -88,6 +189,7 @@ Token& DFATokenizer<Token>::GetNextToken(Token& token) {
 
         // If tail's passed the end, EOF
         if (charReader.IsEOF()) {
+            ScanStop = GetTailPos();
             token.CopyFromTokenizer(TokenCode::TokenEOF, *this);
             return token;
         }
@@ -97,7 +199,7 @@ Token& DFATokenizer<Token>::GetNextToken(Token& token) {
         // that is, we get stuck and have nowhere to go
 
         // The initial state of a DFA is always the zeroth state
-        unsigned state        = pDFA->GetExpressionStartState(ExpressionStackTop);
+        unsigned state        = states.GetExpressionStartState(ExpressionStackTop);
         unsigned lastLexemeID = DFA::EmptyTransition;
         // Last recognized Tail
         BufferPos lastTail;
@@ -109,25 +211,48 @@ Token& DFATokenizer<Token>::GetNextToken(Token& token) {
 
         unsigned accept;
 
+        bool advanced;
+
         do {
-            // Get the next state out of the table
-            state = pDFA->GetTransitionState(state, charReader.GetChar());
+            // Take the next two bytes at once if the pair transitions allow it,
+            // recording the state after the first one if it's an accepting state
+            if (const auto pair = GetPairTransition(state, charReader);
+                (pair >> 16u) != DFA::EmptyPairState) {
+                charReader.Advance();
+                if (accept = pDFA->GetAcceptState(pair & 0xFFFFu); accept != 0u) {
+                    lastLexemeID = accept;
+                    lastTailPos  = TailPos;
+                    lastTail     = GetTailPos();
+                }
+                state = pair >> 16u;
+            } else {
+                // Get the next state out of the table
+                state = states.GetTransitionState(state, charReader.GetChar());
+
+                // EmptyTransition means error condition
+                if (state == pDFA->EmptyTransition)
+                    break;
+            }
 
-            // EmptyTransition means error condition
-            if (state == pDFA->EmptyTransition)
-                break;
+            advanced = charReader.Advance();
+
+            // If the state loops back to itself, skip all the bytes
+            // which keep us in it, up to the first one leaving the state
+            if (advanced)
+                if (const auto pexitSet = states.GetSelfLoopExitSet(state))
+                    charReader.SkipUntil(*pexitSet);
 
             // If it's an accepting state, record the pTail position and
             // lexeme ID so we can return them if this turns out to be the longest lexeme
             if (accept = pDFA->GetAcceptState(state); accept != 0u) {
                 lastLexemeID = accept;
-                accept       = charReader.Advance() ? 1u : 0u;
                 lastTailPos  = TailPos;
                 lastTail     = GetTailPos();
-            } else
-                accept = charReader.Advance() ? 1u : 0u;
+            }
+
+        } while (advanced);
 
-        } while (accept != 0u);
+        ScanStop = GetTailPos();
 
         // If we didn't find a valid lexeme, raise an error, unless we've
         // got an empty lexeme. In this case, there are simply no more characters
@@ -141,8 +266,10 @@ Token& DFATokenizer<Token>::GetNextToken(Token& token) {
                 SetTailPos(startHead);
                 TailPos = HeadPos;
                 code    = TokenCode::TokenError;
+                // Skip the character in error; charReader is past it, so a new reader
+                // reads it from the rewound tail
                 if (!charReader.IsEOF())
-                    charReader.Advance();
+                    InputCharReader{ByteReader{*this}, TailPos}.Advance();
             }
             token.CopyFromTokenizer(code, *this);
             return token;
@@ -153,6 +280,10 @@ Token& DFATokenizer<Token>::GetNextToken(Token& token) {
         // Set the line/offset values to the end of the last lexeme found
         TailPos = lastTailPos;
 
+        // Tell a keyword apart from the lexeme it was matched as
+        if (pDFA->HasKeywords(lastLexemeID))
+            lastLexemeID = FindKeyword(pDFA->GetKeywordTable(), lastLexemeID);
+
         // Otherwise, return the lexeme
         // Should be [*pHead, *LastTailPos]
         const auto& lexinfo = pDFA->GetLexemeInfo(lastLexemeID);
@@ -173,8 +304,11 @@ Token& DFATokenizer<Token>::GetNextToken(Token& token) {
                 if (!ExpressionStack.empty()) {
                     ExpressionStackTop = ExpressionStack.back();
                     ExpressionStack.pop_back();
+                    ExpressionStackLowMark = std::min(ExpressionStackLowMark,
+                                                      ptrdiff_t(ExpressionStack.size()));
                 } else { // Empty stack, error
-                    ExpressionStackTop = 0u;
+                    ExpressionStackTop     = 0u;
+                    ExpressionStackLowMark = -1;
                     token.CopyFromTokenizer(TokenCode::TokenError, *this);
                     return token;
                 }
@@ -188,6 +322,19 @@ Token& DFATokenizer<Token>::GetNextToken(Token& token) {
     return token;
 }
 
+// Fills in up to count tokens, stopping after EOF
+template <class Token>
+size_t DFATokenizer<Token>::GetTokens(Token* ptokens, size_t count) {
+    // The state entry size is chosen once for all the tokens
+    return pDFA->VisitStates([&](const auto& states) {
+        size_t index = 0u;
+        while (index < count)
+            if (GetNextToken(states, ptokens[index++]).Code == TokenCode::TokenEOF)
+                break;
+        return index;
+    });
+}
+
 } // namespace SGParser
 
 #endif // INC_SGPARSER_DFATOKENIZER_H
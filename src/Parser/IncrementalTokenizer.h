@@ -0,0 +1,202 @@
+// Filename:  IncrementalTokenizer.h
+// Content:   Incremental tokenizer re-tokenizing edited input
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_INCREMENTALTOKENIZER_H
+#define INC_SGPARSER_INCREMENTALTOKENIZER_H
+
+#include "DFATokenizer.h"
+
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace SGParser
+{
+
+// ***** Incremental tokenizer
+
+// Keeps the tokens of a document which is edited a few bytes at a time (i.e. in an editor),
+// and re-tokenizes only the part of it affected by an edit
+// Tokenizer checkpoints are kept every CheckpointInterval tokens. After an edit, tokenizing
+// resumes from the last checkpoint before which no token read the edited bytes, and stops
+// when a token ends at an old checkpoint past the edit in the same expression state, since
+// from there on the tokens are the same as before, only shifted
+// Tokens must have byte Offset and Length (i.e. ViewToken), so that the tokens past the edit
+// can be shifted; line positions can be computed with LineIndex
+template <class Token = ViewToken>
+class IncrementalTokenizer final
+{
+public:
+    static_assert(std::is_same_v<typename Token::PosTracker, ByteOffsetPosTracker>,
+                  "IncrementalTokenizer requires tokens with byte offset positions");
+
+    // Number of tokens between the checkpoints
+    static constexpr size_t CheckpointInterval = 64u;
+
+    // Change of the tokens made by an edit
+    // The old tokens [First, First + RemovedCount) are replaced with the Inserted ones;
+    // the tokens after them stay the same, with the offsets shifted by the edit
+    struct TokenDiff final
+    {
+        size_t             First        = 0u;
+        size_t             RemovedCount = 0u;
+        std::vector<Token> Inserted;
+    };
+
+    // Constructor
+    explicit IncrementalTokenizer(const DFA* pdfa) : pDFA{pdfa}, Checkpoints(1u) {}
+
+    // Tokenizes the whole document
+    void      Tokenize(const char* pdata, size_t size);
+
+    // Re-tokenizes the document after an edit, which replaced the [editBegin, editEnd) bytes
+    // of the previous document data with insertSize bytes
+    // The data is the whole document after the edit
+    TokenDiff Retokenize(const char* pdata, size_t size,
+                         size_t editBegin, size_t editEnd, size_t insertSize);
+
+    // Returns the tokens of the document, ending with the EOF token
+    const std::vector<Token>& GetTokens() const noexcept { return Tokens; }
+
+private:
+    using Tokenizer = DFATokenizer<Token>;
+
+    struct Checkpoint final
+    {
+        size_t                         Index   = 0u; // Number of tokens before the checkpoint
+        size_t                         ReadEnd = 0u; // End of the input read for these tokens
+        typename Tokenizer::Checkpoint State;
+    };
+
+    // Bytes read at the scan stop offset to decode the character there (UTF-8 at most)
+    static constexpr size_t MaxCharSize = 4u;
+
+    const DFA*              pDFA;
+    size_t                  Size = 0u;
+    std::vector<Token>      Tokens;
+    // The first checkpoint is the initial state
+    std::vector<Checkpoint> Checkpoints;
+
+    // Re-tokenizes after an edit and replaces the affected tokens and checkpoints
+    // Returns the index of the first token replaced and the number of tokens removed
+    std::pair<size_t, size_t> Splice(const char* pdata, size_t size,
+                                     size_t editBegin, size_t editEnd, size_t insertSize);
+};
+
+// *** IncrementalTokenizer implementation
+
+// Tokenizes the whole document
+template <class Token>
+void IncrementalTokenizer<Token>::Tokenize(const char* pdata, size_t size) {
+    Size = 0u;
+    Tokens.clear();
+    Checkpoints.assign(1u, Checkpoint{});
+    // The whole data is an edit inserted into an empty document
+    Splice(pdata, size, 0u, 0u, size);
+}
+
+// Re-tokenizes the document after an edit and returns the token diff
+template <class Token>
+typename IncrementalTokenizer<Token>::TokenDiff
+IncrementalTokenizer<Token>::Retokenize(const char* pdata, size_t size,
+                                        size_t editBegin, size_t editEnd, size_t insertSize) {
+    const auto oldCount         = Tokens.size();
+    const auto [first, removed] = Splice(pdata, size, editBegin, editEnd, insertSize);
+
+    TokenDiff diff;
+    diff.First        = first;
+    diff.RemovedCount = removed;
+    const auto pbegin = Tokens.begin() + ptrdiff_t(first);
+    diff.Inserted.assign(pbegin, pbegin + ptrdiff_t(Tokens.size() + removed - oldCount));
+    return diff;
+}
+
+// Re-tokenizes after an edit and replaces the affected tokens and checkpoints
+template <class Token>
+std::pair<size_t, size_t>
+IncrementalTokenizer<Token>::Splice(const char* pdata, size_t size,
+                                    size_t editBegin, size_t editEnd, size_t insertSize) {
+    SG_ASSERT(pDFA && pDFA->IsValid());
+    SG_ASSERT(editBegin <= editEnd && editEnd <= Size);
+    SG_ASSERT(size == Size - (editEnd - editBegin) + insertSize);
+
+    const auto delta = ptrdiff_t(insertSize) - ptrdiff_t(editEnd - editBegin);
+    Size             = size;
+
+    // Resume from the last checkpoint whose tokens didn't read the edited bytes
+    // The read ends only grow along the checkpoints, and the first one has no tokens
+    const auto resume = std::prev(std::partition_point(Checkpoints.begin() + 1, Checkpoints.end(),
+                                                       [=](const Checkpoint& checkpoint) {
+                                                           return checkpoint.ReadEnd <= editBegin;
+                                                       }));
+    const auto first  = resume->Index;
+
+    // Empty data has to be contiguous input too
+    MemBufferInputStream stream{pdata ? pdata : "", size};
+    Tokenizer            tokenizer{pDFA, &stream};
+    tokenizer.RestoreCheckpoint(resume->State);
+
+    // Old checkpoints past the edit, where the new tokens may re-synchronize with the old ones
+    auto sync = std::partition_point(std::next(resume), Checkpoints.end(),
+                                     [=](const Checkpoint& checkpoint) {
+                                         return checkpoint.State.Offset < editEnd;
+                                     });
+
+    std::vector<Token>      inserted;
+    std::vector<Checkpoint> newCheckpoints;
+    auto                    readEnd = resume->ReadEnd;
+    auto                    synced  = false;
+
+    Token token;
+    for (;;) {
+        tokenizer.GetNextToken(token);
+        inserted.push_back(token);
+        readEnd = std::max(readEnd, tokenizer.GetScanStopOffset() + MaxCharSize);
+        if (token.Code == TokenCode::TokenEOF)
+            break;
+
+        const auto end = ptrdiff_t(token.Offset + token.Length);
+        while (sync != Checkpoints.end() && ptrdiff_t(sync->State.Offset) + delta < end)
+            ++sync;
+        if (sync != Checkpoints.end() && ptrdiff_t(sync->State.Offset) + delta == end &&
+            sync->State.Expression == tokenizer.GetExpression() &&
+            sync->State.ExpressionStack == tokenizer.GetExpressionStack()) {
+            synced = true;
+            break;
+        }
+
+        if (inserted.size() % CheckpointInterval == 0u)
+            newCheckpoints.push_back({first + inserted.size(), readEnd, tokenizer.GetCheckpoint()});
+    }
+
+    // Tokens and checkpoints from the synchronization point on are kept and shifted
+    const auto removedEnd = synced ? sync->Index : Tokens.size();
+    const auto indexDelta = ptrdiff_t(inserted.size()) - ptrdiff_t(removedEnd - first);
+
+    for (auto it = Tokens.begin() + ptrdiff_t(removedEnd); it != Tokens.end(); ++it)
+        it->Offset = size_t(ptrdiff_t(it->Offset) + delta);
+    Tokens.erase(Tokens.begin() + ptrdiff_t(first), Tokens.begin() + ptrdiff_t(removedEnd));
+    Tokens.insert(Tokens.begin() + ptrdiff_t(first), inserted.begin(), inserted.end());
+
+    // Shifted read ends of the kept checkpoints may only be larger than the actual ones,
+    // which is safe; they still have to include the read ends of the new tokens
+    const auto keep = synced ? sync : Checkpoints.end();
+    for (auto it = keep; it != Checkpoints.end(); ++it) {
+        it->Index            = size_t(ptrdiff_t(it->Index) + indexDelta);
+        it->State.Offset     = size_t(ptrdiff_t(it->State.Offset) + delta);
+        it->State.Pos.Offset = it->State.Offset;
+        readEnd              = std::max(readEnd, size_t(ptrdiff_t(it->ReadEnd) + delta));
+        it->ReadEnd          = readEnd;
+    }
+    const auto pos = Checkpoints.erase(std::next(resume), keep);
+    Checkpoints.insert(pos, newCheckpoints.begin(), newCheckpoints.end());
+
+    return {first, removedEnd - first};
+}
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_INCREMENTALTOKENIZER_H
@@ -17,6 +17,9 @@ namespace SGParser
 
 // ***** Input stream
 
+struct TokenizerBuffer;
+class TokenizerBufferPool;
+
 // Signed type for representing size of buffer to read/write
 // and return number of bytes read/written
 using StreamSize = std::make_signed_t<size_t>;
@@ -35,6 +38,20 @@ public:
     // Closes the stream
     // This stream object can't be used again after being closed
     virtual bool       Close()                                            = 0;
+
+    // Returns the remaining stream data if it is available as a single contiguous
+    // memory block, which stays valid and unchanged until the stream is closed
+    // Returns nullptr otherwise, in which case the data must be obtained by Read()
+    // This allows the data to be scanned in place, without copying
+    virtual const uint8_t* GetContiguousData(size_t& size) noexcept {
+        size = 0u;
+        return nullptr;
+    }
+
+    // Hands over the next tokenizer buffer, if the stream fills the buffers itself
+    // The buffer is taken as it is and returned to the pool when the tokenizer is done with it
+    // Returns nullptr for EOF, or if the data must be obtained by Read()
+    virtual TokenizerBuffer* TakeBuffer(TokenizerBufferPool&) { return nullptr; }
 };
 
 
@@ -168,6 +185,11 @@ public:
         return true;
     }
 
+    const uint8_t* GetContiguousData(size_t& dataSize) noexcept override {
+        dataSize = buf ? size - pos : 0u;
+        return buf ? buf + pos : nullptr;
+    }
+
 private:
     const uint8_t* buf  = nullptr;
     size_t         size = 0u;
@@ -0,0 +1,78 @@
+// Filename:  KeywordTable.h
+// Content:   Perfect hash table of the keywords recognized by a DFA
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_KEYWORDTABLE_H
+#define INC_SGPARSER_KEYWORDTABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace SGParser
+{
+
+// ***** Keyword table
+
+// Keyword is a literal lexeme which the DFA recognizes as a more general lexeme
+// (i.e. an identifier), and which is told apart from it by the text matched
+struct KeywordInfo final
+{
+    // Lexeme of the keyword
+    uint32_t Lexeme;
+    // Lexeme the DFA recognizes the keyword as
+    uint32_t MatchLexeme;
+    // Keyword text in the table text
+    uint32_t TextOffset;
+    uint32_t TextSize;
+};
+
+
+// Minimal perfect hash table of the keywords, keyed by the match lexeme and the text
+// The first hash of a key selects a bucket, whose displacement either seeds the second hash
+// giving the slot of the key, or (if negative) is the slot of the only key in the bucket
+// Every keyword has a slot of its own, so a lookup takes two hashes and a text comparison
+struct KeywordTable final
+{
+    // Longest keyword text
+    static constexpr size_t MaxTextSize = 64u;
+
+    size_t             Count          = 0u;
+    const KeywordInfo* pKeywords      = nullptr; // keywords in their slots
+    const int32_t*     pDisplacements = nullptr; // displacement of every bucket
+    const char*        pText          = nullptr;
+
+    // Hashes a key with a seed (FNV-1a with the bits mixed for the remainder)
+    static uint32_t Hash(unsigned lexemeId, const char* pdata, size_t size,
+                         uint32_t seed) noexcept {
+        auto hash = (0x811C9DC5u ^ seed) * 0x01000193u;
+        hash      = (hash ^ lexemeId) * 0x01000193u;
+        for (size_t i = 0u; i < size; ++i)
+            hash = (hash ^ uint8_t(pdata[i])) * 0x01000193u;
+        hash ^= hash >> 16u;
+        hash *= 0x7FEB352Du;
+        return hash ^ (hash >> 15u);
+    }
+
+    // Returns the slot the key would be stored in
+    size_t GetSlot(unsigned lexemeId, const char* pdata, size_t size) const noexcept {
+        const auto displacement = pDisplacements[Hash(lexemeId, pdata, size, 0u) % Count];
+        return displacement < 0 ? size_t(-(displacement + 1))
+                                : Hash(lexemeId, pdata, size, uint32_t(displacement)) % Count;
+    }
+
+    // Returns the keyword lexeme for the text matched as a lexeme,
+    // or the lexeme itself if the text is not a keyword
+    unsigned Find(unsigned lexemeId, const char* pdata, size_t size) const noexcept {
+        if (Count == 0u || size > MaxTextSize)
+            return lexemeId;
+        const auto& keyword = pKeywords[GetSlot(lexemeId, pdata, size)];
+        return keyword.MatchLexeme == lexemeId && keyword.TextSize == size &&
+               std::memcmp(pText + keyword.TextOffset, pdata, size) == 0 ? keyword.Lexeme
+                                                                           : lexemeId;
+    }
+};
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_KEYWORDTABLE_H
@@ -0,0 +1,85 @@
+// Filename:  LineIndex.cpp
+// Content:   LineIndex class implementation
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "LineIndex.h"
+
+// SSE2 is a part of the x64 baseline, so no runtime selection is needed
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define SG_LINEINDEX_SSE2
+#endif
+
+namespace SGParser
+{
+
+// ***** Line index
+
+// Counts the newline bytes, 16 bytes at a time
+size_t LineIndex::CountNewlines(const char* pbegin, const char* pend) noexcept {
+    size_t count = 0u;
+
+#ifdef SG_LINEINDEX_SSE2
+    const auto newline = _mm_set1_epi8('\n');
+    while (pend - pbegin >= 16) {
+        // Matches are counted in byte lanes, which are summed up before they can overflow
+        auto counts = _mm_setzero_si128();
+        for (unsigned i = 0u; i < 255u && pend - pbegin >= 16; ++i, pbegin += 16) {
+            const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pbegin));
+            counts          = _mm_sub_epi8(counts, _mm_cmpeq_epi8(data, newline));
+        }
+        const auto sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+        count += size_t(_mm_cvtsi128_si32(sums)) + size_t(_mm_extract_epi16(sums, 4));
+    }
+#endif
+
+    for (; pbegin != pend; ++pbegin)
+        count += *pbegin == '\n';
+    return count;
+}
+
+
+// Finds the line of the byte at the offset, extending the index up to it if needed
+const char* LineIndex::FindLine(size_t offset, size_t& line) const {
+    SG_ASSERT(pData && offset <= Size);
+
+    const auto block = offset / BlockSize;
+    if (BlockLines.empty())
+        BlockLines.push_back(0u);
+    while (BlockLines.size() <= block) {
+        const auto pblock = pData + (BlockLines.size() - 1u) * BlockSize;
+        BlockLines.push_back(BlockLines.back() + CountNewlines(pblock, pblock + BlockSize));
+    }
+
+    const auto pchar = pData + offset;
+    line             = BlockLines[block] + CountNewlines(pData + block * BlockSize, pchar);
+
+    // The line begins right after the last newline before the byte
+    auto pline = pchar;
+    while (pline != pData && pline[-1] != '\n')
+        --pline;
+    return pline;
+}
+
+
+size_t LineIndex::GetLine(size_t offset) const {
+    size_t line;
+    FindLine(offset, line);
+    return line;
+}
+
+
+LineOffsetPosTracker LineIndex::GetPos(size_t offset) const {
+    LineOffsetPosTracker pos;
+    pos.AdvanceRange(FindLine(offset, pos.Line), pData + offset);
+    return pos;
+}
+
+
+LineOffsetPosTracker LineIndex::GetUTF8Pos(size_t offset) const {
+    LineOffsetPosTracker pos;
+    pos.AdvanceUTF8Range(FindLine(offset, pos.Line), pData + offset);
+    return pos;
+}
+
+} // namespace SGParser
@@ -0,0 +1,65 @@
+// Filename:  LineIndex.h
+// Content:   Lazy line index computing line positions from byte offsets
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_LINEINDEX_H
+#define INC_SGPARSER_LINEINDEX_H
+
+#include "Tokenizer.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace SGParser
+{
+
+// ***** Line index
+
+// Computes line / offset positions from byte offsets in contiguous input
+// Tokens only need to track their byte offset (see ViewToken), and the line position
+// is computed on demand, only for the tokens it is requested for (i.e. in error messages)
+// The positions are the same as the ones LineOffsetPosTracker tracks during tokenizing
+// Newlines are counted with SIMD instructions per block of input; the block counts are
+// accumulated lazily, only up to the largest offset requested so far
+// Queries update the index, so concurrent queries must be synchronized
+class LineIndex final
+{
+public:
+    // Input bytes per index entry
+    static constexpr size_t BlockSize = 4096u;
+
+    LineIndex() = default;
+    LineIndex(const char* pdata, size_t size) noexcept : pData{pdata}, Size{size} {}
+
+    // Set the input data, discarding the index built so far
+    void SetData(const char* pdata, size_t size) noexcept {
+        pData = pdata;
+        Size  = size;
+        BlockLines.clear();
+    }
+
+    // Return the zero-based line of the byte at the offset
+    size_t               GetLine(size_t offset) const;
+
+    // Return the position of the byte at the offset, with every byte being a character
+    LineOffsetPosTracker GetPos(size_t offset) const;
+    // Return the position of the byte at the offset, counting characters in UTF-8
+    LineOffsetPosTracker GetUTF8Pos(size_t offset) const;
+
+    // Return the number of newline bytes in the [pbegin, pend) range
+    static size_t        CountNewlines(const char* pbegin, const char* pend) noexcept;
+
+private:
+    const char* pData = nullptr;
+    size_t      Size  = 0u;
+
+    // Number of the lines before each block
+    mutable std::vector<size_t> BlockLines;
+
+    // Returns the line and the beginning of the line of the byte at the offset
+    const char* FindLine(size_t offset, size_t& line) const;
+};
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_LINEINDEX_H
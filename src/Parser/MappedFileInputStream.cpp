@@ -0,0 +1,104 @@
+// Filename:  MappedFileInputStream.cpp
+// Content:   Memory-mapped file input stream implementation
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "MappedFileInputStream.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SGParser
+{
+
+// ***** Memory-mapped file input stream
+
+// Opens and maps the file, closing the previously opened one
+// Empty files are opened successfully, but have no mapping
+bool MappedFileInputStream::Open(const String& fileName) {
+    Close();
+
+#ifdef _WIN32
+    const auto hfile = CreateFileA(fileName.data(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                   OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (hfile == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(hfile, &fileSize)) {
+        CloseHandle(hfile);
+        return false;
+    }
+
+    if (fileSize.QuadPart > 0) {
+        const auto hmapping = CreateFileMappingA(hfile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        const auto pview    = hmapping ? MapViewOfFile(hmapping, FILE_MAP_READ, 0, 0, 0)
+                                       : nullptr;
+        // The view keeps the mapping alive
+        if (hmapping)
+            CloseHandle(hmapping);
+        if (!pview) {
+            CloseHandle(hfile);
+            return false;
+        }
+        pData = static_cast<const uint8_t*>(pview);
+        Size  = static_cast<size_t>(fileSize.QuadPart);
+    }
+    CloseHandle(hfile);
+#else
+    const auto fd = open(fileName.data(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0) {
+        close(fd);
+        return false;
+    }
+
+    if (fileStat.st_size > 0) {
+        const auto size  = static_cast<size_t>(fileStat.st_size);
+        const auto pview = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (pview == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        // Only a hint, failure is not an error
+        madvise(pview, size, MADV_SEQUENTIAL);
+        pData = static_cast<const uint8_t*>(pview);
+        Size  = size;
+    }
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+#endif
+
+    Opened = true;
+    return true;
+}
+
+
+// Unmaps the file
+bool MappedFileInputStream::Close() noexcept {
+    if (pData) {
+#ifdef _WIN32
+        UnmapViewOfFile(pData);
+#else
+        munmap(const_cast<uint8_t*>(pData), Size);
+#endif
+    }
+
+    pData  = nullptr;
+    Size   = 0u;
+    Pos    = 0u;
+    Opened = false;
+    return true;
+}
+
+} // namespace SGParser
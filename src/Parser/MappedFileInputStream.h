@@ -0,0 +1,72 @@
+// Filename:  MappedFileInputStream.h
+// Content:   Memory-mapped file input stream
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_MAPPEDFILEINPUTSTREAM_H
+#define INC_SGPARSER_MAPPEDFILEINPUTSTREAM_H
+
+#include "SGStream.h"
+
+#include <algorithm>
+
+namespace SGParser
+{
+
+// ***** MappedFileInputStream
+
+// Maps the whole file into memory (read-only) and provides it as contiguous data,
+// so that tokenizers can scan the file in place without copying it into buffers
+// The mapping is hinted for sequential access
+class MappedFileInputStream final : public InputStream
+{
+public:
+    // Default constructor (closed stream)
+    MappedFileInputStream() noexcept = default;
+
+    // Constructor that opens the file
+    explicit MappedFileInputStream(const String& fileName) { Open(fileName); }
+
+    // No copy/move allowed
+    MappedFileInputStream(const MappedFileInputStream&)                = delete;
+    MappedFileInputStream(MappedFileInputStream&&) noexcept            = delete;
+    MappedFileInputStream& operator=(const MappedFileInputStream&)     = delete;
+    MappedFileInputStream& operator=(MappedFileInputStream&&) noexcept = delete;
+
+    // Destructor
+    ~MappedFileInputStream() override { Close(); }
+
+    // Opens and maps the file, closing the previously opened one (true for success)
+    bool Open(const String& fileName);
+
+    // Return true if the file is opened
+    bool IsOpen() const noexcept { return Opened; }
+
+    // *** InputStream overrides
+
+    StreamSize Read(uint8_t* pBuffer, StreamSize numBytes) override {
+        const size_t length = std::min(Size - Pos, static_cast<size_t>(numBytes));
+        if (length > 0u) {
+            std::copy(pData + Pos, pData + Pos + length, pBuffer);
+            Pos += length;
+        }
+        return static_cast<StreamSize>(length);
+    }
+
+    bool Close() noexcept override;
+
+    const uint8_t* GetContiguousData(size_t& dataSize) noexcept override {
+        dataSize = Size - Pos;
+        return pData ? pData + Pos : nullptr;
+    }
+
+private:
+    // Mapped data, null for empty (or closed) files
+    const uint8_t* pData  = nullptr;
+    size_t         Size   = 0u;
+    size_t         Pos    = 0u;
+    bool           Opened = false;
+};
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_MAPPEDFILEINPUTSTREAM_H
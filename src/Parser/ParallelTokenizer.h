@@ -0,0 +1,472 @@
+// Filename:  ParallelTokenizer.h
+// Content:   Parallel tokenizer for large contiguous inputs
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_PARALLELTOKENIZER_H
+#define INC_SGPARSER_PARALLELTOKENIZER_H
+
+#include "DFATokenizer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace SGParser
+{
+
+// ***** Parallel tokenizer
+
+// Tokenizes contiguous input split into chunks, which are tokenized concurrently
+// Token boundaries and the expression state at a chunk start are not known in advance,
+// so every chunk but the first is tokenized speculatively from its first byte, once for
+// each expression start state. The chunks are then stitched in order: the known tokens
+// end at some position in some expression state, and a speculative run which has a token
+// ending at the same position in the same state continues with exactly the right tokens.
+// Where no run converges, the input is tokenized sequentially until one does
+// Speculative tokenizing takes as many passes over a chunk as there are expressions
+// Position trackers at the chunk starts are advanced over the preceding data sequentially,
+// which is cheap only for byte offsets, so it's best suited for ViewToken
+template <class Token>
+class ParallelTokenizer final
+{
+public:
+    using PosTracker      = typename Token::PosTracker;
+    using InputCharReader = typename Token::InputCharReader;
+
+    // Chunks are never smaller than this, so small inputs are tokenized sequentially
+    static constexpr size_t MinChunkSize          = 256u * 1024u;
+
+    // Speculative runs start with this many expression 0 entries on the stack, standing
+    // for the unknown actual stack; the ones the run pops are checked against the actual
+    // stack when the chunks are stitched
+    static constexpr size_t SpeculativeStackDepth = 16u;
+
+    // Constructor
+    explicit ParallelTokenizer(const DFA* pdfa) noexcept : pDFA{pdfa} {}
+
+    // Tokenizes the data into an ordered vector of tokens ending with the EOF token
+    // Uses up to threadCount threads, 0 selects the number of hardware threads
+    void   Tokenize(const char* pdata, size_t size, std::vector<Token>& tokens,
+                    unsigned threadCount = 0u);
+
+    // Returns the number of chunks on the last Tokenize() call, where no speculative
+    // run converged at the chunk start and sequential tokenizing was needed
+    size_t GetSequentialChunkCount() const noexcept { return SequentialChunkCount; }
+
+private:
+    // Expression state after a token of a run
+    struct StateChange final
+    {
+        size_t    Index;        // Token index
+        unsigned  Expression;
+        ptrdiff_t Depth;        // Expression stack depth
+        ptrdiff_t LowDepth;     // Lowest depth reached within this token (-1 for underflow),
+                                // then lowest depth reached from this token on
+        size_t    TopFrame;     // Stack top entry
+    };
+
+    // Expression stack entry; the stacks after all the changes of a run share the entries
+    struct StackFrame final
+    {
+        unsigned Expression;
+        size_t   Below;         // Entry below it, or NoFrame
+    };
+
+    static constexpr size_t NoFrame = size_t(-1);
+
+    // Tokens of a part of the input, tokenized from some position and expression state
+    struct Run final
+    {
+        size_t                   Begin           = 0u;
+        unsigned                 Expression      = 0u;
+        size_t                   InitialDepth    = 0u;
+
+        std::vector<Token>       Tokens;
+        std::vector<size_t>      Ends;          // End offset of each token
+        std::vector<StateChange> Changes;
+        std::vector<StackFrame>  StackFrames;
+        size_t                   InitialTopFrame = NoFrame;
+
+        // State after the last token
+        size_t                   End             = 0u;
+        unsigned                 FinalExpression = 0u;
+        std::vector<unsigned>    FinalStack;
+        PosTracker               EndPos;
+        bool                     EOFFlag         = false;
+    };
+
+    // Stitching state, the tokens are known up to End
+    struct Frontier final
+    {
+        size_t                End        = 0u;
+        unsigned              Expression = 0u;
+        std::vector<unsigned> Stack;
+        PosTracker            EndPos;
+        bool                  EOFFlag    = false;
+    };
+
+    const DFA*  pDFA                 = nullptr;
+    const char* pData                = nullptr;
+    size_t      Size                 = 0u;
+    size_t      SequentialChunkCount = 0u;
+
+    // *** Utility functions
+
+    // Returns the offset of the tokenizer tail in the data
+    size_t GetTailOffset(const DFATokenizer<Token>& tokenizer) const noexcept {
+        return size_t(tokenizer.TokenizerBase::GetTailPos().pChar - pData);
+    }
+
+    // Tokenizes the run from its start until a token starts at or past the limit
+    void   ScanRun(Run& run, size_t limit, const PosTracker& startPos) const;
+
+    // Point in a run, from which it produces the same tokens as the actual tokenizing
+    struct Convergence final
+    {
+        size_t First     = 0u;  // Index of the first token to take
+        size_t PopCount  = 0u;  // Number of the actual stack entries popped by the run
+        size_t KeepDepth = 0u;  // Depth from which the run's final stack is taken
+    };
+
+    // Looks for a convergence point with tokenizing from the given position and expression
+    // state; cursor is a lower bound of the token index, kept between the calls
+    static bool FindConvergence(const Run& run, size_t end, unsigned expression,
+                                const std::vector<unsigned>& stack, size_t& cursor,
+                                Convergence& convergence);
+
+    // Appends the tokens of the run from the convergence point
+    static void TakeRun(Run& run, const Convergence& convergence, Frontier& frontier,
+                        std::vector<Token>& tokens);
+
+    // Tokenizes sequentially from the frontier until a token starts at or past the limit,
+    // or converges with one of the runs
+    void   ScanSequential(Frontier& frontier, size_t limit, std::vector<Run>& runs,
+                          std::vector<Token>& tokens) const;
+};
+
+
+// ***** Vector token stream
+
+// Reports the tokens from a vector (such as the one filled by ParallelTokenizer)
+// The vector must end with the EOF token
+template <class Token>
+class VectorTokenStream final : public TokenStream<Token>
+{
+public:
+    explicit VectorTokenStream(const std::vector<Token>& tokens) noexcept : pTokens{&tokens} {}
+
+    // *** Token stream implementation
+
+    Token& GetNextToken(Token& token) override {
+        token = Pos < pTokens->size() ? (*pTokens)[Pos++] : Token{};
+        return token;
+    }
+
+    size_t GetTokens(Token* ptokens, size_t count) override {
+        if (Pos == pTokens->size()) {
+            if (count == 0u)
+                return 0u;
+            ptokens[0u] = Token{};
+            return 1u;
+        }
+        count = std::min(count, pTokens->size() - Pos);
+        std::copy_n(pTokens->begin() + ptrdiff_t(Pos), count, ptokens);
+        Pos += count;
+        return count;
+    }
+
+private:
+    const std::vector<Token>* pTokens;
+    size_t                    Pos = 0u;
+};
+
+
+// *** ParallelTokenizer implementation
+
+// Tokenizes the run from its start until a token starts at or past the limit
+template <class Token>
+void ParallelTokenizer<Token>::ScanRun(Run& run, size_t limit, const PosTracker& startPos) const {
+    MemBufferInputStream stream{pData + run.Begin, Size - run.Begin};
+    DFATokenizer<Token>  tokenizer{pDFA, &stream};
+    tokenizer.SetStartPos(startPos);
+    tokenizer.SetExpressionState(run.Expression, std::vector<unsigned>(run.InitialDepth, 0u));
+
+    auto expression = run.Expression;
+    auto depth      = ptrdiff_t(0);
+    auto topFrame   = NoFrame;
+
+    // Updates the stack entries from lowDepth on
+    const auto updateStack = [&](const std::vector<unsigned>& stack, ptrdiff_t lowDepth) {
+        for (; depth > lowDepth; --depth)
+            topFrame = run.StackFrames[topFrame].Below;
+        for (; depth < ptrdiff_t(stack.size()); ++depth) {
+            run.StackFrames.push_back({stack[size_t(depth)], topFrame});
+            topFrame = run.StackFrames.size() - 1u;
+        }
+    };
+    updateStack(tokenizer.GetExpressionStack(), 0);
+    run.InitialTopFrame = topFrame;
+
+    for (auto offset = run.Begin; offset < limit;) {
+        auto& token = run.Tokens.emplace_back();
+        tokenizer.GetNextToken(token);
+        offset = GetTailOffset(tokenizer);
+        run.Ends.push_back(offset);
+        if (token.Code == TokenCode::TokenEOF) {
+            run.EOFFlag = true;
+            break;
+        }
+
+        // Record the expression state changes
+        const auto  lowDepth = tokenizer.TakeExpressionStackLowMark();
+        const auto& stack    = tokenizer.GetExpressionStack();
+        if (tokenizer.GetExpression() != expression || ptrdiff_t(stack.size()) != depth ||
+            lowDepth < depth) {
+            expression = tokenizer.GetExpression();
+            updateStack(stack, std::max(lowDepth, ptrdiff_t(0)));
+            run.Changes.push_back({run.Tokens.size() - 1u, expression, depth, lowDepth,
+                                   topFrame});
+        }
+    }
+
+    // The lowest depth from each change on
+    for (size_t i = run.Changes.size(); i > 1u; --i)
+        run.Changes[i - 2u].LowDepth = std::min(run.Changes[i - 2u].LowDepth,
+                                                run.Changes[i - 1u].LowDepth);
+
+    run.End             = run.Ends.empty() ? run.Begin : run.Ends.back();
+    run.FinalExpression = tokenizer.GetExpression();
+    run.FinalStack      = tokenizer.GetExpressionStack();
+    run.EndPos          = tokenizer.GetTokenEndPos();
+}
+
+
+// Looks for a convergence point with tokenizing from the given position and expression state
+template <class Token>
+bool ParallelTokenizer<Token>::FindConvergence(const Run& run, size_t end, unsigned expression,
+                                               const std::vector<unsigned>& stack,
+                                               size_t& cursor, Convergence& convergence) {
+    // The point is after the token ending at end, or at the run start
+    size_t first = 0u;
+    if (end != run.Begin) {
+        const auto iend = std::lower_bound(run.Ends.begin() + ptrdiff_t(cursor), run.Ends.end(),
+                                           end);
+        cursor = size_t(iend - run.Ends.begin());
+        if (iend == run.Ends.end() || *iend != end)
+            return false;
+        first = cursor + 1u;
+    }
+
+    // State of the run at the point
+    const auto ichange = std::lower_bound(run.Changes.begin(), run.Changes.end(), first,
+                                          [](const StateChange& change, size_t index) {
+                                              return change.Index < index;
+                                          });
+    auto runExpression = run.Expression;
+    auto runDepth      = ptrdiff_t(run.InitialDepth);
+    auto frame         = run.InitialTopFrame;
+    if (ichange != run.Changes.begin()) {
+        runExpression = std::prev(ichange)->Expression;
+        runDepth      = std::prev(ichange)->Depth;
+        frame         = std::prev(ichange)->TopFrame;
+    }
+    if (runExpression != expression)
+        return false;
+
+    // The stack entries the run pops later must be the same as the actual ones
+    const auto lowDepth = ichange != run.Changes.end() ? std::min(ichange->LowDepth, runDepth)
+                                                       : runDepth;
+    if (lowDepth < 0 || size_t(runDepth - lowDepth) > stack.size())
+        return false;
+    const auto popCount = size_t(runDepth - lowDepth);
+    for (auto istack = stack.rbegin(); istack != stack.rbegin() + ptrdiff_t(popCount); ++istack) {
+        if (run.StackFrames[frame].Expression != *istack)
+            return false;
+        frame = run.StackFrames[frame].Below;
+    }
+
+    convergence = {first, popCount, size_t(lowDepth)};
+    return true;
+}
+
+
+// Appends the tokens of the run from the convergence point
+template <class Token>
+void ParallelTokenizer<Token>::TakeRun(Run& run, const Convergence& convergence,
+                                       Frontier& frontier, std::vector<Token>& tokens) {
+    if (tokens.empty() && convergence.First == 0u)
+        tokens.swap(run.Tokens);
+    else
+        tokens.insert(tokens.end(),
+                      std::make_move_iterator(run.Tokens.begin() +
+                                              ptrdiff_t(convergence.First)),
+                      std::make_move_iterator(run.Tokens.end()));
+
+    // The run replaces the stack entries it popped with the ones it pushed
+    frontier.Stack.resize(frontier.Stack.size() - convergence.PopCount);
+    frontier.Stack.insert(frontier.Stack.end(),
+                          run.FinalStack.begin() + ptrdiff_t(convergence.KeepDepth),
+                          run.FinalStack.end());
+    frontier.End        = run.End;
+    frontier.Expression = run.FinalExpression;
+    frontier.EndPos     = run.EndPos;
+    frontier.EOFFlag    = run.EOFFlag;
+}
+
+
+// Tokenizes sequentially from the frontier, trying to converge with the runs after each token
+template <class Token>
+void ParallelTokenizer<Token>::ScanSequential(Frontier& frontier, size_t limit,
+                                              std::vector<Run>& runs,
+                                              std::vector<Token>& tokens) const {
+    MemBufferInputStream stream{pData + frontier.End, Size - frontier.End};
+    DFATokenizer<Token>  tokenizer{pDFA, &stream};
+    tokenizer.SetStartPos(frontier.EndPos);
+    tokenizer.SetExpressionState(frontier.Expression, frontier.Stack);
+
+    std::vector<size_t> cursors(runs.size(), 0u);
+
+    while (frontier.End < limit) {
+        auto& token = tokens.emplace_back();
+        tokenizer.GetNextToken(token);
+        if (token.Code == TokenCode::TokenEOF) {
+            frontier.EOFFlag = true;
+            return;
+        }
+        frontier.End = GetTailOffset(tokenizer);
+
+        for (size_t i = 0u; i < runs.size(); ++i) {
+            Convergence convergence;
+            if (FindConvergence(runs[i], frontier.End, tokenizer.GetExpression(),
+                                tokenizer.GetExpressionStack(), cursors[i], convergence)) {
+                frontier.Stack = tokenizer.GetExpressionStack();
+                TakeRun(runs[i], convergence, frontier, tokens);
+                return;
+            }
+        }
+    }
+
+    frontier.Expression = tokenizer.GetExpression();
+    frontier.Stack      = tokenizer.GetExpressionStack();
+    frontier.EndPos     = tokenizer.GetTokenEndPos();
+}
+
+
+// Tokenizes the data into an ordered vector of tokens ending with the EOF token
+template <class Token>
+void ParallelTokenizer<Token>::Tokenize(const char* pdata, size_t size,
+                                        std::vector<Token>& tokens, unsigned threadCount) {
+    SG_ASSERT(pDFA && pDFA->IsValid());
+
+    pData                = pdata;
+    Size                 = size;
+    SequentialChunkCount = 0u;
+    tokens.clear();
+
+    if (threadCount == 0u)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    const auto chunkCount      = std::max<size_t>(std::min<size_t>(threadCount,
+                                                                   size / MinChunkSize), 1u);
+    const auto expressionCount = pDFA->GetExpressionStartStateCount();
+
+    // Chunk boundaries and the positions tracked at them
+    // The last chunk ends past the data, so that it is tokenized up to EOF
+    std::vector<size_t>     bounds(chunkCount + 1u);
+    std::vector<PosTracker> startPos(chunkCount);
+    // Chunks never start within a UTF-8 character, in case the input is read as UTF-8
+    for (size_t i = 0u; i < chunkCount; ++i) {
+        bounds[i] = size / chunkCount * i;
+        while (bounds[i] != 0u && bounds[i] < size && (uint8_t(pdata[bounds[i]]) & 0xC0u) == 0x80u)
+            ++bounds[i];
+    }
+    bounds[chunkCount] = size + 1u;
+    for (size_t i = 1u; i < chunkCount; ++i) {
+        startPos[i] = startPos[i - 1u];
+        InputCharReader::AdvancePos(startPos[i], pdata + bounds[i - 1u], pdata + bounds[i]);
+    }
+
+    // The first chunk is tokenized only from the actual initial state
+    // Runs of each following chunk are stored after it in the expression order
+    std::vector<Run> runs(1u + (chunkCount - 1u) * expressionCount);
+    for (size_t i = 1u; i < runs.size(); ++i) {
+        runs[i].Begin        = bounds[1u + (i - 1u) / expressionCount];
+        runs[i].Expression   = unsigned((i - 1u) % expressionCount);
+        runs[i].InitialDepth = SpeculativeStackDepth;
+    }
+
+    // Tokenize the runs on the threads
+    std::atomic<size_t>             nextRun{0u};
+    std::vector<std::exception_ptr> errors(runs.size());
+
+    const auto scanRuns = [&]() {
+        for (auto i = nextRun++; i < runs.size(); i = nextRun++) {
+            const auto chunk = i == 0u ? 0u : 1u + (i - 1u) / expressionCount;
+            try {
+                ScanRun(runs[i], bounds[chunk + 1u], startPos[chunk]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+
+    // If a thread can't be started, the ones already running do the rest
+    std::vector<std::thread> threads;
+    for (size_t i = 1u; i < std::min<size_t>(threadCount, runs.size()); ++i) {
+        try {
+            threads.emplace_back(scanRuns);
+        } catch (const std::system_error&) {
+            break;
+        }
+    }
+    scanRuns();
+    for (auto& thread : threads)
+        thread.join();
+
+    for (const auto& error : errors)
+        if (error)
+            std::rethrow_exception(error);
+
+    // Stitch the chunks in order
+    Frontier frontier;
+    TakeRun(runs[0u], Convergence{}, frontier, tokens);
+
+    for (size_t chunk = 1u; chunk < chunkCount && !frontier.EOFFlag; ++chunk) {
+        const auto pchunkRuns = runs.begin() + ptrdiff_t(1u + (chunk - 1u) * expressionCount);
+        std::vector<Run> chunkRuns(std::make_move_iterator(pchunkRuns),
+                                   std::make_move_iterator(pchunkRuns +
+                                                           ptrdiff_t(expressionCount)));
+
+        // The run from the frontier expression is the most likely to converge at once
+        std::stable_partition(chunkRuns.begin(), chunkRuns.end(), [&](const Run& run) {
+            return run.Expression == frontier.Expression;
+        });
+
+        bool converged = false;
+        for (auto& run : chunkRuns) {
+            size_t      cursor = 0u;
+            Convergence convergence;
+            if (FindConvergence(run, frontier.End, frontier.Expression, frontier.Stack, cursor,
+                                convergence)) {
+                TakeRun(run, convergence, frontier, tokens);
+                converged = true;
+                break;
+            }
+        }
+
+        if (!converged) {
+            ++SequentialChunkCount;
+            ScanSequential(frontier, bounds[chunk + 1u], chunkRuns, tokens);
+        }
+    }
+
+    SG_ASSERT(frontier.EOFFlag);
+}
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_PARALLELTOKENIZER_H
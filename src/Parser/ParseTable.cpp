@@ -4,83 +4,48 @@
 
 #include "ParseTable.h"
 
+#include <algorithm>
+
 namespace SGParser
 {
 
 // ***** Parse Table class implementation
 
-// Creates a DFA using a static DFA structure
-// Parse table data is cleared before the creation and will remain
-// clear in case of exceptions (basic exception safety is provided)
-void ParseTable::Create(const StaticParseTable& staticTable) {
+// Creates a parse table using a static parse table structure
+// The static data is used in place, so it must outlive the parse table
+void ParseTable::Create(const StaticParseTable& staticTable) noexcept {
     // Free the existing data
     Destroy();
 
-    // Try to reserve needed space
-    ActionTable.reserve(staticTable.ActionHeight);
-    GotoTable.reserve(staticTable.GotoHeight);
-    ReduceProductions.reserve(staticTable.ProductionCount);
-    NonTerminals.reserve(staticTable.NonTerminalCount);
-    Terminals.reserve(staticTable.TerminalCount);
-    StateInfos.reserve(staticTable.StateInfoCount);
-
-    // Temporary container for swap-initialization of ProductionErrorTerminals
-    decltype(ProductionErrorTerminals) newProductionErrorTerminals;
-    // Initialize the temporary terminals container
-    for (size_t i = 0u; i < staticTable.ProductionErrorTerminalCount; ++i)
-        newProductionErrorTerminals[staticTable.pProductionErrorTerminals[i * 2u]] =
-            staticTable.pProductionErrorTerminals[i * 2u + 1u];
-
-    // From this point we can (safely) initialize the actual data
-
-    // Initialize the action table
-    auto actionTable = staticTable.pActionTable;
-    for (size_t i = 0u; i < staticTable.ActionHeight; ++i, actionTable += staticTable.ActionWidth)
-        ActionTable.push_back(actionTable);
-    ActionWidth = staticTable.ActionWidth;
-
-    // Initialize the goto table
-    auto gotoTable = staticTable.pGotoTable;
-    for (size_t i = 0u; i < staticTable.GotoHeight; ++i, gotoTable += staticTable.GotoWidth)
-        GotoTable.push_back(gotoTable);
-    GotoWidth = staticTable.GotoWidth;
-
-    // Initialize the reduce productions table
-    for (size_t i = 0u; i < staticTable.ProductionCount; ++i) {
-        ReduceProductions.emplace_back();
-        auto& reduceProduction             = ReduceProductions.back();
-        reduceProduction.Length            = staticTable.pReduceProductions[i * 4u];
-        reduceProduction.Left              = staticTable.pReduceProductions[i * 4u + 1u];
-        reduceProduction.NotReported       = staticTable.pReduceProductions[i * 4u + 2u];
-        reduceProduction.ErrorTerminalFlag = staticTable.pReduceProductions[i * 4u + 3u];
-    }
-
-    // Initialize the nonterminals
-    for (size_t i = 0u; i < staticTable.NonTerminalCount; ++i) {
-        NonTerminals.emplace_back();
-        NonTerminals.back().StartState = staticTable.pNonTerminals[i];
-    }
-
-    // Initialize the terminals
-    for (size_t i = 0u; i < staticTable.TerminalCount; ++i) {
-        Terminals.emplace_back();
-        Terminals.back().ErrorTerminal = staticTable.pTerminals[i];
-    }
-
-    // Initialize the terminals
-    for (size_t i = 0u; i < staticTable.StateInfoCount; ++i) {
-        StateInfos.emplace_back();
-        auto& stateInfo            = StateInfos.back();
-        stateInfo.Record           = staticTable.pStateInfos[i * 2u];
-        stateInfo.BacktrackOnError = staticTable.pStateInfos[i * 2u + 1u];
-    }
-
-    // Swap-initialize the terminals
-    ProductionErrorTerminals.swap(newProductionErrorTerminals);
+    SG_ASSERT(staticTable.ActionHeight == staticTable.GotoHeight);
+
+    pActionTable                 = staticTable.pActionTable;
+    pGotoTable                   = staticTable.pGotoTable;
+    pReduceProductions           = staticTable.pReduceProductions;
+    pNonTerminals                = staticTable.pNonTerminals;
+    pTerminals                   = staticTable.pTerminals;
+    pStateInfos                  = staticTable.pStateInfos;
+    pProductionErrorTerminals    = staticTable.pProductionErrorTerminals;
+    ActionPack                   = staticTable.ActionPack;
+    GotoPack                     = staticTable.GotoPack;
+    pWideActionTable             = staticTable.pWideActionTable;
+    pWideGotoTable               = staticTable.pWideGotoTable;
+    WideActionPack               = staticTable.WideActionPack;
+    WideGotoPack                 = staticTable.WideGotoPack;
+
+    StateCount                   = staticTable.ActionHeight;
+    ActionWidth                  = staticTable.ActionWidth;
+    GotoWidth                    = staticTable.GotoWidth;
+    ReduceProductionCount        = staticTable.ProductionCount;
+    NonTerminalCount             = staticTable.NonTerminalCount;
+    TerminalCount                = staticTable.TerminalCount;
+    StateInfoCount               = staticTable.StateInfoCount;
+    ProductionErrorTerminalCount = staticTable.ProductionErrorTerminalCount;
+
+    SelectLookups();
 
     // Assign the table type
     Type         = staticTable.Type;
-    StaticFlag   = true;
     InitialState = 0u;
 }
 
@@ -88,30 +53,121 @@ void ParseTable::Create(const StaticParseTable& staticTable) {
 // Destroys the parse table data
 void ParseTable::Destroy() noexcept {
     FreeTables();
+    ReduceProductions.clear();
     Terminals.clear();
     NonTerminals.clear();
     StateInfos.clear();
     ProductionErrorTerminals.clear();
+
+    pReduceProductions           = nullptr;
+    pNonTerminals                = nullptr;
+    pTerminals                   = nullptr;
+    pStateInfos                  = nullptr;
+    pProductionErrorTerminals    = nullptr;
+
+    ReduceProductionCount        = 0u;
+    NonTerminalCount             = 0u;
+    TerminalCount                = 0u;
+    StateInfoCount               = 0u;
+    ProductionErrorTerminalCount = 0u;
+
     Type         = ParseTableType::None;
     InitialState = InvalidState;
 }
 
 
+// Returns the error terminal for a production, or InvalidState for none
+unsigned ParseTable::GetProductionErrorTerminal(unsigned production,
+                                                unsigned left) const noexcept {
+    const auto key  = GetProductionErrorKey(production, left);
+    const auto pend = pProductionErrorTerminals + ProductionErrorTerminalCount;
+    const auto it   = std::lower_bound(pProductionErrorTerminals, pend, key,
+                                       [](const ProductionErrorTerminal& entry, uint64_t value) {
+                                           return entry.Production < value;
+                                       });
+    return it != pend && it->Production == key ? unsigned(it->ErrorTerminal) : InvalidState;
+}
+
+
+// Returns the size of the action and goto tables in bytes, with the given entry size
+size_t ParseTable::GetTableSize(size_t entrySize) const noexcept {
+    const auto packSize = [entrySize](size_t entryCount, size_t rowCount, size_t columnCount) {
+        return columnCount * sizeof(uint16_t) + rowCount * (entrySize + sizeof(uint32_t)) +
+               entryCount * (entrySize + sizeof(uint16_t));
+    };
+    if (!IsCompressed())
+        return StateCount * (ActionWidth + GotoWidth) * entrySize;
+    return IsWide() ? packSize(WideActionPack.EntryCount, StateCount, ActionWidth) +
+                          packSize(WideGotoPack.EntryCount, GotoWidth, StateCount)
+                    : packSize(ActionPack.EntryCount, StateCount, ActionWidth) +
+                          packSize(GotoPack.EntryCount, GotoWidth, StateCount);
+}
+
+
+// Points the parser tables to the owned tables, which have 32-bit entries
+// The dense tables are used, unless they were compressed
+void ParseTable::AttachOwnedTables() noexcept {
+    const auto compressed        = ActionTable.empty() && !ActionPackData.Defaults.empty();
+    pActionTable                 = nullptr;
+    pGotoTable                   = nullptr;
+    ActionPack                   = {};
+    GotoPack                     = {};
+    pWideActionTable             = compressed ? nullptr : ActionTable.data();
+    pWideGotoTable               = compressed ? nullptr : GotoTable.data();
+    WideActionPack               = ActionPackData.Attach();
+    WideGotoPack                 = GotoPackData.Attach();
+    pReduceProductions           = ReduceProductions.data();
+    pNonTerminals                = NonTerminals.data();
+    pTerminals                   = Terminals.data();
+    pStateInfos                  = StateInfos.data();
+    pProductionErrorTerminals    = ProductionErrorTerminals.data();
+
+    StateCount                   = compressed        ? ActionPackData.Defaults.size()
+                                 : ActionWidth != 0u ? ActionTable.size() / ActionWidth : 0u;
+    ReduceProductionCount        = ReduceProductions.size();
+    NonTerminalCount             = NonTerminals.size();
+    TerminalCount                = Terminals.size();
+    StateInfoCount               = StateInfos.size();
+    ProductionErrorTerminalCount = ProductionErrorTerminals.size();
+
+    SelectLookups();
+}
+
+
 void ParseTable::FreeTables() noexcept {
-    // Free the action table if we own it
-    if (!StaticFlag && !ActionTable.empty())
-        delete[] ActionTable[0u];
     ActionTable.clear();
-
-    // Free the goto table if we own it
-    if (!StaticFlag && !GotoTable.empty())
-        delete[] GotoTable[0u];
     GotoTable.clear();
+    ActionPackData   = {};
+    GotoPackData     = {};
+    pActionTable     = nullptr;
+    pGotoTable       = nullptr;
+    ActionPack       = {};
+    GotoPack         = {};
+    pWideActionTable = nullptr;
+    pWideGotoTable   = nullptr;
+    WideActionPack   = {};
+    WideGotoPack     = {};
+    pActionLookup    = nullptr;
+    pGotoLookup      = nullptr;
 
     // Reset data
+    StateCount   = 0u;
     ActionWidth  = 0u;
     GotoWidth    = 0u;
-    StaticFlag   = false;
+}
+
+
+// Selects the lookups for the form of the tables used
+// Only one of the dense, packed, narrow and wide forms is set
+void ParseTable::SelectLookups() noexcept {
+    pActionLookup = pActionTable            ? LookupNarrowAction
+                  : pWideActionTable        ? LookupWideAction
+                  : ActionPack.pEntries     ? LookupNarrowPackedAction
+                                            : LookupWidePackedAction;
+    pGotoLookup   = pGotoTable              ? LookupNarrowGoto
+                  : pWideGotoTable          ? LookupWideGoto
+                  : GotoPack.pEntries       ? LookupNarrowPackedGoto
+                                            : LookupWidePackedGoto;
 }
 
 } // namespace SGParser
@@ -9,7 +9,6 @@
 #include "ParseTableType.h"
 
 #include <cstdint>
-#include <unordered_map>
 #include <vector>
 
 namespace SGParser
@@ -26,16 +25,31 @@ public:
     // returned by GetAction in order to determine what to do next
     enum ActionMask : unsigned
     {
-        ShiftMask   = 0x0000'8000,
-        ReduceMask  = 0x0000'4000,
+        ShiftMask   = 0x8000'0000,
+        ReduceMask  = 0x4000'0000,
         // Accept value, special case of reduce
-        AcceptValue = 0x0000'4FFF,
+        AcceptValue = 0x4FFF'FFFF,
         // Any of above
-        ActionMask  = 0x0000'C000,
+        ActionMask  = 0xC000'0000,
 
         // Mask used to extract a state to go to
         // or a production to reduce by
-        ExtractMask = 0x0000'3FFF
+        ExtractMask = 0x3FFF'FFFF
+    };
+
+    // Masks of the 16-bit action table entries
+    // The tables have 16-bit entries if all the states and the productions fit them, and
+    // 32-bit entries (with the masks above) otherwise. GetAction converts the 16-bit entries
+    enum NarrowActionMask : unsigned
+    {
+        NarrowShiftMask   = 0x8000,
+        NarrowReduceMask  = 0x4000,
+        NarrowAcceptValue = 0x4FFF,
+        NarrowActionMask  = 0xC000,
+        NarrowExtractMask = 0x3FFF,
+
+        // Empty 16-bit goto table entry
+        NarrowEmptyGoto   = 0xFFFF
     };
 
     // Concise array of productions
@@ -57,7 +71,7 @@ public:
     struct NonTerminal final
     {
         // Start state if we can start with this nonterminal, -1 otherwise
-        uint16_t StartState;
+        uint32_t StartState;
     };
 
     // Structure for every terminal
@@ -71,22 +85,72 @@ public:
     struct StateInfo final
     {
         // Record flag
-        uint8_t Record             : 1;
+        uint8_t  Record            : 1;
         // Whether to backtrack on error in this state
-        uint8_t BacktrackOnError   : 1;
+        uint8_t  BacktrackOnError  : 1;
+        // Reduce action taken in this state without reading the lookahead, 0 for none
+        // Set only if the table was generated with default reductions (sgyacc -pt +defaultreduce),
+        // for the states whose only action is a single reduce; the lookahead (GetLastToken)
+        // is stale in the reductions done by it
+        uint32_t DefaultReduce;
     };
 
+    // Error terminal thrown by a reduce production
+    struct ProductionErrorTerminal final
+    {
+        // Production id | (Nonterminal << 32) (see GetProductionErrorKey)
+        uint64_t Production;
+        uint32_t ErrorTerminal;
+    };
+
+    // Returns the key of a production reduced to a nonterminal in the production error terminals
+    // Both are stored at full width, so that the keys stay distinct past 16-bit ids
+    static constexpr uint64_t GetProductionErrorKey(unsigned production, unsigned left) noexcept {
+        return uint64_t(left) << 32u | production;
+    }
+
+    // Table packed by row displacement, used for the compressed action and goto tables
+    // The columns with identical entries in all the rows share a class, the most common entry
+    // of every row is its default, and the rest of the entries of all the rows are stored
+    // interleaved in one array, each one with its class for the check. The rows with distinct
+    // entries have distinct offsets, so an entry passes the check only for its own row (and
+    // for the rows identical to it, which share the entries)
+    // Every row offset leaves room for all the classes, so the lookup is never out of bounds
+    // The goto table is packed transposed, with a row for every nonterminal
+    template <class Entry>
+    struct BasicPackedTable final
+    {
+        size_t          EntryCount;
+        const uint16_t* pColumnClasses;    // class of every column
+        const Entry*    pDefaults;         // default entry of every row
+        const uint32_t* pRowOffsets;       // offset of every row in the entries
+        const Entry*    pEntries;
+        const uint16_t* pCheckClasses;     // class of every entry, 0xFFFF for the unused ones
+
+        // Returns the entry, without any branches
+        Entry Get(unsigned row, unsigned column) const {
+            const auto columnClass = pColumnClasses[column];
+            const auto index       = pRowOffsets[row] + columnClass;
+            return pCheckClasses[index] == columnClass ? pEntries[index] : pDefaults[row];
+        }
+    };
+
+    using PackedTable     = BasicPackedTable<uint16_t>;
+    using WidePackedTable = BasicPackedTable<uint32_t>;
+
     // Const for invalid state representation
     static constexpr unsigned InvalidState = unsigned(-1);
 
 public:
-    // *** Constructors & destructor
+    // *** Constructors
 
     // Make an empty parse table
     ParseTable() = default;
 
-    // Creates a DFA using a static DFA structure
-    explicit ParseTable(const struct StaticParseTable& staticTable) { Create(staticTable); }
+    // Creates a parse table using a static parse table structure
+    explicit ParseTable(const struct StaticParseTable& staticTable) noexcept {
+        Create(staticTable);
+    }
 
     // No copy/move allowed
     ParseTable(const ParseTable&)                = delete;
@@ -94,13 +158,10 @@ public:
     ParseTable& operator=(const ParseTable&)     = delete;
     ParseTable& operator=(ParseTable&&) noexcept = delete;
 
-    // Destructor
-    ~ParseTable() { Destroy(); }
-
-    // Creates a DFA using a static DFA structure
-    // Parse table data is cleared before the creation and will remain
-    // clear in case of exceptions (basic exception safety is provided)
-    void Create(const StaticParseTable& staticTable);
+    // Creates a parse table using a static parse table structure
+    // The static data is used in place (nothing is copied or allocated),
+    // so it must outlive the parse table
+    void Create(const StaticParseTable& staticTable) noexcept;
 
     // Destroys the parse table data
     void Destroy() noexcept;
@@ -116,56 +177,74 @@ public:
     // Get state from action table
     // Have to apply ActionMasks to figure out what to do
     unsigned GetAction(unsigned state, unsigned terminal) const {
-        SG_ASSERT(state < ActionTable.size() && terminal < ActionWidth);
-        return unsigned(int16_t(ActionTable[state][terminal]));
+        SG_ASSERT(state < StateCount && terminal < ActionWidth);
+        return pActionLookup(*this, state, terminal);
     }
 
     // Information
-    size_t GetStateCount() const noexcept       { return ActionTable.size(); }
+    size_t GetStateCount() const noexcept       { return StateCount; }
     size_t GetTerminalCount() const noexcept    { return ActionWidth; }
     size_t GetNonTerminalCount() const noexcept { return GotoWidth; }
 
+    // Return whether the action and goto tables are compressed (packed)
+    bool   IsCompressed() const noexcept {
+        return pActionTable == nullptr && pWideActionTable == nullptr;
+    }
+    // Return whether the action and goto tables have 32-bit entries
+    bool   IsWide() const noexcept {
+        return pWideActionTable != nullptr || WideActionPack.pEntries != nullptr;
+    }
+    // Returns the size of the action and goto tables in bytes
+    size_t GetTableSize() const noexcept {
+        return GetTableSize(IsWide() ? sizeof(uint32_t) : sizeof(uint16_t));
+    }
+
     // Handling Reduce
     // Have to mask out action with ExtractMask !!!
 
     // Get new parser state after reduce
     unsigned GetReduceState(unsigned state, unsigned action) const {
-        SG_ASSERT(state < GotoTable.size() &&
-                  action < ReduceProductions.size() &&
-                  ReduceProductions[action].Left < GotoWidth);
-        return unsigned(int16_t(GotoTable[state][ReduceProductions[action].Left]));
+        SG_ASSERT(action < ReduceProductionCount);
+        return GetLeftReduceState(state, pReduceProductions[action].Left);
     }
 
     unsigned GetLeftReduceState(unsigned state, unsigned left) const {
-        SG_ASSERT(state < GotoTable.size() && left < GotoWidth);
-        return unsigned(int16_t(GotoTable[state][left]));
+        SG_ASSERT(state < StateCount && left < GotoWidth);
+        return pGotoLookup(*this, state, left);
     }
 
     // Get number of symbols to pop off stack on reduce by certain action
     unsigned GetReduceActionPopSize(unsigned action) const {
-        SG_ASSERT(action < ReduceProductions.size());
-        return unsigned(ReduceProductions[action].Length);
+        SG_ASSERT(action < ReduceProductionCount);
+        return unsigned(pReduceProductions[action].Length);
     }
 
     ReduceProduction GetReduceProduction(unsigned prodId) const {
-        SG_ASSERT(prodId < ReduceProductions.size());
-        return ReduceProductions[prodId];
+        SG_ASSERT(prodId < ReduceProductionCount);
+        return pReduceProductions[prodId];
     }
 
     // Returns start state given a nonterminal, or -1 for none
     unsigned GetStartState(unsigned nonTerminal) const {
-        return nonTerminal < NonTerminals.size()
-                   ? unsigned(NonTerminals[nonTerminal].StartState)
+        return nonTerminal < NonTerminalCount
+                   ? unsigned(pNonTerminals[nonTerminal].StartState)
                    : InvalidState;
     }
 
     // Information about our symbols & states
-    std::vector<NonTerminal> NonTerminals;
-    std::vector<Terminal>    Terminals;
-    std::vector<StateInfo>   StateInfos;
-    // Map from (prodId | Nonterminal<<16)  to ErrorTerminal, if any
+    const Terminal&  GetTerminal(unsigned terminal) const {
+        SG_ASSERT(terminal < TerminalCount);
+        return pTerminals[terminal];
+    }
+
+    const StateInfo& GetStateInfo(unsigned state) const {
+        SG_ASSERT(state < StateInfoCount);
+        return pStateInfos[state];
+    }
+
+    // Returns the error terminal for the production reduced to the nonterminal, or -1 for none
     // Should be checked if ErrorTerminal flag in ReduceProduction is set
-    std::unordered_map<unsigned, unsigned> ProductionErrorTerminals;
+    unsigned GetProductionErrorTerminal(unsigned production, unsigned left) const noexcept;
 
 protected:
     // Type of table (LR, LALR, CLR)
@@ -173,60 +252,173 @@ protected:
     // State to start parsing with
     unsigned  InitialState = InvalidState;
 
-    // Action Table
-    // A vector of pointers to arrays of uint16_t which ... [state][terminal]
-    // Pointers inside the vector are owning only when StaticFlag == false
-    size_t    ActionWidth  = 0u;
-    std::vector<uint16_t*> ActionTable;
+    // *** Tables used by the parser
+    // They point either to the owned tables below, or directly to the static parse table data
+
+    // Action table [state][terminal], ActionWidth entries per state
+    // nullptr if the table is compressed into the action pack
+    const uint16_t*                pActionTable              = nullptr;
+    // Goto table [state][nonterminal], GotoWidth entries per state
+    // nullptr if the table is compressed into the goto pack
+    const uint16_t*                pGotoTable                = nullptr;
+    PackedTable                    ActionPack                = {};
+    PackedTable                    GotoPack                  = {};
+    // The same tables with 32-bit entries; only one of the four forms is used
+    const uint32_t*                pWideActionTable          = nullptr;
+    const uint32_t*                pWideGotoTable            = nullptr;
+    WidePackedTable                WideActionPack            = {};
+    WidePackedTable                WideGotoPack              = {};
+    // Lookups in the form of the tables used, selected once the tables are set,
+    // so that GetAction and GetLeftReduceState don't test the form on every call
+    using Lookup = unsigned (*)(const ParseTable&, unsigned state, unsigned symbol);
+    Lookup                         pActionLookup             = nullptr;
+    Lookup                         pGotoLookup               = nullptr;
+    // This array is consulted on reduce action
+    const ReduceProduction*        pReduceProductions        = nullptr;
+    const NonTerminal*             pNonTerminals             = nullptr;
+    const Terminal*                pTerminals                = nullptr;
+    const StateInfo*               pStateInfos               = nullptr;
+    // Sorted by the production
+    const ProductionErrorTerminal* pProductionErrorTerminals = nullptr;
+
+    size_t StateCount                   = 0u;
+    size_t ActionWidth                  = 0u;
+    size_t GotoWidth                    = 0u;
+    size_t ReduceProductionCount        = 0u;
+    size_t NonTerminalCount             = 0u;
+    size_t TerminalCount                = 0u;
+    size_t StateInfoCount               = 0u;
+    size_t ProductionErrorTerminalCount = 0u;
+
+    // *** Owned tables, used by the generated parse tables
+    // These always have 32-bit entries; the narrow ones are only emitted as static data
+
+    // Packed table data
+    struct PackedTableData final
+    {
+        std::vector<uint16_t> ColumnClasses;
+        std::vector<uint32_t> Defaults;
+        std::vector<uint32_t> RowOffsets;
+        std::vector<uint32_t> Entries;
+        std::vector<uint16_t> CheckClasses;
+
+        WidePackedTable Attach() const noexcept {
+            return {Entries.size(), ColumnClasses.data(), Defaults.data(), RowOffsets.data(),
+                    Entries.data(), CheckClasses.data()};
+        }
+    };
 
-    // Goto Table
-    // A vector of pointers to arrays of uint16_t which ... [state][nonterminal]
-    // Pointers inside the vector are owning only when StaticFlag == false
-    size_t    GotoWidth    = 0u;
-    std::vector<uint16_t*> GotoTable;
+    std::vector<uint32_t>                ActionTable;
+    std::vector<uint32_t>                GotoTable;
+    PackedTableData                      ActionPackData;
+    PackedTableData                      GotoPackData;
+    std::vector<ReduceProduction>        ReduceProductions;
+    std::vector<NonTerminal>             NonTerminals;
+    std::vector<Terminal>                Terminals;
+    std::vector<StateInfo>               StateInfos;
+    std::vector<ProductionErrorTerminal> ProductionErrorTerminals;
 
-    // Current static state
-    // If true than the parse table is using static data
-    bool      StaticFlag   = false;
-
-    // This array is consulted on reduce action
-    std::vector<ReduceProduction> ReduceProductions;
+    // Points the parser tables to the owned tables
+    // Must be called after the owned tables are modified
+    void AttachOwnedTables() noexcept;
 
     // Frees tables
     void FreeTables() noexcept;
+
+    // Selects the lookups for the form of the tables used
+    void SelectLookups() noexcept;
+
+    // Returns the size of the action and goto tables in bytes, with the given entry size
+    size_t GetTableSize(size_t entrySize) const noexcept;
+
+    // Convert the 16-bit action and goto table entries to the 32-bit ones
+    static unsigned WidenAction(unsigned entry) noexcept {
+        return entry == NarrowAcceptValue
+                   ? unsigned(AcceptValue)
+                   : (entry & NarrowActionMask) << 16u | (entry & NarrowExtractMask);
+    }
+
+    static unsigned WidenGoto(unsigned entry) noexcept {
+        return entry == NarrowEmptyGoto ? InvalidState : entry;
+    }
+
+    // Lookups in every form of the tables
+    static unsigned LookupNarrowAction(const ParseTable& table, unsigned state, unsigned terminal) {
+        return WidenAction(table.pActionTable[state * table.ActionWidth + terminal]);
+    }
+
+    static unsigned LookupWideAction(const ParseTable& table, unsigned state, unsigned terminal) {
+        return table.pWideActionTable[state * table.ActionWidth + terminal];
+    }
+
+    static unsigned LookupNarrowPackedAction(const ParseTable& table, unsigned state,
+                                             unsigned terminal) {
+        return WidenAction(table.ActionPack.Get(state, terminal));
+    }
+
+    static unsigned LookupWidePackedAction(const ParseTable& table, unsigned state,
+                                           unsigned terminal) {
+        return table.WideActionPack.Get(state, terminal);
+    }
+
+    static unsigned LookupNarrowGoto(const ParseTable& table, unsigned state, unsigned left) {
+        return WidenGoto(table.pGotoTable[state * table.GotoWidth + left]);
+    }
+
+    static unsigned LookupWideGoto(const ParseTable& table, unsigned state, unsigned left) {
+        return table.pWideGotoTable[state * table.GotoWidth + left];
+    }
+
+    static unsigned LookupNarrowPackedGoto(const ParseTable& table, unsigned state, unsigned left) {
+        return WidenGoto(table.GotoPack.Get(left, state));
+    }
+
+    static unsigned LookupWidePackedGoto(const ParseTable& table, unsigned state, unsigned left) {
+        return table.WideGotoPack.Get(left, state);
+    }
 };
 
 
 // *** Static Parse table
 
 // Used for hard-coded parse table
+// The parse table created from this structure references the data directly, without copying it
 struct StaticParseTable final
 {
     // Parse table type
     ParseTableType Type;
     // Action table data
-    size_t    ActionHeight;
-    size_t    ActionWidth;
-    uint16_t* pActionTable;
+    size_t                                     ActionHeight;
+    size_t                                     ActionWidth;
+    const uint16_t*                            pActionTable;
     // Goto table data
-    size_t    GotoHeight;
-    size_t    GotoWidth;
-    uint16_t* pGotoTable;
+    size_t                                     GotoHeight;
+    size_t                                     GotoWidth;
+    const uint16_t*                            pGotoTable;
     // Reduce production list
-    size_t    ProductionCount;
-    uint32_t* pReduceProductions;
+    size_t                                     ProductionCount;
+    const ParseTable::ReduceProduction*        pReduceProductions;
     // Information about our symbols & states
-    size_t    NonTerminalCount;
-    uint16_t* pNonTerminals;
-
-    size_t    TerminalCount;
-    uint8_t*  pTerminals;
-
-    size_t    StateInfoCount;
-    uint8_t*  pStateInfos;
-    // Production error terminal count
-    size_t    ProductionErrorTerminalCount;
-    uint32_t* pProductionErrorTerminals;
+    size_t                                     NonTerminalCount;
+    const ParseTable::NonTerminal*             pNonTerminals;
+
+    size_t                                     TerminalCount;
+    const ParseTable::Terminal*                pTerminals;
+
+    size_t                                     StateInfoCount;
+    const ParseTable::StateInfo*               pStateInfos;
+    // Production error terminals, sorted by the production
+    size_t                                     ProductionErrorTerminalCount;
+    const ParseTable::ProductionErrorTerminal* pProductionErrorTerminals;
+    // Compressed action and goto tables, used if the dense tables are nullptr
+    ParseTable::PackedTable                    ActionPack;
+    ParseTable::PackedTable                    GotoPack;
+    // Action and goto tables with 32-bit entries, used instead of all the above if the
+    // states or the productions don't fit 16-bit entries
+    const uint32_t*                            pWideActionTable;
+    const uint32_t*                            pWideGotoTable;
+    ParseTable::WidePackedTable                WideActionPack;
+    ParseTable::WidePackedTable                WideGotoPack;
 };
 
 } // namespace SGParser
@@ -12,6 +12,9 @@
 
 #include <type_traits>
 #include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace SGParser
 {
@@ -79,6 +82,71 @@ struct ParseStackGenericElement final : public ParseStackElement<GenericToken>
 };
 
 
+// View parse stack entry
+// Stores the byte range of the token in the input instead of the token string
+struct ParseStackViewElement final : public ParseStackElement<ViewToken>
+{
+    // User-defined data
+    size_t Offset = 0u;
+    size_t Length = 0u;
+
+    using ParseStackElement::SetErrorData;
+    using ParseStackElement::Cleanup;
+
+    // Redefined function to store token data
+    void ShiftToken(TokenType& tok, [[maybe_unused]] TokenStream<TokenType>& stream) {
+        Offset = tok.Offset;
+        Length = tok.Length;
+    }
+};
+
+
+// ***** Parse Stack
+
+// Parse stack storage, allocated in segments as the stack grows
+// Segments are never moved, so the elements stay in place as more segments are added
+template <class StackElement>
+class ParseStack final
+{
+public:
+    // Number of elements in a segment
+    static constexpr size_t SegmentSize = 256u;
+
+public:
+    // Creates an empty stack (with no elements)
+    ParseStack() = default;
+
+    // No copy allowed
+    ParseStack(const ParseStack&)                = delete;
+    ParseStack(ParseStack&&) noexcept            = default;
+    ParseStack& operator=(const ParseStack&)     = delete;
+    ParseStack& operator=(ParseStack&&) noexcept = default;
+
+    // Return the number of elements allocated
+    size_t GetCapacity() const noexcept { return Segments.size() * SegmentSize; }
+
+    // Adds a segment of elements
+    // Strong exception safety is provided
+    void   Grow() {
+        std::unique_ptr<StackElement[]> pnewSegment{new StackElement[SegmentSize]};
+        Segments.push_back(std::move(pnewSegment));
+    }
+
+    StackElement&       operator[](size_t index) {
+        SG_ASSERT(index < GetCapacity());
+        return Segments[index / SegmentSize][index % SegmentSize];
+    }
+
+    const StackElement& operator[](size_t index) const {
+        SG_ASSERT(index < GetCapacity());
+        return Segments[index / SegmentSize][index % SegmentSize];
+    }
+
+private:
+    std::vector<std::unique_ptr<StackElement[]>> Segments;
+};
+
+
 // ***** Parse Callback
 
 // Forward declaration
@@ -112,14 +180,15 @@ public:
     // *** Constructors & destructor
 
     // Create parser, and set its parse table
-    explicit Parse(const ParseTable* ptable = nullptr, size_t stackSize = DefaultStackSize) {
-        Create(ptable, stackSize);
+    explicit Parse(const ParseTable* ptable = nullptr,
+                   size_t maxStackSize = DefaultMaxStackSize) {
+        Create(ptable, maxStackSize);
     }
 
     // Create & initialize parser
     Parse(const ParseTable* ptable, TokenStream<TokenType>* ptokenStream,
-          size_t stackSize = DefaultStackSize) {
-        Create(ptable, ptokenStream, stackSize);
+          size_t maxStackSize = DefaultMaxStackSize) {
+        Create(ptable, ptokenStream, maxStackSize);
     }
 
     // No copy/move allowed
@@ -133,11 +202,14 @@ public:
         Destroy();
     }
 
+    // The parse stack starts with a single segment (see ParseStack) and grows as needed,
+    // up to maxStackSize elements; deeper input fails the parse (see IsStackOverflow)
+
     // Create and set the parse table (no tokenizer)
-    bool Create(const ParseTable* ptable, size_t stackSize = DefaultStackSize);
+    bool Create(const ParseTable* ptable, size_t maxStackSize = DefaultMaxStackSize);
     // Create and initialize the parser
     bool Create(const ParseTable* ptable, TokenStream<TokenType>* ptokenStream,
-                size_t stackSize = DefaultStackSize);
+                size_t maxStackSize = DefaultMaxStackSize);
     // Destroy the parser data
     void Destroy();
 
@@ -186,7 +258,7 @@ public:
     // One greater than max allowed index in (*this)[n]
     // Result varies during parsing (since StackPosition varies).
     IndexType GetMaxAllowedIndex() const noexcept {
-        return IndexType(StackSize - StackPosition);
+        return IndexType(Stack.GetCapacity() - StackPosition);
     }
 
     // On reduce, this can be used to access production directly
@@ -195,18 +267,18 @@ public:
     StackElement&       operator[](IndexType index) {
         SG_ASSERT(-index <= IndexType(StackPosition));
         SG_ASSERT(index < GetMaxAllowedIndex());
-        return pStack[StackPosition + index];
+        return Stack[size_t(IndexType(StackPosition) + index)];
     }
 
     const StackElement& operator[](IndexType index) const {
         SG_ASSERT(-index <= IndexType(StackPosition));
         SG_ASSERT(index < GetMaxAllowedIndex());
-        return pStack[StackPosition + index];
+        return Stack[size_t(IndexType(StackPosition) + index)];
     }
 
     // One greater than max allowed index in (*this)[n]
     // Result varies during parsing (since StackPosition varies)
-    size_t size() const noexcept { return StackSize - StackPosition; }
+    size_t size() const noexcept { return Stack.GetCapacity() - StackPosition; }
 
     // *** Debugging functions
 
@@ -216,12 +288,14 @@ public:
     const TokenType& GetLastToken() const noexcept        { return Token; }
     int              GetLastErrorState() const noexcept   { return LastErrorState; }
     const String&    GetErrorStackString() const noexcept { return ErrorStackStr; }
+    // Return true if the parse failed because the stack reached its maximal size
+    bool             IsStackOverflow() const noexcept     { return StackOverflow; }
 
 private:
-    // Default stack size
-    static constexpr size_t   DefaultStackSize = 2048u;
-    // Min stack size
-    static constexpr size_t   MinStackSize     = 128u;
+    // Default stack size limit
+    static constexpr size_t   DefaultMaxStackSize = 1u << 20u;
+    // Min stack size limit
+    static constexpr size_t   MinStackSize        = 128u;
 
     // Invalid marker const
     static constexpr size_t   InvalidIndex     = BacktrackingTokenStream<TokenType>::InvalidIndex;
@@ -242,15 +316,17 @@ private:
     // Current stack pointer (starts at 0)
     size_t        StackPosition  = 0u;
     // Parser Stack (don't save in ExtractParserState)
-    size_t        StackSize      = 0u;
-    StackElement* pStack         = nullptr;
+    size_t        MaxStackSize   = 0u;
+    ParseStack<StackElement> Stack;
+    // Set if the stack reached its maximal size
+    bool          StackOverflow  = false;
 
     // *** Runtime variables
 
     // Value to store on top of stack on next ParseStep callback
     // Note: TopState == InvalidState means the parser is not initialized properly
     unsigned      TopState       = InvalidState;
-    // Set if next token should be obtained
+    // Set if next token should be obtained (not read after shifting to a default reduction)
     bool          NextTokenFlag  = false;
     // Previous position of error (stored so that we can see if the input was advanced)
     size_t        PrevTokenIndex = InvalidIndex;
@@ -270,23 +346,27 @@ private:
 
     TokenType& GetNextToken(TokenType& token) { return Stream.GetNextToken(token); }
     bool       AdvancedInput() const noexcept { return Stream.GetTokenIndex() > PrevTokenIndex; }
+
+    // Makes room for an element above the stack top, adding a stack segment if needed
+    // Returns false (setting StackOverflow) if the stack is at its maximal size
+    bool       GrowStack();
 };
 
 // *** Initialization
 
 // Create and set the parse table (no tokenizer)
 template <class StackElement>
-bool Parse<StackElement>::Create(const ParseTable* ptable, size_t stackSize) {
+bool Parse<StackElement>::Create(const ParseTable* ptable, size_t maxStackSize) {
     // Make sure the parsing process is not started
     // IsValid() is reversed in this context: `this` is valid for Create
     // only if IsValid() is false
     if (IsValid())
         return false;
 
-    // Allocate stack
+    // Allocate the first stack segment
     // Basic exception safety is provided
-    const auto newStackSize = std::max(MinStackSize, stackSize);
-    auto       newStack     = new StackElement[newStackSize];
+    ParseStack<StackElement> newStack;
+    newStack.Grow();
 
     // From this point we can (safely) initialize the actual data
 
@@ -298,8 +378,8 @@ bool Parse<StackElement>::Create(const ParseTable* ptable, size_t stackSize) {
     ErrorMarker = InvalidIndex;
 
     // If new stack allocation is successful then modify the existing stack
-    delete[] std::exchange(pStack, newStack);
-    StackSize     = newStackSize;
+    Stack         = std::move(newStack);
+    MaxStackSize  = std::max(MinStackSize, maxStackSize);
     StackPosition = 0u;
 
     return true;
@@ -308,9 +388,9 @@ bool Parse<StackElement>::Create(const ParseTable* ptable, size_t stackSize) {
 // Create and initialize the parser
 template <class StackElement>
 bool Parse<StackElement>::Create(const ParseTable* ptable, TokenStream<TokenType>* ptokenStream,
-                                 size_t stackSize) {
+                                 size_t maxStackSize) {
     // Create and set the parse table (no tokenizer)
-    if (!Create(ptable, stackSize))
+    if (!Create(ptable, maxStackSize))
         return false;
 
     // And set tokenizer
@@ -325,7 +405,7 @@ void Parse<StackElement>::Destroy() {
     // Delete the parse stack
     CleanupParseStack();
 
-    delete[] std::exchange(pStack, nullptr);
+    Stack = ParseStack<StackElement>{};
     delete[] std::exchange(pValidTokenStackPositions, nullptr);
 
     TopState = InvalidState;
@@ -354,7 +434,8 @@ template <class StackElement>
 void Parse<StackElement>::ResetParse() {
     // Token set might have been a different size so it must be reallocated
     // Basic exception safety is provided
-    size_t* newValidTokenSet = pParseTable && pParseTable->IsValid()
+    // It's only used (and kept) if the parser is reinitialized below
+    size_t* newValidTokenSet = pParseTable && pTokenizer && pParseTable->IsValid()
                                    ? new size_t[pParseTable->GetTerminalCount()]
                                    : nullptr;
 
@@ -366,27 +447,28 @@ void Parse<StackElement>::ResetParse() {
 
     // Reset the data
     StackPosition  = 0u;
+    StackOverflow  = false;
     PrevTokenIndex = Stream.GetTokenIndex();
 
     // If the parse table and tokenizer are valid then reinitialize the data
     if (pParseTable && pTokenizer && pParseTable->IsValid()) {
         // Set the top and stack state to the initial parse table state
         TopState         = pParseTable->GetInitialState();
-        pStack[0u].State = TopState;
+        Stack[0u].State  = TopState;
         SG_ASSERT(TopState != InvalidState);
 
         // If the state is recording then initialize the terminal marker
-        if (pParseTable->StateInfos[TopState].Record)
-            Stream.SetMarker(pStack[0u].TerminalMarker = Stream.GetTokenIndex());
+        if (pParseTable->GetStateInfo(TopState).Record)
+            Stream.SetMarker(Stack[0u].TerminalMarker = Stream.GetTokenIndex());
         else
-            pStack[0u].TerminalMarker = InvalidIndex;
+            Stack[0u].TerminalMarker = InvalidIndex;
 
         delete[] std::exchange(pValidTokenStackPositions, newValidTokenSet);
     }
     // Otherwise, set them to empty
     else {
         TopState         = InvalidState;
-        pStack[0u].State = InvalidState;
+        Stack[0u].State  = InvalidState;
     }
 
     NextTokenFlag = true;
@@ -397,9 +479,9 @@ template <class StackElement>
 void Parse<StackElement>::CleanupParseStack(size_t tillPos) {
     // Call the destroy function for all stack elements (except 0 - special element)
     for (auto i = StackPosition; i > tillPos; --i) {
-        if (pStack[i].TerminalMarker != InvalidIndex)
-            Stream.ReleaseMarker(pStack[i].TerminalMarker);
-        pStack[i].Cleanup();
+        if (Stack[i].TerminalMarker != InvalidIndex)
+            Stream.ReleaseMarker(Stack[i].TerminalMarker);
+        Stack[i].Cleanup();
     }
     // And reset position to last 'valid' element - usually 0
     StackPosition = tillPos;
@@ -411,22 +493,22 @@ void Parse<StackElement>::CleanupParseStack(size_t tillPos) {
 template <class StackElement>
 bool Parse<StackElement>::SetStartingProduction(unsigned nonTerminal) {
     // Check to make sure the parser is valid
-    if (StackPosition != 0u || pStack[0u].State == InvalidState || TopState == InvalidState)
+    if (StackPosition != 0u || Stack[0u].State == InvalidState || TopState == InvalidState)
         return false;
     // Get the start state of the nonterminal
     const auto state = pParseTable->GetStartState(nonTerminal);
     if (state == InvalidState)
         return false;
     // Adjust the stack state and top state
-    pStack[0u].State = state;
+    Stack[0u].State  = state;
     TopState         = state;
     SG_ASSERT(TopState != InvalidState);
     // If the state is recording then set the terminal market to the current token index
-    if (pParseTable->StateInfos[state].Record) {
-        pStack[0u].TerminalMarker = Stream.GetTokenIndex();
-        Stream.SetMarker(pStack[0u].TerminalMarker);
+    if (pParseTable->GetStateInfo(state).Record) {
+        Stack[0u].TerminalMarker = Stream.GetTokenIndex();
+        Stream.SetMarker(Stack[0u].TerminalMarker);
     } else
-        pStack[0u].TerminalMarker = InvalidIndex;
+        Stack[0u].TerminalMarker = InvalidIndex;
     return true;
 }
 
@@ -442,49 +524,62 @@ bool Parse<StackElement>::DoParse(ParseHandler<StackElement>& parseHandler) {
             return false;
 
         // Store result from the previous step
-        pStack[StackPosition].State = TopState;
+        Stack[StackPosition].State = TopState;
+
+        // Reduce without the lookahead if the state has a default reduction
+        auto actionEntry = unsigned(pParseTable->GetStateInfo(TopState).DefaultReduce);
+        if (actionEntry != 0u)
+            goto reduce_action;
 
         // Get the token code if needed
-        if (NextTokenFlag)
+        if (NextTokenFlag) {
             GetNextToken(Token);
+            NextTokenFlag = false;
+        }
 
     try_next_action:
         // Keep shifting as long as 'Shift' action is selected
-        auto actionEntry = pParseTable->GetAction(pStack[StackPosition].State, Token.Code);
+        actionEntry = pParseTable->GetAction(Stack[StackPosition].State, Token.Code);
         while (actionEntry & ParseTable::ShiftMask) {
+            if (!GrowStack())
+                goto step_error;
             ++StackPosition;
-            SG_ASSERT(StackPosition < StackSize);
-            pStack[StackPosition].State = actionEntry & ParseTable::ExtractMask;
+            Stack[StackPosition].State = actionEntry & ParseTable::ExtractMask;
 
             // User callback (to get at token data)
-            pStack[StackPosition].ShiftToken(Token, Stream);
-            if (pParseTable->Terminals[Token.Code].ErrorTerminal) {
+            Stack[StackPosition].ShiftToken(Token, Stream);
+            if (pParseTable->GetTerminal(Token.Code).ErrorTerminal) {
                 const auto marker = Token.Code == TokenCode::TokenError
                                         ? ErrorMarker
-                                        : pStack[StackPosition - 1u].TerminalMarker;
+                                        : Stack[StackPosition - 1u].TerminalMarker;
                 const auto offset = Stream.GetTokenIndex();
                 Stream.BacktrackToMarker(marker, Stream.GetBufferedLength(marker));
-                pStack[StackPosition].SetErrorData(Token, Stream);
+                Stack[StackPosition].SetErrorData(Token, Stream);
                 // If it's a backtracking error, backtrack & retry the whole thing
-                if (pParseTable->StateInfos[pStack[StackPosition].State].BacktrackOnError)
-                    Stream.BacktrackToMarker(pStack[StackPosition - 1u].TerminalMarker);
+                if (pParseTable->GetStateInfo(Stack[StackPosition].State).BacktrackOnError)
+                    Stream.BacktrackToMarker(Stack[StackPosition - 1u].TerminalMarker);
                 else
                     Stream.SeekTo(offset);
                 Stream.SetMaxStreamLength();
             }
 
             // Start recording if needed
-            if (pParseTable->StateInfos[pStack[StackPosition].State].Record)
-                Stream.SetMarker(pStack[StackPosition].TerminalMarker = Stream.GetTokenIndex());
+            if (pParseTable->GetStateInfo(Stack[StackPosition].State).Record)
+                Stream.SetMarker(Stack[StackPosition].TerminalMarker = Stream.GetTokenIndex());
             else
-                pStack[StackPosition].TerminalMarker = InvalidIndex;
-
-            // Get next token
-            GetNextToken(Token);
-            // And get next action
-            actionEntry = pParseTable->GetAction(pStack[StackPosition].State, Token.Code);
+                Stack[StackPosition].TerminalMarker = InvalidIndex;
+
+            // Get next token and next action, unless the state reduces without the lookahead
+            // This way the reduction is done before the next token is available
+            actionEntry   = pParseTable->GetStateInfo(Stack[StackPosition].State).DefaultReduce;
+            NextTokenFlag = actionEntry != 0u;
+            if (!NextTokenFlag) {
+                GetNextToken(Token);
+                actionEntry = pParseTable->GetAction(Stack[StackPosition].State, Token.Code);
+            }
         }
 
+    reduce_action:
         // Do Reduce
         if (actionEntry & ParseTable::ReduceMask) {
             // See if we have accepted
@@ -495,21 +590,31 @@ bool Parse<StackElement>::DoParse(ParseHandler<StackElement>& parseHandler) {
             const auto ReducedProd = actionEntry & ParseTable::ExtractMask;
             const auto rprod       = pParseTable->GetReduceProduction(ReducedProd);
 
+            // Reducing an empty production pushes an element
+            if (rprod.Length == 0u && !GrowStack())
+                goto step_error;
+
             // Release all markers
             for (size_t i = 0u; i < size_t(rprod.Length); ++i)
-                if (pStack[StackPosition - i].TerminalMarker != InvalidIndex)
-                    Stream.ReleaseMarker(pStack[StackPosition - i].TerminalMarker);
+                if (Stack[StackPosition - i].TerminalMarker != InvalidIndex)
+                    Stream.ReleaseMarker(Stack[StackPosition - i].TerminalMarker);
 
             // Pop the production (size-1), (point to the top element
             // so it can be accessed with [])
             StackPosition = StackPosition + 1u - size_t(rprod.Length);
             // Get next state (consult goto)
-            TopState      = pParseTable->GetLeftReduceState(pStack[StackPosition - 1u].State,
+            TopState      = pParseTable->GetLeftReduceState(Stack[StackPosition - 1u].State,
                                                             rprod.Left);
             if (TopState == InvalidState) {
-                // Cleanup the stack, including [StackPosition].
-                for (size_t i = size_t(rprod.Length + 1u); i > 0u; --i)
-                    pStack[StackPosition + i - 1u].Cleanup();
+                // The lookahead is needed for the error recovery
+                if (NextTokenFlag) {
+                    GetNextToken(Token);
+                    NextTokenFlag = false;
+                }
+                // Cleanup the stack, from [StackPosition] up to the previous top
+                // (the element pushed for an empty production)
+                for (auto i = std::max(size_t(rprod.Length), size_t(1u)); i > 0u; --i)
+                    Stack[StackPosition + i - 1u].Cleanup();
                 // Revert to previous stack position.
                 SG_ASSERT(StackPosition > 0u);
                 --StackPosition;
@@ -522,34 +627,33 @@ bool Parse<StackElement>::DoParse(ParseHandler<StackElement>& parseHandler) {
                 Stream.SeekBack(1u);
                 goto try_next_action;
             }
-            NextTokenFlag = false;
-            ReduceLeft    = rprod.Left;
+            ReduceLeft = rprod.Left;
 
             // If the Stack Position advanced we must make sure to set the terminal marker
             if (rprod.Length == 0u) {
                 // Start recording if needed
-                if (pParseTable->StateInfos[TopState].Record)
-                    Stream.SetMarker(pStack[StackPosition].TerminalMarker =
+                if (pParseTable->GetStateInfo(TopState).Record)
+                    Stream.SetMarker(Stack[StackPosition].TerminalMarker =
                         Stream.GetTokenIndex());
                 else
-                    pStack[StackPosition].TerminalMarker = InvalidIndex;
+                    Stack[StackPosition].TerminalMarker = InvalidIndex;
             }
 
             // If the reduce function fails than return an error
             if (!rprod.NotReported && !parseHandler.Reduce(*this, ReducedProd))
                 goto step_error;
 
-            // Cleanup the stack after [StackPosition].
+            // Cleanup the stack after [StackPosition], up to the previous top.
             // Leave the element at stack position unchanged since it holds the Reduce result.
-            for (size_t i = size_t(rprod.Length); i > 0u; --i)
-                pStack[StackPosition + i].Cleanup();
+            for (size_t i = size_t(rprod.Length); i > 1u; --i)
+                Stack[StackPosition + i - 1u].Cleanup();
 
             // See if this production has to throw a named error
             if (rprod.ErrorTerminalFlag) {
-                errorCode = ReducedProd | (ReduceLeft << 16u);
-                if (const auto it = pParseTable->ProductionErrorTerminals.find(errorCode);
-                    it != pParseTable->ProductionErrorTerminals.end()) {
-                    errorCode = it->second;
+                if (const auto errorTerminal =
+                        pParseTable->GetProductionErrorTerminal(ReducedProd, ReduceLeft);
+                    errorTerminal != ParseTable::InvalidState) {
+                    errorCode = errorTerminal;
                     errorCode &= ProductionMask::TerminalValue;
                     goto handle_error;
                 }
@@ -579,7 +683,7 @@ bool Parse<StackElement>::DoParse(ParseHandler<StackElement>& parseHandler) {
         // Search stack until a state with action on 'error' is found
         for (size_t i = 0u; i <= StackPosition; ++i) {
             const auto sp = StackPosition - i;
-            actionEntry   = pParseTable->GetAction(pStack[sp].State, errorCode);
+            actionEntry   = pParseTable->GetAction(Stack[sp].State, errorCode);
             if (actionEntry & (ParseTable::ShiftMask | ParseTable::ReduceMask)) {
                 // If the action is reduce, we have to try reducing until we
                 // finally shift the error token
@@ -596,9 +700,9 @@ bool Parse<StackElement>::DoParse(ParseHandler<StackElement>& parseHandler) {
                         break;
                     }
                     pos -= length - 1u;
-                    SG_ASSERT(pos > 0u && pos <= StackSize);
+                    SG_ASSERT(pos > 0u && pos <= Stack.GetCapacity());
                     // Check special case (reduce state for action is invalid)
-                    const auto state = pParseTable->GetReduceState(pStack[pos - 1u].State, actionVal);
+                    const auto state = pParseTable->GetReduceState(Stack[pos - 1u].State, actionVal);
                     if (state == InvalidState) {
                         needNextAction = false;
                         break;
@@ -629,14 +733,14 @@ bool Parse<StackElement>::DoParse(ParseHandler<StackElement>& parseHandler) {
         }
 
         if (!errorProdFound) {
-            LastErrorState = pStack[StackPosition].State;
+            LastErrorState = Stack[StackPosition].State;
             PrintStack(ErrorStackStr);
             goto step_error;
         }
 
         if (nextActionValid) {
             // If there are reductions we can do on 'error' lookahead, do them first
-            if ((pParseTable->GetAction(pStack[StackPosition].State, errorCode) &
+            if ((pParseTable->GetAction(Stack[StackPosition].State, errorCode) &
                  ParseTable::ReduceMask) == 0u) {
                 // Flush the remainder of stack symbols (this will also set StackPosition=sp)
                 CleanupParseStack(nextStackPosition);
@@ -679,7 +783,7 @@ bool Parse<StackElement>::DoParse(ParseHandler<StackElement>& parseHandler) {
                 GetNextToken(tmpToken);
             } while (pValidTokenStackPositions[tmpToken.Code] == InvalidIndex);
             // If there are reductions we can do on 'error' lookahead, do them first
-            if ((pParseTable->GetAction(pStack[StackPosition].State, errorCode) &
+            if ((pParseTable->GetAction(Stack[StackPosition].State, errorCode) &
                  ParseTable::ReduceMask) == 0u) {
                 // (2.) Flush the remainder of stack symbols (this will also set StackPosition=sp)
                 CleanupParseStack(pValidTokenStackPositions[tmpToken.Code]);
@@ -709,7 +813,7 @@ bool Parse<StackElement>::SetReduceNonterminal(unsigned nonTerminal) noexcept {
     if (!pParseTable || size_t(nonTerminal) >= pParseTable->GetNonTerminalCount())
         return false;
 
-    const auto topState = pParseTable->GetLeftReduceState(pStack[StackPosition - 1u].State,
+    const auto topState = pParseTable->GetLeftReduceState(Stack[StackPosition - 1u].State,
                                                           nonTerminal);
     if (topState == InvalidState)
         return false;
@@ -720,13 +824,27 @@ bool Parse<StackElement>::SetReduceNonterminal(unsigned nonTerminal) noexcept {
     return true;
 }
 
+// *** Stack
+
+// Makes room for an element above the stack top, adding a stack segment if needed
+template <class StackElement>
+bool Parse<StackElement>::GrowStack() {
+    if (StackPosition + 1u >= MaxStackSize) {
+        StackOverflow = true;
+        return false;
+    }
+    if (StackPosition + 1u == Stack.GetCapacity())
+        Stack.Grow();
+    return true;
+}
+
 // *** Debugging
 
 template <class StackElement>
 void Parse<StackElement>::PrintStack(String& str) const {
     str = StringWithFormat("%zu: ", StackPosition);
     for (size_t i = 0u; i <= StackPosition; ++i)
-        str += StringWithFormat("[s%u]", pStack[i].State);
+        str += StringWithFormat("[s%u]", Stack[i].State);
     str += "\n";
 }
 
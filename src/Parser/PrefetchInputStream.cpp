@@ -0,0 +1,134 @@
+// Filename:  PrefetchInputStream.cpp
+// Content:   Input stream reading ahead on a background thread implementation
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "PrefetchInputStream.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace SGParser
+{
+
+// ***** Prefetching input stream
+
+// Takes the next filled buffer, supplying the thread with the buffers to fill next
+TokenizerBuffer* PrefetchInputStream::TakeBuffer(TokenizerBufferPool& pool) {
+    if (Finished)
+        return nullptr;
+
+    // Keep the thread supplied with the empty buffers, so that it always reads ahead
+    // These are mostly the buffers the tokenizer returned to the pool
+    if (OwnedCount != Depth) {
+        for (; OwnedCount != Depth; ++OwnedCount) {
+            const auto pushed = Free.Push(pool.Acquire());
+            SG_ASSERT(pushed);
+            (void)pushed;
+        }
+        Notify(FreeSignal);
+    }
+    if (!Thread.joinable())
+        Thread = std::thread{[this]() { Prefetch(); }};
+
+    auto pbuffer = Filled.Pop();
+    if (!pbuffer) {
+        std::unique_lock<std::mutex> lock{WaitMutex};
+        FilledSignal.wait(lock, [&]() { return (pbuffer = Filled.Pop()) != nullptr; });
+    }
+    --OwnedCount;
+
+    // End of the input
+    if (pbuffer->pBufferTail == pbuffer->Buffer) {
+        pool.Release(pbuffer);
+        Finished = true;
+        Thread.join();
+        if (Error)
+            std::rethrow_exception(std::exchange(Error, nullptr));
+        return nullptr;
+    }
+    pbuffer->pNext = nullptr;
+    return pbuffer;
+}
+
+
+// Copies the data out of the filled buffers
+StreamSize PrefetchInputStream::Read(uint8_t* pBuffer, StreamSize numBytes) {
+    StreamSize readSize = 0;
+    while (readSize < numBytes) {
+        if (!pReadBuffer || pReadPos == pReadBuffer->pBufferTail) {
+            if (pReadBuffer)
+                ReadPool.Release(std::exchange(pReadBuffer, nullptr));
+            pReadBuffer = TakeBuffer(ReadPool);
+            if (!pReadBuffer)
+                break;
+            pReadPos = pReadBuffer->Buffer;
+        }
+        const auto length = std::min(StreamSize(pReadBuffer->pBufferTail - pReadPos),
+                                     numBytes - readSize);
+        std::copy(pReadPos, pReadPos + length, pBuffer + readSize);
+        pReadPos += length;
+        readSize += length;
+    }
+    return readSize;
+}
+
+
+// Fills the free buffers until the end of the input, or until stopped
+void PrefetchInputStream::Prefetch() {
+    for (;;) {
+        auto pbuffer = Free.Pop();
+        if (!pbuffer) {
+            std::unique_lock<std::mutex> lock{WaitMutex};
+            FreeSignal.wait(lock, [&]() {
+                return Stopping || (pbuffer = Free.Pop()) != nullptr;
+            });
+            if (Stopping)
+                return;
+        }
+
+        // Read errors end the input, like they do for the tokenizer reading the source
+        StreamSize bufferSize = 0;
+        try {
+            bufferSize = pSource->Read(reinterpret_cast<uint8_t*>(pbuffer->Buffer),
+                                       StreamSize(pbuffer->BufferSize));
+        } catch (...) {
+            Error = std::current_exception();
+        }
+        pbuffer->pBufferTail = pbuffer->Buffer + std::max<StreamSize>(bufferSize, 0);
+
+        // The queue has room for all the buffers
+        const auto pushed = Filled.Push(pbuffer);
+        SG_ASSERT(pushed);
+        (void)pushed;
+        Notify(FilledSignal);
+
+        if (bufferSize <= 0)
+            return;
+    }
+}
+
+
+// Stops the thread and frees the buffers it has
+void PrefetchInputStream::Stop() noexcept {
+    if (Thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock{WaitMutex};
+            Stopping = true;
+        }
+        FreeSignal.notify_one();
+        Thread.join();
+    }
+
+    // The pool the buffers came from may belong to another thread
+    while (const auto pbuffer = Free.Pop())
+        TokenizerBuffer::Destroy(pbuffer);
+    while (const auto pbuffer = Filled.Pop())
+        TokenizerBuffer::Destroy(pbuffer);
+    TokenizerBuffer::Destroy(std::exchange(pReadBuffer, nullptr));
+
+    OwnedCount = 0u;
+    Stopping   = false;
+    Finished   = true;
+}
+
+} // namespace SGParser
@@ -0,0 +1,148 @@
+// Filename:  PrefetchInputStream.h
+// Content:   Input stream reading ahead on a background thread
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_PREFETCHINPUTSTREAM_H
+#define INC_SGPARSER_PREFETCHINPUTSTREAM_H
+
+#include "TokenizerBase.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SGParser
+{
+
+// ***** PrefetchInputStream
+
+// Reads the source stream ahead on a background thread, so that reading the next block
+// of slow input (i.e. a pipe or a network file system) overlaps with tokenizing the
+// current one, instead of stalling the tokenizer in every buffer reload
+// Tokenizers take the buffers filled by the thread as they are, without copying them
+// (see TakeBuffer); the buffers come from the tokenizer buffer pool and the ones the
+// tokenizer is done with are handed to the thread again. The buffers are passed between
+// the threads through lock-free single-producer single-consumer queues; a thread sleeps
+// only when its queue is empty
+// The stream can also be read with Read(), which copies the data out of the buffers
+// The source is read only by the background thread, starting with the first read
+class PrefetchInputStream final : public InputStream
+{
+public:
+    // Number of buffers filled ahead by default: one in use and one being read
+    static constexpr size_t DefaultDepth = 2u;
+
+    // Constructor; up to depth buffers are being filled or waiting to be taken at once
+    explicit PrefetchInputStream(InputStream* psource, size_t depth = DefaultDepth)
+        : pSource{psource},
+          Depth{depth},
+          Free{depth},
+          Filled{depth} {
+        SG_ASSERT(psource && depth != 0u);
+    }
+
+    // No copy/move allowed
+    PrefetchInputStream(const PrefetchInputStream&)                = delete;
+    PrefetchInputStream(PrefetchInputStream&&) noexcept            = delete;
+    PrefetchInputStream& operator=(const PrefetchInputStream&)     = delete;
+    PrefetchInputStream& operator=(PrefetchInputStream&&) noexcept = delete;
+
+    // Destructor
+    ~PrefetchInputStream() override { Stop(); }
+
+    // *** InputStream overrides
+
+    // Takes the next filled buffer, waiting for it to be read if necessary
+    // The buffers to fill next are acquired from the pool, which the taken buffer
+    // should be returned to. Returns nullptr for EOF
+    // Exceptions thrown by the source on the background thread are rethrown here
+    // Must always be called on the same thread, with the same pool
+    TokenizerBuffer* TakeBuffer(TokenizerBufferPool& pool) override;
+
+    StreamSize Read(uint8_t* pBuffer, StreamSize numBytes) override;
+
+    // Stops reading ahead, waiting for the read in progress, and closes the source
+    bool       Close() override {
+        Stop();
+        return pSource->Close();
+    }
+
+private:
+    // Lock-free queue of buffers passed from one thread to another
+    // Only one thread may push and only one thread may pop
+    class BufferQueue final
+    {
+    public:
+        explicit BufferQueue(size_t capacity) : Slots(capacity + 1u) {}
+
+        // Called by the producer only; returns false if the queue is full
+        bool             Push(TokenizerBuffer* pbuffer) noexcept {
+            const auto tail = Tail.load(std::memory_order_relaxed);
+            const auto next = tail + 1u == Slots.size() ? 0u : tail + 1u;
+            if (next == Head.load(std::memory_order_acquire))
+                return false;
+            Slots[tail] = pbuffer;
+            Tail.store(next, std::memory_order_release);
+            return true;
+        }
+
+        // Called by the consumer only; returns nullptr if the queue is empty
+        TokenizerBuffer* Pop() noexcept {
+            const auto head = Head.load(std::memory_order_relaxed);
+            if (head == Tail.load(std::memory_order_acquire))
+                return nullptr;
+            const auto pbuffer = Slots[head];
+            Head.store(head + 1u == Slots.size() ? 0u : head + 1u, std::memory_order_release);
+            return pbuffer;
+        }
+
+    private:
+        std::vector<TokenizerBuffer*> Slots;
+        std::atomic<size_t>           Head{0u};
+        std::atomic<size_t>           Tail{0u};
+    };
+
+    InputStream*            pSource;
+    size_t                  Depth;
+
+    // Empty buffers for the thread to fill, and the filled buffers it passes back
+    // An empty filled buffer marks the end of the input
+    BufferQueue             Free;
+    BufferQueue             Filled;
+    // Buffers in the queues or being filled
+    size_t                  OwnedCount = 0u;
+
+    std::thread             Thread;
+    // Used only for sleeping on the queues
+    std::mutex              WaitMutex;
+    std::condition_variable FreeSignal;
+    std::condition_variable FilledSignal;
+    bool                    Stopping   = false;
+    bool                    Finished   = false;
+    // Exception thrown by the source
+    std::exception_ptr      Error;
+
+    // Buffers for Read(), and the one being copied
+    TokenizerBufferPool     ReadPool;
+    TokenizerBuffer*        pReadBuffer = nullptr;
+    const char*             pReadPos    = nullptr;
+
+    // Background thread routine filling the free buffers
+    void Prefetch();
+    // Stops the thread and frees the buffers it has
+    void Stop() noexcept;
+
+    // Wakes the thread sleeping on the signal, if any
+    void Notify(std::condition_variable& signal) {
+        // Taking the lock orders this with the sleeping thread's check of its queue
+        { std::lock_guard<std::mutex> lock{WaitMutex}; }
+        signal.notify_one();
+    }
+};
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_PREFETCHINPUTSTREAM_H
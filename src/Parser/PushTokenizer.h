@@ -0,0 +1,281 @@
+// Filename:  PushTokenizer.h
+// Content:   PushTokenizer class header file with declarations
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_PUSHTOKENIZER_H
+#define INC_SGPARSER_PUSHTOKENIZER_H
+
+#include "Tokenizer.h"
+#include "LexemeInfo.h"
+#include "DFA.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace SGParser
+{
+
+// ***** Push mode DFA tokenizer
+
+// Tokenizes the input fed to it in chunks as they arrive (i.e. from a non-blocking socket),
+// instead of reading it from an InputStream, which blocks until the data is available
+// A token is returned once the input fed shows where it ends; until then its lexeme
+// is kept suspended in the DFA state, and the scanning continues when more input is fed
+// Token data (see GetTokenCharReader) stays valid only until the next Feed() call,
+// and the token positions are counted from the beginning of all the input
+template <class Token>
+class PushTokenizer : public TokenizerImpl<Token>
+{
+public:
+    // Default constructor
+    PushTokenizer() = default;
+
+    // Initialization constructor
+    explicit PushTokenizer(const DFA* pdfa) { Create(pdfa); }
+
+    // Initializes the tokenizer to use a specified DFA, discarding any input fed before
+    void Create(const DFA* pdfa);
+
+    // Append a chunk of input
+    void Feed(const char* pdata, size_t size);
+    // Mark the end of input, so that the rest of it can be tokenized up to EOF
+    void Finish() noexcept           { Finished = true; }
+    bool IsFinished() const noexcept { return Finished; }
+
+    // Fills in the next token, if the input fed so far is enough to tell where it ends
+    // Returns false if more input is needed; always succeeds after Finish()
+    bool PollToken(Token& token);
+
+    // *** Token Stream interface
+
+    // Return next token / EOF Token
+    // It can't wait for more input, so if more is needed, the input is finished
+    Token& GetNextToken(Token& token) override;
+
+private:
+    using CodeType = typename Token::CodeType;
+
+    using typename TokenizerBase::ByteReader;
+    using typename TokenizerImpl<Token>::InputCharReader;
+    using typename TokenizerImpl<Token>::PosTracker;
+    using TokenizerImpl<Token>::SetInputStream;
+    using TokenizerImpl<Token>::HeadPos;
+    using TokenizerImpl<Token>::TailPos;
+    using TokenizerImpl<Token>::GetTailPos;
+    using TokenizerImpl<Token>::SetTailPos;
+    using TokenizerImpl<Token>::AdjustHead;
+    using TokenizerImpl<Token>::FindKeyword;
+
+    // Presents the input data fed so far to TokenizerBase as contiguous input
+    class DataStream final : public InputStream
+    {
+    public:
+        const char* pData = "";
+        size_t      Size  = 0u;
+
+        StreamSize Read(uint8_t*, StreamSize) noexcept override { return 0; }
+        bool       Close() noexcept override                   { return true; }
+
+        const uint8_t* GetContiguousData(size_t& size) noexcept override {
+            size = Size;
+            return reinterpret_cast<const uint8_t*>(pData);
+        }
+    };
+
+    const DFA*            pDFA               = nullptr;
+    std::vector<char>     Data;
+    DataStream            Stream;
+    bool                  Finished           = false;
+
+    // Suspended lexeme; the offsets are in Data
+    bool                  Scanning           = false;
+    unsigned              State              = 0u;
+    unsigned              LastLexemeID       = DFA::EmptyTransition;
+    size_t                HeadOffset         = 0u;
+    size_t                ScanOffset         = 0u;
+    size_t                LastTailOffset     = 0u;
+    PosTracker            LastTailPos;
+
+    // Expression stack, controls starting state
+    unsigned              ExpressionStackTop = 0u;
+    std::vector<unsigned> ExpressionStack;
+
+    // Points the tokenizer to the data up to the end offset,
+    // with the head and tail at the lexeme head and the scan offset
+    void   AttachData(size_t end);
+    size_t GetTailOffset() const noexcept { return size_t(GetTailPos().pChar - Stream.pData); }
+};
+
+// *** Push Tokenizer implementation
+
+template <class Token>
+void PushTokenizer<Token>::Create(const DFA* pdfa) {
+    pDFA     = pdfa;
+    Finished = false;
+    Scanning = false;
+    Data.clear();
+    HeadOffset = ScanOffset = LastTailOffset = 0u;
+    HeadPos.Clear();
+    TailPos.Clear();
+
+    // Starting with expressions 0 in dfa
+    ExpressionStackTop = 0u;
+    ExpressionStack.clear();
+}
+
+// Appends the input, dropping the data of the tokens returned
+template <class Token>
+void PushTokenizer<Token>::Feed(const char* pdata, size_t size) {
+    SG_ASSERT(!Finished);
+
+    if (const auto used = Scanning ? HeadOffset : ScanOffset; used != 0u) {
+        Data.erase(Data.begin(), Data.begin() + ptrdiff_t(used));
+        HeadOffset     = HeadOffset - std::min(HeadOffset, used);
+        ScanOffset     = ScanOffset - used;
+        LastTailOffset = LastTailOffset - std::min(LastTailOffset, used);
+    }
+    Data.insert(Data.end(), pdata, pdata + size);
+}
+
+template <class Token>
+void PushTokenizer<Token>::AttachData(size_t end) {
+    Stream.pData = Data.empty() ? "" : Data.data();
+    Stream.Size  = end;
+    TokenizerBase::SetInputStream(&Stream);
+    SetTailPos({Stream.pData + HeadOffset, nullptr});
+    AdjustHead();
+    SetTailPos({Stream.pData + ScanOffset, nullptr});
+}
+
+// Gets next token, if it's complete
+template <class Token>
+bool PushTokenizer<Token>::PollToken(Token& token) {
+    SG_ASSERT(pDFA);
+    CodeType code;
+
+    do {
+        // Start a new lexeme at the end of the previous one
+        if (!Scanning) {
+            HeadPos    = TailPos;
+            HeadOffset = ScanOffset;
+
+            if (ScanOffset == Data.size()) {
+                if (!Finished)
+                    return false;
+                AttachData(ScanOffset);
+                token.CopyFromTokenizer(TokenCode::TokenEOF, *this);
+                return true;
+            }
+
+            State        = pDFA->GetExpressionStartState(ExpressionStackTop);
+            LastLexemeID = DFA::EmptyTransition;
+            Scanning     = true;
+        }
+
+        // Scan the lexeme further over the complete characters fed so far,
+        // recording the longest one recognized
+        auto end = Data.size();
+        if (!Finished)
+            end = size_t(InputCharReader::FindCharsEnd(&Data[ScanOffset], Data.data() + end) -
+                         Data.data());
+        AttachData(end);
+
+        InputCharReader charReader{ByteReader{*this}, TailPos};
+        bool            stuck = false;
+
+        pDFA->VisitStates([&](const auto& states) {
+            while (!charReader.IsEOF()) {
+                const auto state = states.GetTransitionState(State, charReader.GetChar());
+
+                // EmptyTransition means error condition
+                if (state == DFA::EmptyTransition) {
+                    stuck = true;
+                    break;
+                }
+                State = state;
+
+                // If the state loops back to itself, skip all the bytes
+                // which keep us in it, up to the first one leaving the state
+                if (charReader.Advance())
+                    if (const auto pexitSet = states.GetSelfLoopExitSet(State))
+                        charReader.SkipUntil(*pexitSet);
+
+                if (const auto accept = pDFA->GetAcceptState(State); accept != 0u) {
+                    LastLexemeID   = accept;
+                    LastTailPos    = TailPos;
+                    LastTailOffset = GetTailOffset();
+                }
+            }
+        });
+        ScanOffset = GetTailOffset();
+
+        // The lexeme may continue in the input not fed yet
+        if (!stuck && !Finished)
+            return false;
+        Scanning = false;
+
+        if (LastLexemeID == DFA::EmptyTransition) {
+            // Error - nothing recognized, skip the first character
+            ScanOffset = HeadOffset;
+            TailPos    = HeadPos;
+            AttachData(end);
+            InputCharReader{ByteReader{*this}, TailPos}.Advance();
+            ScanOffset = GetTailOffset();
+            token.CopyFromTokenizer(TokenCode::TokenError, *this);
+            return true;
+        }
+
+        // Put the tail at the end of the lexeme found
+        ScanOffset = LastTailOffset;
+        TailPos    = LastTailPos;
+        SetTailPos({Stream.pData + ScanOffset, nullptr});
+
+        // Tell a keyword apart from the lexeme it was matched as
+        if (pDFA->HasKeywords(LastLexemeID))
+            LastLexemeID = FindKeyword(pDFA->GetKeywordTable(), LastLexemeID);
+
+        const auto& lexinfo = pDFA->GetLexemeInfo(LastLexemeID);
+        code                = lexinfo.TokenCode;
+
+        // Perform an action, if any
+        switch (lexinfo.Action & LexemeInfo::ActionMask) {
+            case LexemeInfo::ActionPush:
+                ExpressionStack.push_back(ExpressionStackTop);
+                // Fall through to goto
+                [[fallthrough]];
+
+            case LexemeInfo::ActionGoto:
+                ExpressionStackTop = lexinfo.Action & LexemeInfo::ActionValueMask;
+                break;
+
+            case LexemeInfo::ActionPop:
+                if (!ExpressionStack.empty()) {
+                    ExpressionStackTop = ExpressionStack.back();
+                    ExpressionStack.pop_back();
+                } else { // Empty stack, error
+                    ExpressionStackTop = 0u;
+                    token.CopyFromTokenizer(TokenCode::TokenError, *this);
+                    return true;
+                }
+                break;
+        }
+
+        // if code == 0, then ignore token
+    } while (code == 0u);
+
+    token.CopyFromTokenizer(code, *this);
+    return true;
+}
+
+template <class Token>
+Token& PushTokenizer<Token>::GetNextToken(Token& token) {
+    if (!PollToken(token)) {
+        Finish();
+        PollToken(token);
+    }
+    return token;
+}
+
+} // namespace SGParser
+
+#endif // INC_SGPARSER_PUSHTOKENIZER_H
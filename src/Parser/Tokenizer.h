@@ -6,8 +6,10 @@
 #define INC_SGPARSER_TOKENIZER_H
 
 #include "TokenizerBase.h"
+#include "ByteScanSet.h"
 
 #include <map>
+#include <string_view>
 #include <vector>
 
 namespace SGParser
@@ -49,10 +51,23 @@ public:
     // Fills in the read in token the passed token reference
     // is returned back. Users should test token code for EOF
     virtual Token& GetNextToken(Token& token) = 0;
+
+    // Fills in up to count tokens into the passed array, stopping after the EOF token
+    // Returns the number of tokens filled in (including EOF), never 0 for a non-zero count
+    // Streams should override it to read the tokens without a virtual call per token
+    virtual size_t GetTokens(Token* ptokens, size_t count) {
+        size_t index = 0u;
+        while (index < count)
+            if (GetNextToken(ptokens[index++]).Code == TokenCode::TokenEOF)
+                break;
+        return index;
+    }
 };
 
 
 // Line / Offset position tracker in the stream
+// Updated for every character; for contiguous input, LineIndex can compute
+// the same positions later from byte offsets
 struct LineOffsetPosTracker final
 {
     // Line in file and offset in line
@@ -71,6 +86,19 @@ struct LineOffsetPosTracker final
             ++Offset;
     }
 
+    // Advance over a range of single-byte characters
+    void AdvanceRange(const char* pbegin, const char* pend) noexcept {
+        for (; pbegin != pend; ++pbegin)
+            AdvanceChar(uint8_t(*pbegin));
+    }
+
+    // Advance over a range of UTF-8 characters, counting every character by its first byte
+    void AdvanceUTF8Range(const char* pbegin, const char* pend) noexcept {
+        for (; pbegin != pend; ++pbegin)
+            if ((uint8_t(*pbegin) & 0xC0u) != 0x80u)
+                AdvanceChar(uint8_t(*pbegin));
+    }
+
     void Clear() noexcept {
         Line   = 0u;
         Offset = 0u;
@@ -78,12 +106,34 @@ struct LineOffsetPosTracker final
 };
 
 
+// Byte offset position tracker in the stream
+struct ByteOffsetPosTracker final
+{
+    // Offset in bytes from the beginning of the stream
+    size_t Offset = 0u;
+
+    void AdvanceByte() noexcept         { ++Offset; }
+    void AdvanceChar(unsigned) noexcept {}
+    void Clear() noexcept               { Offset = 0u; }
+
+    void AdvanceRange(const char* pbegin, const char* pend) noexcept {
+        Offset += size_t(pend - pbegin);
+    }
+    void AdvanceUTF8Range(const char* pbegin, const char* pend) noexcept {
+        Offset += size_t(pend - pbegin);
+    }
+};
+
+
 // A no-op position tracker that incurs no overhead
 struct NullPosTracker final
 {
     void AdvanceByte() noexcept         {}
     void AdvanceChar(unsigned) noexcept {}
     void Clear() noexcept               {}
+
+    void AdvanceRange(const char*, const char*) noexcept     {}
+    void AdvanceUTF8Range(const char*, const char*) noexcept {}
 };
 
 
@@ -91,16 +141,20 @@ struct NullPosTracker final
 
 // Character reader class used to read both the input
 // characters and for re-scanning the final token string
-// characters. This class can be substituted to allow
-// for Unicode / UTF8 character decoding
+// characters. Every byte is a character; this class can be
+// substituted with UTF8CharReaderBase for UTF-8 decoding
 template <class ByteReader, class PosTracker>
 class TokenCharReaderBase final
 {
 public:
+    // Every character is a single byte
+    static constexpr bool ByteChars = true;
+
     TokenCharReaderBase(const ByteReader& reader, PosTracker& pos)
         : Reader{reader},
           Pos{pos} {
-        Character = reader.GetByte();
+        // Data past the end may not be readable (i.e. for contiguous input)
+        Character = reader.IsEOF() ? 0u : reader.GetByte();
     }
 
     bool Advance() {
@@ -111,9 +165,29 @@ public:
         return hasAdvanced;
     }
 
+    // Skips the input up to the next byte in the set, within the currently loaded data
+    // The current character (which must not be EOF) is skipped too, if it's not in the set
+    // Valid only when the characters are single bytes
+    void SkipUntil(const ByteScanSet& set) {
+        const auto [pbegin, pend] = Reader.SkipUntil(set);
+        Pos.AdvanceRange(pbegin, pend);
+        Character = Reader.GetByte();
+    }
+
     bool     IsEOF() const noexcept   { return Reader.IsEOF(); }
     unsigned GetChar() const noexcept { return Character; }
 
+    // Returns the character after the current one if it's already loaded, or -1 otherwise
+    int      PeekLoadedChar() const noexcept { return Reader.PeekLoadedByte(); }
+
+    // Advance a position over raw input data, as reading it would
+    static void AdvancePos(PosTracker& pos, const char* pbegin, const char* pend) noexcept {
+        pos.AdvanceRange(pbegin, pend);
+    }
+
+    // Return the end of the complete characters in the data, which is fed in parts
+    static const char* FindCharsEnd(const char*, const char* pend) noexcept { return pend; }
+
 private:
     ByteReader  Reader;
     PosTracker& Pos;
@@ -121,6 +195,131 @@ private:
 };
 
 
+// UTF-8 character reader, a drop-in replacement for TokenCharReaderBase
+// Characters are Unicode code points, to be used with DFAs built with the \u escapes
+// Malformed sequences, overlong forms and surrogates are read as U+FFFD,
+// consuming a single byte, so that the reading is resynchronized on the next byte
+template <class ByteReader, class PosTracker>
+class UTF8CharReaderBase final
+{
+public:
+    // Characters may take several bytes
+    static constexpr bool     ByteChars       = false;
+    static constexpr unsigned ReplacementChar = 0xFFFDu;
+
+    UTF8CharReaderBase(const ByteReader& reader, PosTracker& pos)
+        : Reader{reader},
+          Pos{pos} {
+        Decode();
+    }
+
+    bool Advance() {
+        Pos.AdvanceChar(Character);
+        bool hasAdvanced = true;
+        for (unsigned i = 0u; i < Length; ++i) {
+            Pos.AdvanceByte();
+            hasAdvanced = Reader.Advance();
+        }
+        Decode();
+        return hasAdvanced;
+    }
+
+    // Skips the input up to the next byte in the set, within the currently loaded data
+    // The current character (which must not be EOF) is skipped too, if it's not in the set
+    // Valid only when all the bytes above 0x7F are out of the set, so that whole
+    // characters are skipped; a character crossing the end of the loaded data is not
+    void SkipUntil(const ByteScanSet& set) {
+        auto [pbegin, pend] = Reader.SkipUntil(set);
+        // Back up to the first byte of the character the skip stopped at
+        while (pend != pbegin && (uint8_t(*pend) & 0xC0u) == 0x80u)
+            --pend;
+        Reader.Rewind(pend);
+        Pos.AdvanceUTF8Range(pbegin, pend);
+        Decode();
+    }
+
+    bool     IsEOF() const noexcept   { return Reader.IsEOF(); }
+    unsigned GetChar() const noexcept { return Character; }
+
+    // Advance a position over raw input data, as reading it would
+    static void AdvancePos(PosTracker& pos, const char* pbegin, const char* pend) noexcept {
+        pos.AdvanceUTF8Range(pbegin, pend);
+    }
+
+    // Return the end of the complete characters in the data, which is fed in parts,
+    // excluding a sequence cut at the end
+    static const char* FindCharsEnd(const char* pbegin, const char* pend) noexcept {
+        // The last sequence begins at most 3 bytes before the end
+        for (auto pchar = pend; pchar != pbegin && pend - pchar < 4;) {
+            const unsigned byte = uint8_t(*--pchar);
+            if ((byte & 0xC0u) == 0x80u)
+                continue;
+            const auto length = byte >= 0xF0u ? 4 : byte >= 0xE0u ? 3 : byte >= 0xC0u ? 2 : 1;
+            return pend - pchar < length ? pchar : pend;
+        }
+        return pend;
+    }
+
+private:
+    ByteReader  Reader;
+    PosTracker& Pos;
+    unsigned    Character = 0u;
+    // Length of the current character in bytes
+    unsigned    Length    = 1u;
+
+    // Decodes the character starting at the current byte
+    void Decode() {
+        Length = 1u;
+        if (Reader.IsEOF()) {
+            // Data past the end may not be readable (i.e. for contiguous input)
+            Character = 0u;
+            return;
+        }
+
+        const unsigned lead = Reader.GetByte();
+        if (lead < 0x80u) {
+            Character = lead;
+            return;
+        }
+
+        // Sequence length and the smallest code point it may encode
+        unsigned length, minChar;
+        if (lead >= 0xC2u && lead <= 0xDFu) {
+            length    = 2u;
+            minChar   = 0x80u;
+            Character = lead & 0x1Fu;
+        } else if (lead >= 0xE0u && lead <= 0xEFu) {
+            length    = 3u;
+            minChar   = 0x800u;
+            Character = lead & 0x0Fu;
+        } else if (lead >= 0xF0u && lead <= 0xF4u) {
+            length    = 4u;
+            minChar   = 0x10000u;
+            Character = lead & 0x07u;
+        } else {
+            Character = ReplacementChar;
+            return;
+        }
+
+        for (unsigned i = 1u; i < length; ++i) {
+            const auto byte = Reader.PeekByte(i);
+            if (byte < 0 || (unsigned(byte) & 0xC0u) != 0x80u) {
+                Character = ReplacementChar;
+                return;
+            }
+            Character = (Character << 6u) | (unsigned(byte) & 0x3Fu);
+        }
+
+        if (Character < minChar || Character > 0x10FFFFu ||
+            (Character >= 0xD800u && Character <= 0xDFFFu)) {
+            Character = ReplacementChar;
+            return;
+        }
+        Length = length;
+    }
+};
+
+
 // ***** Tokenizer
 
 // Converts StreamInput into Token stream
@@ -145,6 +344,13 @@ public:
         return TokenizerBase::SetInputStream(pinputStream);
     }
 
+    // Set the position tracked for the beginning of the input
+    // Used when the input is a continuation of some earlier data
+    void SetStartPos(const PosTracker& pos) noexcept {
+        HeadPos = pos;
+        TailPos = pos;
+    }
+
     // *** Query Token Data (returns information about current token)
 
     // Return a character reader for the last token
@@ -158,7 +364,9 @@ public:
     }
 
     // Returns position in file
-    PosTracker GetTokenPos() const noexcept { return HeadPos; }
+    PosTracker GetTokenPos() const noexcept    { return HeadPos; }
+    // Returns position in file right after the token
+    PosTracker GetTokenEndPos() const noexcept { return TailPos; }
 
 protected:
     // Track the line and column
@@ -202,6 +410,38 @@ struct GenericToken final : TokenCode
     }
 };
 
+
+// ***** View token
+
+// Token containing the code and the byte range of the token in the input
+// The token string is not copied; it can be obtained as a view
+// into the (contiguous) input data the tokenizer is reading from
+// Only the byte offset is tracked; the line position of a token can be computed
+// on demand from its offset with a LineIndex over the same input data
+struct ViewToken final : TokenCode
+{
+    using PosTracker      = ByteOffsetPosTracker;
+    using InputCharReader = TokenCharReaderBase<TokenizerBase::ByteReader, PosTracker>;
+    using TokenCharReader = TokenCharReaderBase<TokenizerBase::BufferRangeByteReader, NullPosTracker>;
+    using Tokenizer       = TokenizerImpl<ViewToken>;
+
+    size_t Offset = 0u;
+    size_t Length = 0u;
+
+    // Read-in from tokenizer function
+    void CopyFromTokenizer(CodeType code, const Tokenizer& tokenizer) noexcept {
+        Code   = code;
+        Offset = tokenizer.GetTokenPos().Offset;
+        Length = tokenizer.GetTokenEndPos().Offset - Offset;
+    }
+
+    // Return the token string from the input data the token was read from
+    std::basic_string_view<CharT> GetView(std::basic_string_view<CharT> input) const noexcept {
+        SG_ASSERT(Offset + Length <= input.size());
+        return {input.data() + Offset, Length};
+    }
+};
+
 } // namespace SGParser
 
 #endif // INC_SGPARSER_TOKENIZER_H
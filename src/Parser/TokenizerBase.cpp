@@ -4,11 +4,88 @@
 
 #include "TokenizerBase.h"
 
+#include <new>
+#include <utility>
+
 namespace SGParser
 {
 
 // ***** Tokenizer buffer implementation
 
+// Allocates the buffer structure and its character data in one block
+TokenizerBuffer* TokenizerBuffer::Create(size_t bufferSize) {
+    const auto pmemory = ::operator new(sizeof(TokenizerBuffer) + bufferSize);
+    const auto pbuffer = new (pmemory) TokenizerBuffer;
+    pbuffer->Buffer     = reinterpret_cast<char*>(pbuffer + 1);
+    pbuffer->BufferSize = bufferSize;
+    return pbuffer;
+}
+
+
+void TokenizerBuffer::Destroy(TokenizerBuffer* pbuffer) noexcept {
+    if (!pbuffer)
+        return;
+    pbuffer->~TokenizerBuffer();
+    ::operator delete(pbuffer);
+}
+
+
+// ***** Tokenizer buffer pool implementation
+
+TokenizerBufferPool& TokenizerBufferPool::GetThreadPool() noexcept {
+    thread_local TokenizerBufferPool pool;
+    return pool;
+}
+
+
+void TokenizerBufferPool::SetBufferSize(size_t bufferSize) noexcept {
+    SG_ASSERT(bufferSize != 0u);
+    if (bufferSize != BufferSize) {
+        Clear();
+        BufferSize = bufferSize;
+    }
+}
+
+
+void TokenizerBufferPool::SetMaxFreeCount(size_t maxFreeCount) noexcept {
+    MaxFreeCount = maxFreeCount;
+    while (FreeCount > MaxFreeCount) {
+        TokenizerBuffer::Destroy(std::exchange(pFreeBuffers, pFreeBuffers->pNext));
+        --FreeCount;
+    }
+}
+
+
+TokenizerBuffer* TokenizerBufferPool::Acquire() {
+    if (!pFreeBuffers)
+        return TokenizerBuffer::Create(BufferSize);
+
+    --FreeCount;
+    const auto pbuffer = std::exchange(pFreeBuffers, pFreeBuffers->pNext);
+    pbuffer->pNext     = nullptr;
+    return pbuffer;
+}
+
+
+void TokenizerBufferPool::Release(TokenizerBuffer* pbuffer) noexcept {
+    if (pbuffer->BufferSize != BufferSize || FreeCount == MaxFreeCount) {
+        TokenizerBuffer::Destroy(pbuffer);
+        return;
+    }
+    pbuffer->pNext = std::exchange(pFreeBuffers, pbuffer);
+    ++FreeCount;
+}
+
+
+void TokenizerBufferPool::Clear() noexcept {
+    while (pFreeBuffers)
+        TokenizerBuffer::Destroy(std::exchange(pFreeBuffers, pFreeBuffers->pNext));
+    FreeCount = 0u;
+}
+
+
+// ***** Tokenizer base implementation
+
 // Set input stream and setup the initial buffer
 bool TokenizerBase::SetInputStream(InputStream* pinputStream) {
     if (!pinputStream) {
@@ -17,12 +94,38 @@ bool TokenizerBase::SetInputStream(InputStream* pinputStream) {
         pInputStream = nullptr;
     } else {
         pInputStream = pinputStream;
-        if (pHeadBuffer) {
+
+        // Contiguous input is scanned in place, no buffers are needed
+        size_t     dataSize = 0u;
+        const auto pdata    = pinputStream->GetContiguousData(dataSize);
+        if (pdata) {
+            FreeAllBuffers();
+            pHead      = reinterpret_cast<const char*>(pdata);
+            pTail      = pHead;
+            pTailEnd   = pHead + dataSize;
+            pInputData = pHead;
+            return true;
+        }
+        pInputData = nullptr;
+
+        // Input filling its own buffers hands over the first one
+        const auto ptakenBuffer = pinputStream->TakeBuffer(GetBufferPool());
+
+        // The head buffer is reused, unless the pool hands out buffers of another size now
+        // Input filling its own buffers is never read into it
+        if (pHeadBuffer && (ptakenBuffer ||
+                            pHeadBuffer->BufferSize != GetBufferPool().GetBufferSize()))
+            FreeAllBuffers();
+
+        if (ptakenBuffer) {
+            pHeadBuffer = ptakenBuffer;
+        } else if (pHeadBuffer) {
             // Make sure we only have one buffer at pHead
             AdjustHead();
             // Free any hanging off tails (flush)
             while (pHeadBuffer->pNext)
-                delete std::exchange(pHeadBuffer->pNext, pHeadBuffer->pNext->pNext);
+                GetBufferPool().Release(std::exchange(pHeadBuffer->pNext,
+                                                      pHeadBuffer->pNext->pNext));
 
             // Get a block from the stream
             const auto bufferSize = pinputStream->Read(
@@ -48,7 +151,7 @@ bool TokenizerBase::SetInputStream(InputStream* pinputStream) {
         pHead       = &pHeadBuffer->Buffer[0u];
         pTail       = &pHeadBuffer->Buffer[0u];
         pTailBuffer = pHeadBuffer;
-        pFreeBuffer = nullptr;
+        pTailEnd    = pTailBuffer->pBufferTail;
     }
 
     return true;
@@ -58,24 +161,28 @@ bool TokenizerBase::SetInputStream(InputStream* pinputStream) {
 // Free all the buffers and reset the tokenizer data
 void TokenizerBase::FreeAllBuffers() noexcept {
     while (pHeadBuffer)
-        delete std::exchange(pHeadBuffer, pHeadBuffer->pNext);
-
-    delete std::exchange(pFreeBuffer, nullptr);
+        GetBufferPool().Release(std::exchange(pHeadBuffer, pHeadBuffer->pNext));
 
     // Reset all pointers
     pHead       = nullptr;
     pTail       = nullptr;
     pTailBuffer = nullptr;
+    pTailEnd    = nullptr;
+    pInputData  = nullptr;
 }
 
 
 // Loads in a new buffer and returns it
 TokenizerBuffer* TokenizerBase::LoadNewBuffer(bool freeOnEmpty) {
-    // Use a free temporary buffer if we have one
-    // If not, create a new tokenizer buffer
-    // Basic exception safety is provided (if new TokenizerBuffer fails)
-    const auto newBuffer = pFreeBuffer ? std::exchange(pFreeBuffer, nullptr)
-                                       : new TokenizerBuffer;
+    auto& pool = GetBufferPool();
+
+    // Input filling its own buffers hands them over, recycling the pool buffers
+    if (const auto pbuffer = pInputStream->TakeBuffer(pool))
+        return pbuffer;
+
+    // Take a free buffer from the pool, which creates a new one if it has none
+    // Basic exception safety is provided (if the allocation fails)
+    const auto newBuffer = pool.Acquire();
 
     // Get a block from the stream
     auto bufferSize = pInputStream->Read(reinterpret_cast<uint8_t*>(newBuffer->Buffer),
@@ -85,7 +192,7 @@ TokenizerBuffer* TokenizerBase::LoadNewBuffer(bool freeOnEmpty) {
     if (bufferSize <= 0) {
         // if freeOnEmpty than fail
         if (freeOnEmpty) {
-            pFreeBuffer = newBuffer;
+            pool.Release(newBuffer);
             return nullptr;
         }
         // Otherwise, behave like we read 0 bytes
@@ -101,16 +208,17 @@ TokenizerBuffer* TokenizerBase::LoadNewBuffer(bool freeOnEmpty) {
 
 // Reload the buffer loads in a new buffer and adjusts the tail
 bool TokenizerBase::ReloadBuffer() {
-    SG_ASSERT(pTailBuffer);
+    SG_ASSERT(pTail);
 
     // If there is not already an allocated buffer than create one
-    if (!pTailBuffer->pNext) {
+    // Contiguous input has no buffers, so its end is always EOF
+    if (!pTailBuffer || !pTailBuffer->pNext) {
         // Get the new buffer
-        const auto newBuffer = LoadNewBuffer();
+        const auto newBuffer = pTailBuffer ? LoadNewBuffer() : nullptr;
 
         if (!newBuffer) {
             // Back the pTail up so next time we will also get EOF
-            if (pTail > pTailBuffer->pBufferTail)
+            if (pTail > pTailEnd)
                 --pTail;
             return false;
         }
@@ -121,31 +229,70 @@ bool TokenizerBase::ReloadBuffer() {
     // Point the tail to the new buffer
     pTailBuffer = pTailBuffer->pNext;
     pTail       = &pTailBuffer->Buffer[0u];
+    pTailEnd    = pTailBuffer->pBufferTail;
     return true;
 }
 
 
-// Moves the head to the tail position and frees all the discarded blocks
-// If there is no free buffer available and a block is free than the system
-// caches it for next time (could be a cache list, etc)
+// Returns the byte at the offset from the tail, loading the following buffers if needed
+int TokenizerBase::PeekTail(size_t offset) {
+    SG_ASSERT(pTail);
+
+    auto pchar   = pTail;
+    auto pend    = pTailEnd;
+    auto pbuffer = pTailBuffer;
+    while (size_t(pend - pchar) <= offset) {
+        offset -= size_t(pend - pchar);
+        // Contiguous input has no buffers, so its end is always EOF
+        if (!pbuffer)
+            return -1;
+        // ReloadBuffer() moves the tail into the linked buffers later on
+        if (!pbuffer->pNext) {
+            const auto newBuffer = LoadNewBuffer();
+            if (!newBuffer)
+                return -1;
+            pbuffer->pNext = newBuffer;
+        }
+        pbuffer = pbuffer->pNext;
+        pchar   = &pbuffer->Buffer[0u];
+        pend    = pbuffer->pBufferTail;
+    }
+    return static_cast<uint8_t>(pchar[offset]);
+}
+
+
+// Moves the head to the tail position and returns the discarded blocks to the buffer pool
 void TokenizerBase::AdjustHead() noexcept {
-    SG_ASSERT(pHeadBuffer && pTailBuffer);
+    SG_ASSERT(pHead && pTail);
 
     // Move the Head to the Tail
     pHead = pTail;
 
-    // Need to destroy a buffer
+    // Return all the unused buffers to the pool
     if (pHeadBuffer != pTailBuffer) {
-        // Save one of the buffers
-        if (!pFreeBuffer) {
-            pFreeBuffer = pHeadBuffer;
-            pHeadBuffer = pHeadBuffer->pNext;
-        }
-
-        // Now go through and destroy all unused buffers
+        auto& pool = GetBufferPool();
         while (pHeadBuffer != pTailBuffer)
-            delete std::exchange(pHeadBuffer, pHeadBuffer->pNext);
+            pool.Release(std::exchange(pHeadBuffer, pHeadBuffer->pNext));
+    }
+}
+
+
+// Looks the text between the head and the tail up in the keyword table
+unsigned TokenizerBase::FindKeyword(const KeywordTable& table, unsigned lexemeId) const noexcept {
+    if (pHeadBuffer == pTailBuffer)
+        return table.Find(lexemeId, pHead, size_t(pTail - pHead));
+
+    // Text crossing the buffers is copied, unless it is longer than any keyword
+    char   text[KeywordTable::MaxTextSize];
+    size_t size = 0u;
+    for (BufferRangeByteReader reader{GetHeadPos(), GetTailPos()}; !reader.IsEOF();) {
+        if (size == KeywordTable::MaxTextSize)
+            return lexemeId;
+        text[size++] = char(reader.GetByte());
+        if (!reader.Advance())
+            break;
     }
+    return table.Find(lexemeId, text, size);
 }
 
 } // namespace SGParser
@@ -6,6 +6,10 @@
 #define INC_SGPARSER_TOKENIZERBASE_H
 
 #include "SGStream.h"
+#include "ByteScanSet.h"
+#include "KeywordTable.h"
+
+#include <utility>
 
 namespace SGParser
 {
@@ -13,17 +17,81 @@ namespace SGParser
 // ***** Tokenizer's Data Buffer
 
 // Linked list of buffers is used, to allow for arbitrary length lexemes
-struct TokenizerBuffer
+// Contiguous input (see InputStream::GetContiguousData) is scanned in place instead
+// The character data is allocated together with the buffer, its size is set at creation
+struct TokenizerBuffer final
 {
-    static constexpr size_t BufferSize  = 8192u;
+    static constexpr size_t DefaultBufferSize = 8192u;
 
     // Pointer to the first character after the buffer
-    // pBufferTail has to be first element in a structure!!!
-    char*            pBufferTail        = nullptr;
+    char*            pBufferTail = nullptr;
     // Pointer to next buffer, if any
-    TokenizerBuffer* pNext              = nullptr;
+    TokenizerBuffer* pNext       = nullptr;
     // Character data
-    char             Buffer[BufferSize] = {};
+    char*            Buffer      = nullptr;
+    size_t           BufferSize  = 0u;
+
+    // Allocates a buffer with the given character data size
+    static TokenizerBuffer* Create(size_t bufferSize);
+    // Frees a buffer allocated by Create()
+    static void             Destroy(TokenizerBuffer* pbuffer) noexcept;
+};
+
+
+// Pool of free tokenizer buffers, which tokenizers borrow the buffers from and return to
+// Saves allocating the buffers for every tokenizer, when many of them are used one after
+// another. Tokenizers use the pool of the current thread, unless a pool is set explicitly
+// The pool is not synchronized, so an explicitly set pool may be shared only among the
+// tokenizers used on the same thread
+class TokenizerBufferPool final
+{
+public:
+    static constexpr size_t DefaultMaxFreeCount = 16u;
+
+    explicit TokenizerBufferPool(size_t bufferSize   = TokenizerBuffer::DefaultBufferSize,
+                                 size_t maxFreeCount = DefaultMaxFreeCount) noexcept
+        : BufferSize{bufferSize},
+          MaxFreeCount{maxFreeCount} {
+        SG_ASSERT(bufferSize != 0u);
+    }
+
+    // No copy/move allowed
+    TokenizerBufferPool(const TokenizerBufferPool&)                = delete;
+    TokenizerBufferPool(TokenizerBufferPool&&) noexcept            = delete;
+    TokenizerBufferPool& operator=(const TokenizerBufferPool&)     = delete;
+    TokenizerBufferPool& operator=(TokenizerBufferPool&&) noexcept = delete;
+
+    // Destructor
+    ~TokenizerBufferPool() { Clear(); }
+
+    // Returns the pool of the current thread
+    // Tokenizers using it must be destroyed before their thread exits
+    static TokenizerBufferPool& GetThreadPool() noexcept;
+
+    // Size of the buffers handed out; changing it frees the buffers of the old size
+    size_t GetBufferSize() const noexcept { return BufferSize; }
+    void   SetBufferSize(size_t bufferSize) noexcept;
+
+    // Maximum number of the free buffers kept in the pool
+    size_t GetMaxFreeCount() const noexcept { return MaxFreeCount; }
+    void   SetMaxFreeCount(size_t maxFreeCount) noexcept;
+
+    // Take a free buffer, or allocate a new one
+    TokenizerBuffer* Acquire();
+    // Return a buffer to the pool; buffers of a different size or above the
+    // maximum free count are freed
+    void             Release(TokenizerBuffer* pbuffer) noexcept;
+
+    // Free all the free buffers
+    void             Clear() noexcept;
+
+private:
+    size_t           BufferSize;
+    size_t           MaxFreeCount;
+
+    // List of free buffers, linked through pNext
+    TokenizerBuffer* pFreeBuffers = nullptr;
+    size_t           FreeCount    = 0u;
 };
 
 
@@ -51,29 +119,40 @@ public:
 
     // Returns false for EOF
     // Must be called only after successful call to SetInputStream(),
-    // since this requires pTailBuffer to be non-null
+    // since this requires pTail to be non-null
     bool AdvanceTail() {
-        SG_ASSERT(pTailBuffer);
+        SG_ASSERT(pTail);
         ++pTail;
-        return pTail >= pTailBuffer->pBufferTail ? ReloadBuffer() : true;
+        return pTail >= pTailEnd ? ReloadBuffer() : true;
     }
 
+    // Set the pool to take the buffers from; nullptr selects the pool of the current thread
+    // Buffers already taken are returned to the new pool
+    void SetBufferPool(TokenizerBufferPool* pbufferPool) noexcept { pBufferPool = pbufferPool; }
+
     // Creates a new buffer and loads the block from input stream
     // Returns nullptr for EOF
     TokenizerBuffer* LoadNewBuffer(bool freeOnEmpty = true);
     // Reloads buffers & positions tail
     // Must be called only after successful call to SetInputStream(),
-    // since this requires pTailBuffer to be non-null
-    // Returns nullptr for EOF
+    // since this requires pTail to be non-null
+    // Returns false for EOF
     bool ReloadBuffer();
+    // Returns the byte at the offset from the tail, or -1 if the input ends before it
+    // Buffers needed to reach it are loaded and linked after the tail buffer
+    int  PeekTail(size_t offset);
     // Free's all the buffers and resets the pointers
     void FreeAllBuffers() noexcept;
 
     // Move the head to the tail and free the used buffers
     // Must be called only after successful call to SetInputStream(),
-    // since this requires pHeadBuffer and pTailBuffer to be non-null
+    // since this requires pHead and pTail to be non-null
     void AdjustHead() noexcept;
 
+    // Returns the keyword lexeme for the text between the head and the tail,
+    // recognized as a lexeme, or the lexeme itself if the text is not a keyword
+    unsigned FindKeyword(const KeywordTable& table, unsigned lexemeId) const noexcept;
+
     // Byte reader implementations for both initial token character reading token
     // string re-scanning. We always start out at the first byte available
     // (unless IsEOF() is true) and can call Advance() for more
@@ -83,17 +162,37 @@ public:
         explicit ByteReader(TokenizerBase& tok) noexcept : Tok{tok} {}
 
         uint8_t  GetByte() const noexcept { return static_cast<uint8_t>(*Tok.pTail); }
-        bool     IsEOF() const noexcept   { return Tok.pTail >= Tok.pTailBuffer->pBufferTail; }
+        bool     IsEOF() const noexcept   { return Tok.pTail >= Tok.pTailEnd; }
         bool     Advance()                { return Tok.AdvanceTail(); }
+        // Returns the byte at the offset from the current one, or -1 past the input end
+        int      PeekByte(size_t offset)  { return Tok.PeekTail(offset); }
+        // Returns the byte after the current one if it's already loaded, or -1 otherwise
+        int      PeekLoadedByte() const noexcept {
+            return Tok.pTailEnd - Tok.pTail > 1 ? int(uint8_t(Tok.pTail[1])) : -1;
+        }
+
+        // Moves to the next byte in the set, but never past the last loaded byte,
+        // so that the following Advance() handles buffer reloading and EOF
+        // Returns the skipped range
+        std::pair<const char*, const char*> SkipUntil(const ByteScanSet& set) noexcept {
+            SG_ASSERT(!IsEOF());
+            const auto pbegin = Tok.pTail;
+            Tok.pTail         = set.FindFirst(pbegin, Tok.pTailEnd - 1);
+            return {pbegin, Tok.pTail};
+        }
+
+        // Moves back to a byte skipped by the last SkipUntil() call
+        void Rewind(const char* pchar) noexcept { Tok.pTail = pchar; }
 
     private:
         TokenizerBase& Tok;
     };
 
     // Get location in the buffer; can represent either head or tail
+    // For contiguous input pBuffer is always null
     struct BufferPos final
     {
-        char*            pChar   = nullptr;
+        const char*      pChar   = nullptr;
         TokenizerBuffer* pBuffer = nullptr;
 
         bool operator==(const BufferPos& other) const noexcept {
@@ -104,11 +203,26 @@ public:
     BufferPos GetHeadPos() const noexcept { return {pHead, pHeadBuffer}; }
     BufferPos GetTailPos() const noexcept { return {pTail, pTailBuffer}; }
 
+    // Contiguous input can be accessed at any offset from its beginning
+    bool      IsContiguous() const noexcept { return pInputData != nullptr; }
+    // Return the offset of a position in contiguous input
+    size_t    GetInputOffset(const BufferPos& pos) const noexcept {
+        SG_ASSERT(IsContiguous());
+        return size_t(pos.pChar - pInputData);
+    }
+    // Move the tail to an offset in contiguous input
+    void      SetTailOffset(size_t offset) noexcept {
+        SG_ASSERT(IsContiguous() && offset <= size_t(pTailEnd - pInputData));
+        pTail = pInputData + offset;
+    }
+
     // Readjust tail buffer; useful when we overshoot the tail
     // end of the token due to lexical scanning look-ahead
     void      SetTailPos(const BufferPos& src) noexcept {
         pTail       = src.pChar;
         pTailBuffer = src.pBuffer;
+        if (pTailBuffer)
+            pTailEnd = pTailBuffer->pBufferTail;
     }
 
     // Read in bytes between the specified Head and Tail positions
@@ -126,13 +240,25 @@ public:
 
         bool    Advance() noexcept {
             ++Head.pChar;
-            if (Head.pChar == Head.pBuffer->pBufferTail) {
+            // The range ends within the last buffer, so only the preceding ones are crossed
+            if (Head.pBuffer != Tail.pBuffer && Head.pChar == Head.pBuffer->pBufferTail) {
                 Head.pBuffer = Head.pBuffer->pNext;
                 if (Head.pBuffer == nullptr)
                     return false;
                 Head.pChar = &Head.pBuffer->Buffer[0u];
             }
-            return true;
+            // Returns false at the range end, like ByteReader at EOF,
+            // since the data past the range may not be readable
+            return !IsEOF();
+        }
+
+        // Returns the byte at the offset from the current one, or -1 past the range end
+        int     PeekByte(size_t offset) const noexcept {
+            auto reader = *this;
+            for (; offset != 0u; --offset)
+                if (!reader.Advance())
+                    return -1;
+            return reader.GetByte();
         }
 
     private:
@@ -142,17 +268,26 @@ public:
 
 private:
     // Head and its buffer (points to beginning of lexeme)
-    char*            pHead        = nullptr;
-    TokenizerBuffer* pHeadBuffer  = nullptr;
+    const char*          pHead           = nullptr;
+    TokenizerBuffer*     pHeadBuffer     = nullptr;
     // Tail and its buffer (seeks forward as lexeme is being recognized)
-    char*            pTail        = nullptr;
-    TokenizerBuffer* pTailBuffer  = nullptr;
+    const char*          pTail           = nullptr;
+    TokenizerBuffer*     pTailBuffer     = nullptr;
+    // End of the data available to the tail
+    // This is the tail buffer end, or the end of the whole contiguous input
+    const char*          pTailEnd        = nullptr;
+    // Beginning of contiguous input, or nullptr for the input read into buffers
+    const char*          pInputData      = nullptr;
 
-    // Used for optimized performance
-    TokenizerBuffer* pFreeBuffer  = nullptr;
+    // Pool to take the buffers from, or nullptr for the pool of the current thread
+    TokenizerBufferPool* pBufferPool     = nullptr;
 
     // The input we're tokenizing, returns data in bytes
-    InputStream*     pInputStream = nullptr;
+    InputStream*         pInputStream    = nullptr;
+
+    TokenizerBufferPool& GetBufferPool() const noexcept {
+        return pBufferPool ? *pBufferPool : TokenizerBufferPool::GetThreadPool();
+    }
 };
 
 } // namespace SGParser
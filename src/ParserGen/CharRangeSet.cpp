@@ -0,0 +1,149 @@
+// Filename:  CharRangeSet.cpp
+// Content:   Character range set implementation
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "CharRangeSet.h"
+
+#include <algorithm>
+
+namespace SGParser
+{
+namespace Generator
+{
+
+// ***** Character range set
+
+// Adds a range, merging it with the overlapping and adjacent ranges
+void CharRangeSet::Add(unsigned from, unsigned to) {
+    if (from > to)
+        return;
+
+    // First range which is not entirely before the new one (and not adjacent to it)
+    auto first = std::find_if(Ranges.begin(), Ranges.end(), [from](const CharRange& range) {
+        return from == 0u || range.To >= from - 1u;
+    });
+    // Merge all the ranges which overlap or touch the new one
+    auto last  = first;
+    while (last != Ranges.end() && (to == unsigned(-1) || last->From <= to + 1u)) {
+        from = std::min(from, last->From);
+        to   = std::max(to, last->To);
+        ++last;
+    }
+
+    first = Ranges.erase(first, last);
+    Ranges.insert(first, CharRange{from, to});
+}
+
+
+// Union with another set
+void CharRangeSet::Add(const CharRangeSet& set) {
+    for (const auto& range: set.Ranges)
+        Add(range.From, range.To);
+}
+
+
+// Removes a range of characters, splitting the ranges crossing its bounds
+void CharRangeSet::Remove(unsigned from, unsigned to) {
+    if (from > to)
+        return;
+
+    std::vector<CharRange> newRanges;
+    newRanges.reserve(Ranges.size() + 1u);
+    for (const auto& range: Ranges) {
+        if (range.To < from || range.From > to) {
+            newRanges.push_back(range);
+            continue;
+        }
+        if (range.From < from)
+            newRanges.push_back({range.From, from - 1u});
+        if (range.To > to)
+            newRanges.push_back({to + 1u, range.To});
+    }
+    Ranges.swap(newRanges);
+}
+
+
+// Returns the characters belonging to both sets
+CharRangeSet CharRangeSet::Intersection(const CharRangeSet& set) const {
+    CharRangeSet result;
+
+    // Both range lists are sorted, so they are walked through in parallel
+    auto it1 = Ranges.begin();
+    auto it2 = set.Ranges.begin();
+    while (it1 != Ranges.end() && it2 != set.Ranges.end()) {
+        const auto from = std::max(it1->From, it2->From);
+        const auto to   = std::min(it1->To, it2->To);
+        if (from <= to)
+            result.Ranges.push_back({from, to});
+        // Advance the range which ends first
+        if (it1->To < it2->To)
+            ++it1;
+        else
+            ++it2;
+    }
+    return result;
+}
+
+
+// Returns the characters of the [from, to] range which do not belong to the set
+CharRangeSet CharRangeSet::Complement(unsigned from, unsigned to) const {
+    CharRangeSet result{from, to};
+    for (const auto& range: Ranges)
+        result.Remove(range.From, range.To);
+    return result;
+}
+
+
+// Splits the ranges into disjoint ones at every range bound
+std::vector<CharRange> CharRangeSet::Split(const std::vector<CharRange>& ranges) {
+    // Every range starts a new piece at its first character and after its last one
+    std::vector<unsigned> bounds;
+    bounds.reserve(ranges.size() * 2u);
+    for (const auto& range: ranges) {
+        bounds.push_back(range.From);
+        if (range.To != unsigned(-1))
+            bounds.push_back(range.To + 1u);
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+    // Coverage of each piece is found by counting the ranges open at its start
+    std::vector<unsigned> starts, ends;
+    starts.reserve(ranges.size());
+    ends.reserve(ranges.size());
+    for (const auto& range: ranges) {
+        starts.push_back(range.From);
+        if (range.To != unsigned(-1))
+            ends.push_back(range.To + 1u);
+    }
+    std::sort(starts.begin(), starts.end());
+    std::sort(ends.begin(), ends.end());
+
+    std::vector<CharRange> pieces;
+    size_t started = 0u, ended = 0u;
+    for (size_t i = 0u; i < bounds.size(); ++i) {
+        while (started < starts.size() && starts[started] <= bounds[i])
+            ++started;
+        while (ended < ends.size() && ends[ended] <= bounds[i])
+            ++ended;
+        if (started == ended)
+            continue;
+        const auto to = i + 1u < bounds.size() ? bounds[i + 1u] - 1u : unsigned(-1);
+        pieces.push_back({bounds[i], to});
+    }
+    return pieces;
+}
+
+
+// Checks if the character belongs to the set
+bool CharRangeSet::Contains(unsigned ch) const noexcept {
+    // First range ending at or after the character
+    const auto it = std::lower_bound(Ranges.begin(), Ranges.end(), ch,
+                                     [](const CharRange& range, unsigned value) {
+                                         return range.To < value;
+                                     });
+    return it != Ranges.end() && it->From <= ch;
+}
+
+} // namespace Generator
+} // namespace SGParser
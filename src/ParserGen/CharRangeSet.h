@@ -0,0 +1,92 @@
+// Filename:  CharRangeSet.h
+// Content:   Character range set declarations
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_GENERATOR_CHARRANGESET_H
+#define INC_SGPARSER_GENERATOR_CHARRANGESET_H
+
+#include <vector>
+
+namespace SGParser
+{
+namespace Generator
+{
+
+// ***** Character range
+
+// Inclusive range of characters [From, To]
+struct CharRange final
+{
+    unsigned From;
+    unsigned To;
+
+    bool Contains(unsigned ch) const noexcept { return ch >= From && ch <= To; }
+
+    bool operator==(const CharRange& other) const noexcept {
+        return From == other.From && To == other.To;
+    }
+    bool operator!=(const CharRange& other) const noexcept { return !(*this == other); }
+};
+
+
+// ***** Character range set
+
+// Set of characters stored as sorted, disjoint and non-adjacent ranges
+// Used for the regular expression character classes, so that a class like [^a]
+// takes a couple of ranges instead of a million of characters
+class CharRangeSet final
+{
+public:
+    using const_iterator = std::vector<CharRange>::const_iterator;
+
+public:
+    // Creates an empty set
+    CharRangeSet() = default;
+
+    // Creates a set of one range
+    CharRangeSet(unsigned from, unsigned to) { Add(from, to); }
+
+    // *** Modification
+
+    // Add a character or a range of characters (union)
+    void          Add(unsigned ch)                   { Add(ch, ch); }
+    void          Add(unsigned from, unsigned to);
+    // Add all the characters of another set (union)
+    void          Add(const CharRangeSet& set);
+
+    // Remove a range of characters
+    void          Remove(unsigned from, unsigned to);
+
+    // *** Set operations
+
+    // Return the characters belonging to both sets
+    CharRangeSet  Intersection(const CharRangeSet& set) const;
+    // Return the characters of the [from, to] range which do not belong to the set
+    CharRangeSet  Complement(unsigned from, unsigned to) const;
+
+    // Splits a list of (possibly overlapping) ranges into disjoint ranges, in ascending order,
+    // such that every one of the source ranges is a union of some of the resulting ranges
+    // Characters not covered by any source range do not belong to any resulting range
+    static std::vector<CharRange> Split(const std::vector<CharRange>& ranges);
+
+    // *** Query
+
+    bool          Contains(unsigned ch) const noexcept;
+
+    bool          empty() const noexcept             { return Ranges.empty(); }
+    void          clear() noexcept                   { Ranges.clear(); }
+
+    const_iterator begin() const noexcept            { return Ranges.begin(); }
+    const_iterator end() const noexcept              { return Ranges.end(); }
+
+    bool operator==(const CharRangeSet& other) const { return Ranges == other.Ranges; }
+    bool operator!=(const CharRangeSet& other) const { return Ranges != other.Ranges; }
+
+private:
+    std::vector<CharRange> Ranges;
+};
+
+} // namespace Generator
+} // namespace SGParser
+
+#endif // INC_SGPARSER_GENERATOR_CHARRANGESET_H
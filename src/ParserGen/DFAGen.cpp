@@ -8,6 +8,10 @@
 #include "DFAGen.h"
 #include "Tokenizer.h"
 
+#include <algorithm>
+#include <map>
+#include <numeric>
+
 namespace SGParser
 {
 namespace Generator
@@ -27,18 +31,64 @@ bool DFAGen::Create(const NFA& nfa, const std::vector<Lexeme>& lexemes,
     std::vector<std::vector<NFANode*>*> dfaStates;
 
     // Construct a list of all characters used in the NFA
-    std::set<NFANode*> tempList;
-    std::set<unsigned> charSet;
+    std::set<NFANode*>     tempList;
+    std::set<unsigned>     charSet;
+    std::vector<CharRange> wideRanges;
 
     nfa.TraverseGraph(nfa.pStartState, tempList);
 
-    // Search for maximum character used (to determine the width of the table)
-    // And also store all characters used in the char set
+    // Every byte character gets its own column, while the characters above the
+    // byte range get a column for every range they can not be told apart in
     for (const auto infaSet : tempList)
-        charSet.insert(infaSet->LinkChar.begin(), infaSet->LinkChar.end());
+        for (const auto& range : infaSet->LinkRange) {
+            if (range.From == NFANode::Epsilon)
+                continue;
+            for (auto ch = range.From; ch <= range.To && ch < CharTableType::Size; ++ch)
+                charSet.insert(ch);
+            if (range.To >= CharTableType::Size)
+                wideRanges.push_back({std::max(range.From, unsigned(CharTableType::Size)),
+                                      range.To});
+        }
 
-    for (const auto icharSet : charSet)
-        CharTable.SetValue(icharSet, unsigned(GetCharCount()));
+    // A lower case letter which every NFA node links to the same nodes as the upper case one
+    // shares its column (i.e. the letters of the lexemes matched in either case), so that
+    // matching either case takes no more columns than matching one
+    std::vector<NFANode*> targets[2u];
+    const auto sameLinks = [&](unsigned ch1, unsigned ch2) {
+        for (const auto infaSet : tempList) {
+            for (auto& chTargets : targets)
+                chTargets.clear();
+            for (size_t j = 0u; j < infaSet->LinkRange.size(); ++j) {
+                if (infaSet->LinkRange[j].Contains(ch1))
+                    targets[0u].push_back(infaSet->LinkPtr[j]);
+                if (infaSet->LinkRange[j].Contains(ch2))
+                    targets[1u].push_back(infaSet->LinkPtr[j]);
+            }
+            for (auto& chTargets : targets) {
+                std::sort(chTargets.begin(), chTargets.end());
+                chTargets.erase(std::unique(chTargets.begin(), chTargets.end()),
+                                chTargets.end());
+            }
+            if (targets[0u] != targets[1u])
+                return false;
+        }
+        return true;
+    };
+
+    size_t columnCount = 0u;
+    for (const auto icharSet : charSet) {
+        constexpr unsigned caseShift = 'a' - 'A';
+        if (icharSet >= 'a' && icharSet <= 'z' && charSet.count(icharSet - caseShift) != 0u &&
+            sameLinks(icharSet - caseShift, icharSet))
+            CharTable.SetValue(icharSet, CharTable.GetValue(icharSet - caseShift));
+        else
+            CharTable.SetValue(icharSet, ClassType(columnCount++));
+    }
+    for (const auto& range : CharRangeSet::Split(wideRanges))
+        WideCharClasses.push_back({range.From, range.To,
+                                   ClassType(columnCount + WideCharClasses.size())});
+
+    const auto charClassCount = columnCount + WideCharClasses.size();
 
     // Put e-closure(pnfa.initialState) in for the first state of dfaStates
     auto peclosure = new std::vector<NFANode*>;
@@ -51,7 +101,7 @@ bool DFAGen::Create(const NFA& nfa, const std::vector<Lexeme>& lexemes,
 
     // And allocate the transition table for the first state
     TransitionTable.resize(1u);
-    TransitionTable[0u].resize(GetCharCount(), EmptyTransition);
+    TransitionTable[0u].resize(charClassCount, EmptyTransition);
 
     // Create subset states
     for (size_t state = 0u; state < dfaStates.size(); ++state) {
@@ -61,19 +111,30 @@ bool DFAGen::Create(const NFA& nfa, const std::vector<Lexeme>& lexemes,
         const auto& dfaState = *dfaStates[state];
 
         // Go through and insert all character links with their destination
+        // The links are keyed by the column, so every range link goes to all of its columns
         for (const auto it : dfaState)
-            for (size_t j = 0u; j < it->LinkChar.size(); ++j)
-                if (const auto ch = it->LinkChar[j]; ch != 0u)
-                    charLinks[ch].push_back(it->LinkPtr[j]);
+            for (size_t j = 0u; j < it->LinkRange.size(); ++j) {
+                const auto& range = it->LinkRange[j];
+                if (range.From == NFANode::Epsilon)
+                    continue;
+                for (auto ch = range.From; ch <= range.To && ch < CharTableType::Size; ++ch)
+                    charLinks[CharTable.GetValue(ch)].push_back(it->LinkPtr[j]);
+                for (auto iclass = FindWideCharClass(range.From);
+                     iclass != WideCharClasses.end() && iclass->From <= range.To; ++iclass)
+                    charLinks[iclass->Class].push_back(it->LinkPtr[j]);
+            }
 
-        // Go through all characters
-        for (const auto& [ch, nodes] : charLinks) {
+        // Go through all character classes
+        for (const auto& [column, nodes] : charLinks) {
             // There can never be empty node sets, because they wouldn't have been added
             // Copy next std::vector
             *pnextState = nodes;
 
             // Sort states so that we can use a linear search
+            // The letters of both cases may share a column, so a node may be linked twice
             std::sort(pnextState->begin(), pnextState->end());
+            pnextState->erase(std::unique(pnextState->begin(), pnextState->end()),
+                              pnextState->end());
 
             // Add all states reachable through epsilon-links
             EpsilonClosure(*pnextState);
@@ -92,14 +153,14 @@ bool DFAGen::Create(const NFA& nfa, const std::vector<Lexeme>& lexemes,
                 // And allocate transition table for the state
                 const auto size = TransitionTable.size();
                 TransitionTable.resize(size + 1u);
-                TransitionTable[size].resize(GetCharCount(), EmptyTransition);
+                TransitionTable[size].resize(charClassCount, EmptyTransition);
                 // Allocate std::vector for next state
                 pnextState = new std::vector<NFANode*>;
             }
 
-            // Set transition for this state on a given character 'chars[i]'
-            // To a new state j (made out of move for that character)
-            SetTransitionState(unsigned(state), ch, unsigned(j));
+            // Set transition for this state on a given character class
+            // To a new state j (made out of move for that character class)
+            TransitionTable[state][column] = StateType(j);
         }
     }
 
@@ -122,13 +183,18 @@ bool DFAGen::Create(const NFA& nfa, const std::vector<Lexeme>& lexemes,
     // Make an array that tells us which states are accepting states.
     // Zero means non-accepting, nonzero means accepting. The particular
     // nonzero value is the lowest lexeme ID number associated with the nodes
-    AcceptStates.resize(TransitionTable.size(), StateType(0u));
+    AcceptStates.resize(TransitionTable.size(), uint16_t(0u));
+
+    // Lexeme IDs are the lexeme indices offset by the default tokens
+    const auto getLexemeName = [&](unsigned lexemeId) {
+        return lexemes[lexemeId - TokenCode::TokenFirstID].Name.data();
+    };
 
     for (size_t i = 0u; i < TransitionTable.size(); ++i) {
         auto& acceptState = AcceptStates[i];
         // Does this state contain an accepting node?
         for (const auto& it: *dfaStates[i]) {
-            const auto astate = StateType(it->AcceptingState);
+            const auto astate = uint16_t(it->AcceptingState);
             if (astate) {
                 // Set pAcceptState[i] equal to the lexeme ID if either:
                 //   1. It's the only non-zero lexeme ID we've seen
@@ -138,14 +204,14 @@ bool DFAGen::Create(const NFA& nfa, const std::vector<Lexeme>& lexemes,
                 else if (acceptState < astate) {
                     // NOTE: Lexeme %s takes precedence over %s on state %d
                     checkForNoteAndReport("Lexeme '%s' takes precedence over '%s' on state %zu",
-                                          lexemes[astate].Name.data(),
-                                          lexemes[acceptState].Name.data(), i);
+                                          getLexemeName(astate), getLexemeName(acceptState),
+                                          i);
                     acceptState = astate;
                 } else if (acceptState > astate)
                     // NOTE: Lexeme %s takes precedence over %s on state %d (other way around)
                     checkForNoteAndReport("Lexeme '%s' takes precedence over '%s' on state %zu",
-                                          lexemes[acceptState].Name.data(),
-                                          lexemes[astate].Name.data(), i);
+                                          getLexemeName(acceptState), getLexemeName(astate),
+                                          i);
             }
         }
     }
@@ -171,10 +237,21 @@ bool DFAGen::Create(const NFA& nfa, const std::vector<Lexeme>& lexemes,
     // Only one expression created
     ExpressionStartStates.push_back(StateType(0u));
 
+    UpdateTransitionTable();
+
     return true;
 }
 
 
+// Destroy the DFA data and reset its variables
+void DFAGen::Destroy() noexcept {
+    TransitionTable.clear();
+    WideCharClasses.clear();
+    EmptyStateCount = 0u;
+    DFA::Destroy();
+}
+
+
 // Combines another DFA into this one, and assigns it a next expression state
 // Source DFA is emptied
 bool DFAGen::Combine(DFAGen& dfa) {
@@ -187,7 +264,8 @@ bool DFAGen::Combine(DFAGen& dfa) {
         return false;
 
     // Concatenate tables, accept states and expression start tables
-    // Create a new list of all the characters
+    // Every character class (column) of the combined DFA is a pair of the classes
+    // of this and the source DFA, so that the transitions of both are preserved
 
     const auto stateCount       = TransitionTable.size();
     const auto sourceStateCount = dfa.TransitionTable.size();
@@ -195,38 +273,66 @@ bool DFAGen::Combine(DFAGen& dfa) {
     const auto newStartState    = StateType(stateCount);
     const auto newStateCount    = stateCount + sourceStateCount;
 
-    const auto oldCharCount     = GetCharCount();
-
-    // Add all new chars to the Chart table
-    for (const auto& [pos, value]: dfa.CharTable)
-        if (!CharTable.HasValue(pos))
-            CharTable.SetValue(pos, unsigned(GetCharCount()));
-
-    // Resize each state within the transition table
-    const auto newCharCount = GetCharCount();
-    if (oldCharCount != newCharCount)
-        for (size_t i = 0u; i < stateCount; ++i)
-            TransitionTable[i].resize(newCharCount, EmptyTransition);
-
-    // Append the source DFAs transition table and accept states
-    AcceptStates.resize(newStateCount);
-    TransitionTable.resize(newStateCount);
-    for (size_t i = 0u; i < sourceStateCount; ++i) {
-        // Append each accept state
-        AcceptStates[stateCount + i] = dfa.AcceptStates[i];
-        // Relocate the source states values into this ones (check every character)
-        TransitionTable[stateCount + i].resize(newCharCount, EmptyTransition);
-        // Traverse the source character list and add a new state for all characters
-        for (const auto& [pos, _]: dfa.CharTable) {
-            // Get the transition state for the specific character
-            const auto state = StateType(dfa.GetTransitionState(unsigned(i), unsigned(pos)));
-            // If the state is not empty than insert it into the table
-            if (state != EmptyTransition)
-                TransitionTable[stateCount + i][GetCharIndex(unsigned(pos))] =
-                    state + newStartState;
-        }
+    std::map<std::pair<ClassType, ClassType>, ClassType> classMap;
+    std::vector<std::pair<ClassType, ClassType>>         classes;
+    const auto getClass = [&](ClassType thisClass, ClassType sourceClass) {
+        const auto key                = std::make_pair(thisClass, sourceClass);
+        const auto [iclassMap, added] = classMap.try_emplace(key, ClassType(classes.size()));
+        if (added)
+            classes.push_back(key);
+        return iclassMap->second;
+    };
+
+    // Byte characters
+    CharTableType newCharTable;
+    for (unsigned ch = 0u; ch < unsigned(CharTableType::Size); ++ch) {
+        const auto thisClass   = CharTable.GetValue(ch);
+        const auto sourceClass = dfa.CharTable.GetValue(ch);
+        if (thisClass != EmptyClass || sourceClass != EmptyClass)
+            newCharTable.SetValue(ch, getClass(thisClass, sourceClass));
     }
 
+    // Wide characters, split at the bounds of the classes of both DFAs
+    std::vector<CharRange> wideRanges;
+    for (const auto& wideClass : WideCharClasses)
+        wideRanges.push_back({wideClass.From, wideClass.To});
+    for (const auto& wideClass : dfa.WideCharClasses)
+        wideRanges.push_back({wideClass.From, wideClass.To});
+
+    std::vector<WideCharClass> newWideCharClasses;
+    for (const auto& range : CharRangeSet::Split(wideRanges))
+        newWideCharClasses.push_back({range.From, range.To,
+                                      getClass(GetWideCharClass(range.From),
+                                               dfa.GetWideCharClass(range.From))});
+
+    // Build the rows of both DFAs over the combined classes
+    const auto getRow = [&](const std::vector<StateType>& row, bool source) {
+        std::vector<StateType> newRow(classes.size(), EmptyTransition);
+        for (size_t i = 0u; i < classes.size(); ++i) {
+            const auto oldClass = source ? classes[i].second : classes[i].first;
+            // Empty rows may be cleared by the compression
+            if (oldClass == EmptyClass || oldClass >= row.size())
+                continue;
+            if (const auto state = row[oldClass]; state != EmptyTransition)
+                newRow[i] = source ? StateType(state + newStartState) : state;
+        }
+        return newRow;
+    };
+
+    TransitionRows newTable;
+    newTable.reserve(newStateCount);
+    for (const auto& row : TransitionTable)
+        newTable.push_back(getRow(row, false));
+    for (const auto& row : dfa.TransitionTable)
+        newTable.push_back(getRow(row, true));
+
+    TransitionTable.swap(newTable);
+    CharTable.swap(newCharTable);
+    WideCharClasses.swap(newWideCharClasses);
+
+    // Append the source DFAs accept states
+    AcceptStates.insert(AcceptStates.end(), dfa.AcceptStates.begin(), dfa.AcceptStates.end());
+
     // *** Expression
 
     // Convert source expression start states
@@ -237,6 +343,8 @@ bool DFAGen::Combine(DFAGen& dfa) {
         ExpressionStartStates[exprCount + i] =
             dfa.ExpressionStartStates[i] + newStartState;
 
+    UpdateTransitionTable();
+
     // Free data in source
     dfa.Destroy();
 
@@ -245,6 +353,179 @@ bool DFAGen::Combine(DFAGen& dfa) {
 }
 
 
+// Sets the keywords left out of the DFA, and creates their minimal perfect hash table
+// The buckets are placed starting from the largest one, each with the first displacement
+// taking all its keys to free slots; the buckets of a single key take any free slot
+// Table data remains unchanged in case of exceptions (strong exception safety is provided)
+void DFAGen::SetKeywords(const std::vector<Keyword>& keywords) {
+    SG_ASSERT(IsValid());
+
+    // Keys must be unique; the latest lexeme takes precedence, as in the DFA
+    std::map<std::pair<unsigned, String>, unsigned> keywordMap;
+    for (const auto& [lexeme, matchLexeme, text] : keywords) {
+        auto& mapLexeme = keywordMap[{matchLexeme, text}];
+        mapLexeme       = std::max(mapLexeme, lexeme);
+    }
+
+    const auto               count = keywordMap.size();
+    std::vector<KeywordInfo> newInfos(count);
+    std::vector<int32_t>     newDisplacements(count, 0);
+    String                   newText;
+    std::vector<uint8_t>     newOwners;
+
+    if (count != 0u) {
+        std::vector<KeywordInfo>         keys;
+        std::vector<std::vector<size_t>> buckets(count);
+        newOwners.resize(LexemeInfos.size(), 0u);
+        for (const auto& [key, lexeme] : keywordMap) {
+            const auto& [matchLexeme, text] = key;
+            buckets[KeywordTable::Hash(matchLexeme, text.data(), text.size(), 0u) % count]
+                .push_back(keys.size());
+            keys.push_back({lexeme, matchLexeme, uint32_t(newText.size()),
+                            uint32_t(text.size())});
+            newText += text;
+            newOwners[matchLexeme] = 1u;
+        }
+
+        std::vector<size_t> order(count);
+        std::iota(order.begin(), order.end(), size_t(0u));
+        std::stable_sort(order.begin(), order.end(), [&](size_t bucket1, size_t bucket2) {
+            return buckets[bucket1].size() > buckets[bucket2].size();
+        });
+
+        std::vector<bool>   usedSlots(count, false);
+        std::vector<size_t> slots;
+        size_t              freeSlot = 0u;
+        const auto getKeySlot = [&](size_t key, uint32_t displacement) {
+            return KeywordTable::Hash(keys[key].MatchLexeme, &newText[keys[key].TextOffset],
+                                      keys[key].TextSize, displacement) % count;
+        };
+
+        for (const auto ibucket : order) {
+            const auto& bucket = buckets[ibucket];
+            if (bucket.empty())
+                break;
+
+            slots.clear();
+            if (bucket.size() == 1u) {
+                while (usedSlots[freeSlot])
+                    ++freeSlot;
+                slots.push_back(freeSlot);
+                newDisplacements[ibucket] = -int32_t(freeSlot) - 1;
+            } else {
+                // Keys are unique, so some displacement always separates them
+                for (uint32_t displacement = 1u; slots.size() != bucket.size(); ++displacement) {
+                    slots.clear();
+                    for (const auto key : bucket) {
+                        const auto slot = getKeySlot(key, displacement);
+                        if (usedSlots[slot] ||
+                            std::find(slots.begin(), slots.end(), slot) != slots.end())
+                            break;
+                        slots.push_back(slot);
+                    }
+                    newDisplacements[ibucket] = int32_t(displacement);
+                }
+            }
+
+            for (size_t i = 0u; i < bucket.size(); ++i) {
+                newInfos[slots[i]]  = keys[bucket[i]];
+                usedSlots[slots[i]] = true;
+            }
+        }
+    }
+
+    KeywordInfos.swap(newInfos);
+    KeywordDisplacements.swap(newDisplacements);
+    KeywordText.swap(newText);
+    KeywordOwners.swap(newOwners);
+    AttachOwnedTables();
+}
+
+
+// Creates the pair transitions of the states where they save lookups
+// States are taken in the breadth-first order from the expression start states, so that
+// the states reached first in the lexemes get the rows while the entries are within budget
+// Self-looping states are left out, since their bytes are skipped in bulk; pairs through
+// such a state are not taken at once either, so that the skipping continues after them
+// Identical rows are stored once
+// The pair transitions hold 16-bit states, so the DFAs with more states get no rows
+// Table data remains unchanged in case of exceptions (strong exception safety is provided)
+size_t DFAGen::CreatePairTable(size_t maxEntries) {
+    SG_ASSERT(IsValid());
+
+    const auto width    = TableWidth + 1u;
+    const auto rowSize  = width * width;
+    const auto getState = [this](unsigned state, size_t column) {
+        const auto next = column < TableWidth ? TransitionLookup[pRowOffsets[state] + column]
+                                              : EmptyTransition;
+        return next != EmptyTransition ? next : EmptyPairState;
+    };
+    const auto isLooping = [this](unsigned state) {
+        return GetSelfLoopExitSet(state) != nullptr;
+    };
+
+    std::vector<uint32_t> newTransitions;
+    std::vector<uint32_t> newRowOffsets(GetStateCount(), NoPairRow);
+    size_t                rowCount = 0u;
+
+    if (rowSize <= maxEntries && GetStateCount() < EmptyPairState) {
+        // Breadth-first state order
+        std::vector<unsigned> order;
+        std::vector<bool>     visited(GetStateCount(), false);
+        for (const unsigned state : ExpressionStartStates)
+            if (!visited[state]) {
+                visited[state] = true;
+                order.push_back(state);
+            }
+        for (size_t i = 0u; i < order.size(); ++i)
+            for (size_t column = 0u; column < TableWidth; ++column)
+                if (const auto next = getState(order[i], column);
+                    next != EmptyPairState && !visited[next]) {
+                    visited[next] = true;
+                    order.push_back(next);
+                }
+
+        std::map<std::vector<uint32_t>, uint32_t> rowMap;
+        std::vector<uint32_t>                     row(rowSize);
+        for (const auto state : order) {
+            if (isLooping(state))
+                continue;
+
+            bool profitable = false;
+            for (size_t column1 = 0u; column1 < width; ++column1) {
+                const auto middle = getState(state, column1);
+                for (size_t column2 = 0u; column2 < width; ++column2) {
+                    const auto last = middle == EmptyPairState || isLooping(middle)
+                                          ? EmptyPairState
+                                          : getState(middle, column2);
+                    row[column1 * width + column2] = middle | (last << 16u);
+                    profitable = profitable || last != EmptyPairState;
+                }
+            }
+            if (!profitable)
+                continue;
+
+            if (const auto irow = rowMap.find(row); irow != rowMap.end()) {
+                newRowOffsets[state] = irow->second;
+            } else if (newTransitions.size() + rowSize <= maxEntries) {
+                newRowOffsets[state] = uint32_t(newTransitions.size());
+                rowMap.emplace(row, newRowOffsets[state]);
+                newTransitions.insert(newTransitions.end(), row.begin(), row.end());
+            } else
+                continue;
+            ++rowCount;
+        }
+    }
+
+    if (newTransitions.empty())
+        newRowOffsets.clear();
+    PairTransitions.swap(newTransitions);
+    PairRowOffsets.swap(newRowOffsets);
+    AttachOwnedTables();
+    return rowCount;
+}
+
+
 // *** Internal functions
 
 // TestString -- tests a string against the DFA
@@ -253,11 +534,9 @@ unsigned DFAGen::TestString(const String& str) const {
     unsigned state = 0u;
 
     for (const auto ch: str) {
-        // Test for character out of bounds, if it is - match fails
-        if (!CharTable.HasValue(ch))
-            return 0u;
         // If the transition state is empty than match fails
-        state = GetTransitionState(state, ch);
+        // (characters out of bounds have no transitions)
+        state = GetTransitionState(state, uint8_t(ch));
         if (state == EmptyTransition)
             return 0u;
     }
@@ -273,27 +552,26 @@ size_t DFAGen::Compress([[maybe_unused]] unsigned tableType, unsigned compressTy
     if (compressType & CT_CombineDuplicate) {
         // Map the indexes from the old set to the new one
         // (keep inverse map for new table creation)
-        std::map<StateType, StateType>      match;
-        std::map<StateType, StateType>      invmatch;
+        std::map<ClassType, ClassType>      match;
+        std::map<ClassType, ClassType>      invmatch;
         // New transition table and character index set
         std::vector<std::vector<StateType>> newTable;
-        std::set<StateType>                 newSet;
+        std::set<ClassType>                 newSet;
 
-        for (StateType icharSet = 0u; icharSet < StateType(TransitionTable[0u].size());
+        for (ClassType icharSet = 0u; icharSet < ClassType(TransitionTable[0u].size());
              ++icharSet) {
             if (match.find(icharSet) != match.end())
                 continue;
 
             // Add new transition set and set the match states
-            const auto newSetCount = StateType(newSet.size());
+            const auto newSetCount = ClassType(newSet.size());
             match[icharSet]        = newSetCount;
             invmatch[newSetCount]  = icharSet;
             newSet.insert(icharSet);
 
-            for (const auto& [_, value]: CharTable) {
-                const auto index = StateType(value);
-
-                if (index <= icharSet || match.find(index) != match.end())
+            for (auto index = ClassType(icharSet + 1u);
+                 index < ClassType(TransitionTable[0u].size()); ++index) {
+                if (match.find(index) != match.end())
                     continue;
 
                 // Test to see if the two transition tables are the same
@@ -317,12 +595,24 @@ size_t DFAGen::Compress([[maybe_unused]] unsigned tableType, unsigned compressTy
             newTable[istate].resize(newSet.size());
             for (size_t icharSet = 0u; icharSet < newSet.size(); ++icharSet)
                 newTable[istate][icharSet] =
-                    TransitionTable[istate][invmatch[StateType(icharSet)]];
+                    TransitionTable[istate][invmatch[ClassType(icharSet)]];
         }
 
         // Store the character
-        for (auto& [_, value]: CharTable)
-            value = unsigned(match[StateType(value)]);
+        for (auto&& [_, value]: CharTable)
+            value = match[value];
+
+        // Store the wide character classes, merging the adjacent ranges of the same class
+        std::vector<WideCharClass> newWideCharClasses;
+        for (const auto& wideClass : WideCharClasses) {
+            const auto newClass = match[wideClass.Class];
+            if (!newWideCharClasses.empty() && newWideCharClasses.back().Class == newClass &&
+                newWideCharClasses.back().To + 1u == wideClass.From)
+                newWideCharClasses.back().To = wideClass.To;
+            else
+                newWideCharClasses.push_back({wideClass.From, wideClass.To, newClass});
+        }
+        WideCharClasses.swap(newWideCharClasses);
 
         // Update the Transition table to the new (compressed) table
         TransitionTable.swap(newTable);
@@ -355,6 +645,8 @@ size_t DFAGen::Compress([[maybe_unused]] unsigned tableType, unsigned compressTy
         result = 1u;
     }
 
+    UpdateTransitionTable();
+
     return result;
 }
 
@@ -365,12 +657,38 @@ bool DFAGen::CreateStaticDFA(String& str, const String& name, const String& name
     if (!IsValid())
         return false;
 
+    // Number of values per line for the one-dimensional tables
     static constexpr size_t asRowCount = 10u;
+    static constexpr size_t ctRowCount = 16u;
 
-    const auto tableWidth      = TransitionTable[0u].size();
-    const auto tableHeight     = TransitionTable.size();
+    const auto tableWidth      = TableWidth;
+    const auto tableHeight     = GetStateCount();
+    const auto rowCount        = Transitions.size() / tableWidth;
     const auto lexemeCount     = LexemeInfos.size();
     const auto expressionCount = ExpressionStartStates.size();
+    const auto selfLoopCount   = SelfLoopExitSets.size();
+
+    // The tables of states are written with the narrowest entries the states fit in
+    const auto stateSize   = GetStaticStateSize();
+    const auto stateType   = stateSize == sizeof(uint8_t)  ? "uint8_t"  :
+                             stateSize == sizeof(uint16_t) ? "uint16_t" : "uint32_t";
+    // Formats a state entry, with EmptyTransition cut down to the all ones entry
+    const auto formatState = [stateSize](unsigned state) {
+        const auto digits = int(stateSize * 2u);
+        return StringWithFormat("0x%0*X", digits,
+                                state & (EmptyTransition >> (32u - unsigned(digits) * 4u)));
+    };
+
+    // Adds count values to dest, rowSize values per line
+    const auto addValues = [](String& dest, size_t count, size_t rowSize, auto formatValue) {
+        for (size_t i = 0u; i < count; ++i) {
+            if (i != 0u)
+                dest += ",";
+            dest += i % rowSize == 0u ? "\n    " : " ";
+            dest += formatValue(i);
+        }
+        dest += "\n};\n\n";
+    };
 
     String dest;
 
@@ -385,16 +703,17 @@ bool DFAGen::CreateStaticDFA(String& str, const String& name, const String& name
 
     // *** Add the Transition static data
 
-    dest += StringWithFormat("static uint16_t %s_TransitionTable[%zu][%zu] =\n{",
-                             name.data(), tableHeight, tableWidth);
+    dest += StringWithFormat("static const %s %s_TransitionTable[%zu][%zu] =\n{",
+                             stateType, name.data(), rowCount, tableWidth);
 
-    // Go through all the transitions and add them
+    // Go through all the stored rows and add them
+    // States without transitions share the last (dead) row
     auto sepV = "\n";
-    for (const auto& row: TransitionTable) {
+    for (size_t row = 0u; row < rowCount; ++row) {
         dest += sepV + String{"    {"};
         auto sepH = "";
-        for (const unsigned state: row) {
-            dest += sepH + StringWithFormat("0x%04X", state);
+        for (size_t i = 0u; i < tableWidth; ++i) {
+            dest += sepH + formatState(Transitions[row * tableWidth + i]);
             sepH = ", ";
         }
         dest += "}";
@@ -402,30 +721,27 @@ bool DFAGen::CreateStaticDFA(String& str, const String& name, const String& name
     }
     dest += "\n};\n\n";
 
+    // *** Add the row offsets of the states
+
+    dest += StringWithFormat("static const uint32_t %s_RowOffsets[%zu] =\n{",
+                             name.data(), tableHeight);
+    addValues(dest, tableHeight, asRowCount,
+              [&](size_t i) { return StringWithFormat("%u", RowOffsets[i]); });
+
     // *** Add the AcceptStates static data
 
-    dest += StringWithFormat("static uint16_t %s_AcceptStates[%zu] =\n{",
+    dest += StringWithFormat("static const uint16_t %s_AcceptStates[%zu] =\n{",
                              name.data(), tableHeight);
-    // Go through all the accept states and add them
-    size_t i = 0u;
-    auto sep = "";
-    for (const unsigned state: AcceptStates) {
-        dest += sep;
-        if (i % asRowCount == 0u && i != tableHeight)
-            dest += "\n    ";
-        dest += StringWithFormat("0x%04X", state);
-        sep = ", ";
-        ++i;
-    }
-    dest += "\n};\n\n";
+    addValues(dest, tableHeight, asRowCount,
+              [&](size_t i) { return StringWithFormat("0x%04X", unsigned(AcceptStates[i])); });
 
     // *** Add the Lexeme Info static data
 
-    dest += StringWithFormat("static SGParser::LexemeInfo %s_LexemeInfos[%zu] =\n{",
+    dest += StringWithFormat("static const SGParser::LexemeInfo %s_LexemeInfos[%zu] =\n{",
                              name.data(), lexemeCount);
 
     // Go through all the accept states and add them
-    sep = "";
+    auto sep = "";
     for (const auto& [tokenCode, action]: LexemeInfos) {
         dest += sep + StringWithFormat("\n    {%u, SGParser::LexemeInfo::", tokenCode);
 
@@ -448,8 +764,8 @@ bool DFAGen::CreateStaticDFA(String& str, const String& name, const String& name
 
     // *** Add the Expression static data
 
-    dest += StringWithFormat("static uint16_t %s_ExpressionStartStates[%zu] =\n{\n    ",
-                             name.data(), expressionCount);
+    dest += StringWithFormat("static const %s %s_ExpressionStartStates[%zu] =\n{\n    ",
+                             stateType, name.data(), expressionCount);
 
     // Go through all the accept states and add them
     sep = "";
@@ -459,40 +775,102 @@ bool DFAGen::CreateStaticDFA(String& str, const String& name, const String& name
     }
     dest += "\n};\n\n";
 
-    // *** Character table
+    // *** Character table (dense, a column for every byte value)
+
+    dest += StringWithFormat("static const uint16_t %s_CharTable[%zu] =\n{",
+                             name.data(), CharTableType::Size);
+    addValues(dest, CharTableType::Size, ctRowCount,
+              [&](size_t i) {
+                  return StringWithFormat("0x%04X", unsigned(CharTable.GetValue(i)));
+              });
+
+    // *** Self-loop exit sets
+
+    dest += StringWithFormat("static const %s %s_SelfLoopIndices[%zu] =\n{",
+                             stateType, name.data(), tableHeight);
+    addValues(dest, tableHeight, asRowCount,
+              [&](size_t i) { return formatState(SelfLoopIndices[i]); });
+
+    if (selfLoopCount > 0u) {
+        dest += StringWithFormat("static const SGParser::ByteScanSet %s_SelfLoopExitSets[%zu] =\n{",
+                                 name.data(), selfLoopCount);
+        // Every set is written out as a 256-bit map of the member bytes
+        addValues(dest, selfLoopCount, 1u, [&](size_t i) {
+            uint64_t bits[4u] = {};
+            for (unsigned byte = 0u; byte < unsigned(ByteScanSet::Size); ++byte)
+                if (SelfLoopExitSets[i].Contains(uint8_t(byte)))
+                    bits[byte / 64u] |= uint64_t(1u) << (byte % 64u);
+            return StringWithFormat("SGParser::ByteScanSet{0x%016llXull, 0x%016llXull, "
+                                    "0x%016llXull, 0x%016llXull}",
+                                    (unsigned long long)bits[0u], (unsigned long long)bits[1u],
+                                    (unsigned long long)bits[2u], (unsigned long long)bits[3u]);
+        });
+    }
 
-    dest += StringWithFormat("static uint8_t %s_CharTable[%zu][2] =\n{\n",
-                             name.data(), CharTable.size());
+    // *** Wide character table (two-level, present only if any character above 0xFF is used)
 
-    // Create an ordered map from (unordered) CharTable only
-    // for the sake of pretty looking output
-    std::map<size_t, decltype(CharTable)::value_type> sortedCharTable{CharTable.begin(),
-                                                                      CharTable.end()};
-    sep = "";
-    for (const auto& [pos, value]: sortedCharTable) {
-        dest += sep + StringWithFormat("    {%zu, %u}", pos, value);
-        sep = ",\n";
+    if (WideBlockCount > 0u) {
+        dest += StringWithFormat("static const uint16_t %s_WideBlockIndices[%zu] =\n{",
+                                 name.data(), WideBlockCount);
+        addValues(dest, WideBlockCount, ctRowCount,
+                  [&](size_t i) { return StringWithFormat("%u", WideBlockIndices[i]); });
+
+        dest += StringWithFormat("static const uint16_t %s_WideBlocks[%zu] =\n{",
+                                 name.data(), WideBlocks.size());
+        addValues(dest, WideBlocks.size(), ctRowCount,
+                  [&](size_t i) { return StringWithFormat("0x%04X", unsigned(WideBlocks[i])); });
+    }
+
+    // *** Keyword tables (present only if any keywords are left out of the transition table)
+
+    if (!KeywordInfos.empty()) {
+        AddKeywordTables(dest, name);
+
+        dest += StringWithFormat("static const uint8_t %s_KeywordOwners[%zu] =\n{",
+                                 name.data(), lexemeCount);
+        addValues(dest, lexemeCount, ctRowCount,
+                  [&](size_t i) { return StringWithFormat("%u", unsigned(KeywordOwners[i])); });
+    }
+
+    // *** Pair transitions (present only if created)
+
+    if (!PairTransitions.empty()) {
+        dest += StringWithFormat("static const uint32_t %s_PairTransitions[%zu] =\n{",
+                                 name.data(), PairTransitions.size());
+        addValues(dest, PairTransitions.size(), asRowCount, [&](size_t i) {
+            return StringWithFormat("0x%08X", unsigned(PairTransitions[i]));
+        });
+
+        dest += StringWithFormat("static const uint32_t %s_PairRowOffsets[%zu] =\n{",
+                                 name.data(), tableHeight);
+        addValues(dest, tableHeight, asRowCount, [&](size_t i) {
+            return PairRowOffsets[i] == NoPairRow ? String{"0xFFFFFFFF"}
+                                                  : StringWithFormat("%u", PairRowOffsets[i]);
+        });
     }
-    dest += "\n};\n\n";
 
     // *** Add the StaticDFA structure
 
-    dest += StringWithFormat("static SGParser::StaticDFA %s =\n"
+    dest += StringWithFormat("static const SGParser::StaticDFA %s =\n"
                 "{\n"
                 "    %zuu,\n"
                 "    %zuu,\n"
+                "    %zuu,\n"
                 "    %s_TransitionTable[0u],\n"
+                "    %s_RowOffsets,\n"
                 "    %s_AcceptStates,\n"
                 "    %zuu,\n"
-                "    %s_CharTable[0u],\n"
+                "    %s_CharTable,\n"
                 "    %zuu,\n"
                 "    %s_LexemeInfos,\n"
                 "    %zuu,\n"
-                "    %s_ExpressionStartStates\n"
-                "};\n",
+                "    %s_ExpressionStartStates,\n"
+                "    %s_SelfLoopIndices,\n",
                 name.data(),
                 tableWidth,
                 tableHeight,
+                stateSize,
+                name.data(),
                 name.data(),
                 name.data(),
                 CharTable.size(),
@@ -500,8 +878,355 @@ bool DFAGen::CreateStaticDFA(String& str, const String& name, const String& name
                 lexemeCount,
                 name.data(),
                 expressionCount,
+                name.data(),
                 name.data()
     );
+    if (selfLoopCount > 0u)
+        dest += StringWithFormat("    %s_SelfLoopExitSets,\n", name.data());
+    else
+        dest += "    nullptr,\n";
+    if (WideBlockCount > 0u)
+        dest += StringWithFormat("    %zuu,\n"
+                                 "    %s_WideBlockIndices,\n"
+                                 "    %s_WideBlocks,\n",
+                                 WideBlockCount, name.data(), name.data());
+    else
+        dest += "    0u,\n"
+                "    nullptr,\n"
+                "    nullptr,\n";
+    if (!KeywordInfos.empty())
+        dest += StringWithFormat("    {%zuu, %s_Keywords, %s_KeywordDisplacements, "
+                                 "%s_KeywordText},\n"
+                                 "    %s_KeywordOwners,\n",
+                                 KeywordInfos.size(), name.data(), name.data(), name.data(),
+                                 name.data());
+    else
+        dest += "    {0u, nullptr, nullptr, nullptr},\n"
+                "    nullptr,\n";
+    if (!PairTransitions.empty())
+        dest += StringWithFormat("    %s_PairTransitions,\n"
+                                 "    %s_PairRowOffsets\n};\n",
+                                 name.data(), name.data());
+    else
+        dest += "    nullptr,\n"
+                "    nullptr\n};\n";
+
+    // Close namespace declaration of needed
+    if (!namespaceName.empty())
+        dest += "\n} // namespace " + namespaceName + "\n";
+
+    str.swap(dest);
+
+    return true;
+}
+
+
+bool DFAGen::CreateScanner(String& str, const String& name, const String& namespaceName) const {
+    // The DFA must be valid
+    if (!IsValid())
+        return false;
+
+    static constexpr size_t caseRowCount = 8u;
+
+    const auto stateCount = GetStateCount();
+
+    // States which are entered by a transition and states which start an expression
+    // Only the labels which are referenced are emitted
+    std::vector<bool> isTarget(stateCount, false), isStart(stateCount, false);
+    for (const unsigned state: ExpressionStartStates)
+        isStart[state] = true;
+    for (size_t state = 0u; state < stateCount; ++state) {
+        for (unsigned ch = 0u; ch < CharTableType::Size; ++ch)
+            if (const auto next = GetTransitionState(unsigned(state), ch); next != EmptyTransition)
+                isTarget[next] = true;
+        for (const auto& wideClass : WideCharClasses)
+            if (const auto next = GetTransitionState(unsigned(state), wideClass.From);
+                next != EmptyTransition)
+                isTarget[next] = true;
+    }
+
+    String dest;
+
+    // *** Add the includes
+
+    dest += "#include \"Tokenizer.h\"\n\n#include <vector>\n\n";
+
+    // *** Add namespace declaration if needed
+
+    if (!namespaceName.empty())
+        dest += "namespace " + namespaceName + "\n{\n\n";
+
+    // *** Keyword tables (present only if any keywords are left out of the transition table)
+
+    const auto hasKeywords = !KeywordInfos.empty();
+    if (hasKeywords) {
+        AddKeywordTables(dest, name);
+        dest += StringWithFormat("static const SGParser::KeywordTable %s_KeywordTable =\n"
+                                 "{\n"
+                                 "    %zuu,\n"
+                                 "    %s_Keywords,\n"
+                                 "    %s_KeywordDisplacements,\n"
+                                 "    %s_KeywordText\n"
+                                 "};\n\n",
+                                 name.data(), KeywordInfos.size(), name.data(), name.data(),
+                                 name.data());
+    }
+
+    // *** Add the class declaration
+
+    dest += StringWithFormat(
+        "// Direct-coded tokenizer generated from the DFA\n"
+        "template <class Token>\n"
+        "class %s : public SGParser::TokenizerImpl<Token>\n"
+        "{\n"
+        "public:\n"
+        "    // Default constructor\n"
+        "    %s() = default;\n"
+        "\n"
+        "    // Initialization constructor\n"
+        "    explicit %s(SGParser::InputStream* pinputStream) { Create(pinputStream); }\n"
+        "\n"
+        "    // Initializes the tokenizer to use a specified input stream\n"
+        "    bool Create(SGParser::InputStream* pinputStream) {\n"
+        "        if (!SetInputStream(pinputStream))\n"
+        "            return false;\n"
+        "        ExpressionStackTop = 0u;\n"
+        "        ExpressionStack.clear();\n"
+        "        return true;\n"
+        "    }\n"
+        "\n"
+        "    // *** Token Stream interface\n"
+        "\n"
+        "    // Return next token / EOF Token\n"
+        "    Token& GetNextToken(Token& token) override;\n"
+        "\n"
+        "    // Fill in up to count tokens, stopping after EOF\n"
+        "    size_t GetTokens(Token* ptokens, size_t count) override {\n"
+        "        size_t index = 0u;\n"
+        "        while (index < count)\n"
+        "            if (%s::GetNextToken(ptokens[index++]).Code ==\n"
+        "                SGParser::TokenCode::TokenEOF)\n"
+        "                break;\n"
+        "        return index;\n"
+        "    }\n"
+        "\n"
+        "private:\n"
+        "    using CodeType = typename Token::CodeType;\n"
+        "\n"
+        "    using typename SGParser::TokenizerBase::ByteReader;\n"
+        "    using typename SGParser::TokenizerImpl<Token>::InputCharReader;\n"
+        "    using typename SGParser::TokenizerImpl<Token>::BufferPos;\n"
+        "    using typename SGParser::TokenizerImpl<Token>::PosTracker;\n"
+        "    using SGParser::TokenizerImpl<Token>::SetInputStream;\n"
+        "    using SGParser::TokenizerImpl<Token>::HeadPos;\n"
+        "    using SGParser::TokenizerImpl<Token>::TailPos;\n"
+        "    using SGParser::TokenizerImpl<Token>::GetHeadPos;\n"
+        "    using SGParser::TokenizerImpl<Token>::GetTailPos;\n"
+        "    using SGParser::TokenizerImpl<Token>::SetTailPos;\n"
+        "    using SGParser::TokenizerImpl<Token>::AdjustHead;\n"
+        "%s"
+        "\n"
+        "    unsigned              ExpressionStackTop = 0u;\n"
+        "\n"
+        "    // Expression stack, controls starting state\n"
+        "    std::vector<unsigned> ExpressionStack;\n"
+        "};\n\n",
+        name.data(), name.data(), name.data(), name.data(),
+        hasKeywords ? "    using SGParser::TokenizerImpl<Token>::FindKeyword;\n" : "");
+
+    // *** Add the GetNextToken prologue (same as in DFATokenizer)
+
+    dest += StringWithFormat(
+        "template <class Token>\n"
+        "Token& %s<Token>::GetNextToken(Token& token) {\n"
+        "    CodeType        code;\n"
+        "    InputCharReader charReader{ByteReader{*this}, TailPos};\n"
+        "\n"
+        "    do {\n"
+        "        HeadPos = TailPos;\n"
+        "        AdjustHead();\n"
+        "\n"
+        "        if (charReader.IsEOF()) {\n"
+        "            token.CopyFromTokenizer(SGParser::TokenCode::TokenEOF, *this);\n"
+        "            return token;\n"
+        "        }\n"
+        "\n"
+        "        // Lexeme 0 means nothing has been recognized yet\n"
+        "        unsigned   lastLexemeID = 0u;\n"
+        "        BufferPos  lastTail;\n"
+        "        BufferPos  startHead{GetHeadPos()};\n"
+        "        PosTracker lastTailPos{TailPos};\n"
+        "        bool       advanced;\n"
+        "\n"
+        "        switch (ExpressionStackTop) {\n",
+        name.data());
+
+    for (size_t expression = 0u; expression < ExpressionStartStates.size(); ++expression)
+        dest += StringWithFormat("            case %zuu: goto Dispatch%u;\n",
+                                 expression, unsigned(ExpressionStartStates[expression]));
+    dest += "            default: goto Done;\n"
+            "        }\n";
+
+    // *** Add the states
+    // Entering a state consumes the character which led to it, records the lexeme
+    // if the state accepts and dispatches on the next character
+
+    for (size_t state = 0u; state < stateCount; ++state) {
+        if (!isTarget[state] && !isStart[state])
+            continue;
+
+        // Group the characters by the target state
+        std::map<unsigned, std::vector<unsigned>> targets;
+        for (unsigned ch = 0u; ch < CharTableType::Size; ++ch)
+            if (const auto next = GetTransitionState(unsigned(state), ch); next != EmptyTransition)
+                targets[next].push_back(ch);
+
+        // Characters above the byte range are matched by ranges, adjacent ones merged
+        std::vector<std::pair<CharRange, unsigned>> wideTargets;
+        for (const auto& wideClass : WideCharClasses) {
+            const auto next = GetTransitionState(unsigned(state), wideClass.From);
+            if (next == EmptyTransition)
+                continue;
+            if (!wideTargets.empty() && wideTargets.back().second == next &&
+                wideTargets.back().first.To + 1u == wideClass.From)
+                wideTargets.back().first.To = wideClass.To;
+            else
+                wideTargets.push_back({{wideClass.From, wideClass.To}, next});
+        }
+
+        // A state without transitions always finishes the lexeme, even at the end of input
+        const bool hasTransitions = !targets.empty() || !wideTargets.empty();
+
+        dest += "\n";
+        if (isTarget[state]) {
+            dest += StringWithFormat("    State%zu:\n", state);
+            dest += hasTransitions ? "        advanced = charReader.Advance();\n"
+                                   : "        charReader.Advance();\n";
+            if (const auto accept = GetAcceptState(unsigned(state)); accept != 0u)
+                dest += StringWithFormat("        lastLexemeID = %uu;\n"
+                                         "        lastTailPos  = TailPos;\n"
+                                         "        lastTail     = GetTailPos();\n", accept);
+            if (hasTransitions)
+                dest += "        if (!advanced)\n"
+                        "            goto Done;\n";
+        }
+        if (isStart[state])
+            dest += StringWithFormat("    Dispatch%zu:\n", state);
+
+        if (!hasTransitions) {
+            dest += "        goto Done;\n";
+            continue;
+        }
+
+        if (wideTargets.empty())
+            dest += "        switch (charReader.GetChar()) {\n";
+        else
+            dest += "        switch (const unsigned ch = charReader.GetChar(); ch) {\n";
+        for (const auto& [target, chars]: targets) {
+            for (size_t i = 0u; i < chars.size(); ++i) {
+                dest += i % caseRowCount == 0u ? "            " : " ";
+                dest += StringWithFormat("case 0x%02X:", chars[i]);
+                if (i % caseRowCount == caseRowCount - 1u || i + 1u == chars.size())
+                    dest += "\n";
+            }
+            dest += StringWithFormat("                goto State%u;\n", target);
+        }
+        dest += "            default:\n";
+        for (const auto& [range, target]: wideTargets)
+            dest += StringWithFormat("                if (ch >= 0x%04X && ch <= 0x%04X)\n"
+                                     "                    goto State%u;\n",
+                                     range.From, range.To, target);
+        dest += "                goto Done;\n"
+                "        }\n";
+    }
+
+    // *** Add the lexeme handling (same as in DFATokenizer, with the actions inlined)
+
+    dest += "\n"
+            "    Done:\n"
+            "        if (lastLexemeID == 0u) {\n"
+            "            if (charReader.IsEOF() && startHead == GetTailPos())\n"
+            "                code = SGParser::TokenCode::TokenEOF;\n"
+            "            else {\n"
+            "                SetTailPos(startHead);\n"
+            "                TailPos = HeadPos;\n"
+            "                code    = SGParser::TokenCode::TokenError;\n"
+            "                // Skip the character in error from the rewound tail\n"
+            "                if (!charReader.IsEOF())\n"
+            "                    InputCharReader{ByteReader{*this}, TailPos}.Advance();\n"
+            "            }\n"
+            "            token.CopyFromTokenizer(code, *this);\n"
+            "            return token;\n"
+            "        }\n"
+            "\n"
+            "        SetTailPos(lastTail);\n"
+            "        TailPos = lastTailPos;\n"
+            "\n";
+
+    // Only the lexemes which are accepted by some state, and the keywords, can be recognized
+    std::set<unsigned> lexemeIds{AcceptStates.begin(), AcceptStates.end()};
+    lexemeIds.erase(0u);
+
+    if (hasKeywords) {
+        dest += "        // Tell a keyword apart from the lexeme it was matched as\n"
+                "        if (";
+        auto sep = "";
+        for (const unsigned lexemeId : lexemeIds)
+            if (HasKeywords(lexemeId)) {
+                dest += sep + StringWithFormat("lastLexemeID == %uu", lexemeId);
+                sep = " ||\n            ";
+            }
+        dest += StringWithFormat(")\n"
+                                 "            lastLexemeID = FindKeyword(%s_KeywordTable, "
+                                 "lastLexemeID);\n\n",
+                                 name.data());
+        for (const auto& keyword : KeywordInfos)
+            lexemeIds.insert(keyword.Lexeme);
+    }
+
+    dest += "        switch (lastLexemeID) {\n";
+
+    for (const unsigned lexemeId: lexemeIds) {
+        const auto& [tokenCode, action] = LexemeInfos[lexemeId];
+        const auto  actionValue         = action & LexemeInfo::ActionValueMask;
+
+        dest += StringWithFormat("            case %uu:\n"
+                                 "                code = %uu;\n", lexemeId, tokenCode);
+        switch (action & LexemeInfo::ActionMask) {
+            case LexemeInfo::ActionPush:
+                dest += "                ExpressionStack.push_back(ExpressionStackTop);\n";
+                [[fallthrough]];
+
+            case LexemeInfo::ActionGoto:
+                dest += StringWithFormat("                ExpressionStackTop = %uu;\n",
+                                         actionValue);
+                break;
+
+            case LexemeInfo::ActionPop:
+                dest += "                if (ExpressionStack.empty()) {\n"
+                        "                    ExpressionStackTop = 0u;\n"
+                        "                    token.CopyFromTokenizer("
+                        "SGParser::TokenCode::TokenError, *this);\n"
+                        "                    return token;\n"
+                        "                }\n"
+                        "                ExpressionStackTop = ExpressionStack.back();\n"
+                        "                ExpressionStack.pop_back();\n";
+                break;
+        }
+        dest += "                break;\n";
+    }
+
+    dest += "            default:\n"
+            "                code = 0u;\n"
+            "                break;\n"
+            "        }\n"
+            "\n"
+            "        // if code == 0, then ignore token\n"
+            "    } while (code == 0u);\n"
+            "\n"
+            "    token.CopyFromTokenizer(code, *this);\n"
+            "    return token;\n"
+            "}\n";
 
     // Close namespace declaration of needed
     if (!namespaceName.empty())
@@ -516,12 +1241,12 @@ bool DFAGen::CreateStaticDFA(String& str, const String& name, const String& name
 size_t DFAGen::GetTableSize(TableType type) const noexcept {
     switch (type) {
         case TableType::TransitionTable:
-            return ((TransitionTable.size() - EmptyStateCount) * TransitionTable[0u].size() *
-                    sizeof(EmptyStateCount) + TransitionTable.size() *
-                    sizeof(std::vector<StateType>));
+            return Transitions.size() * sizeof(StateType) +
+                   RowOffsets.size() * sizeof(decltype(RowOffsets)::value_type) +
+                   (PairTransitions.size() + PairRowOffsets.size()) * sizeof(uint32_t);
 
         case TableType::AcceptStates:
-            return AcceptStates.size() * sizeof(StateType);
+            return AcceptStates.size() * sizeof(decltype(AcceptStates)::value_type);
     }
 
     SG_ASSERT(false);
@@ -529,6 +1254,90 @@ size_t DFAGen::GetTableSize(TableType type) const noexcept {
 }
 
 
+// Adds the static keyword table arrays
+void DFAGen::AddKeywordTables(String& dest, const String& name) const {
+    static constexpr size_t displacementRowCount = 10u;
+
+    const auto count = KeywordInfos.size();
+
+    dest += StringWithFormat("static const SGParser::KeywordInfo %s_Keywords[%zu] =\n{",
+                             name.data(), count);
+    auto sep = "\n";
+    for (const auto& [lexeme, matchLexeme, textOffset, textSize] : KeywordInfos) {
+        dest += sep + StringWithFormat("    {%u, %u, %u, %u}",
+                                       lexeme, matchLexeme, textOffset, textSize);
+        sep = ",\n";
+    }
+    dest += "\n};\n\n";
+
+    dest += StringWithFormat("static const int32_t %s_KeywordDisplacements[%zu] =\n{",
+                             name.data(), count);
+    for (size_t i = 0u; i < count; ++i) {
+        if (i != 0u)
+            dest += ",";
+        dest += i % displacementRowCount == 0u ? "\n    " : " ";
+        dest += StringWithFormat("%d", KeywordDisplacements[i]);
+    }
+    dest += "\n};\n\n";
+
+    // The text is written out a keyword per line, in the text order
+    std::vector<const KeywordInfo*> textOrder;
+    for (const auto& keyword : KeywordInfos)
+        textOrder.push_back(&keyword);
+    std::sort(textOrder.begin(), textOrder.end(),
+              [](const KeywordInfo* pkeyword1, const KeywordInfo* pkeyword2) {
+                  return pkeyword1->TextOffset < pkeyword2->TextOffset;
+              });
+
+    dest += StringWithFormat("static const char %s_KeywordText[] =", name.data());
+    for (const auto pkeyword : textOrder) {
+        dest += "\n    \"";
+        for (uint32_t i = 0u; i < pkeyword->TextSize; ++i) {
+            const auto ch = uint8_t(KeywordText[pkeyword->TextOffset + i]);
+            if (ch == '"' || ch == '\\')
+                dest += StringWithFormat("\\%c", ch);
+            else if (ch >= 0x20u && ch < 0x7Fu)
+                dest += char(ch);
+            else
+                dest += StringWithFormat("\\%03o", unsigned(ch));
+        }
+        dest += "\"";
+    }
+    dest += ";\n\n";
+}
+
+
+// Rebuilds the runtime transition table from the construction rows
+void DFAGen::UpdateTransitionTable() {
+    size_t width = 0u;
+    for (const auto& row: TransitionTable)
+        width = std::max(width, row.size());
+    AssignTransitionTable(TransitionTable, width);
+    AssignWideCharTable(WideCharClasses);
+    // Pair transitions are created from the final table
+    PairTransitions.clear();
+    PairRowOffsets.clear();
+    AttachOwnedTables();
+    FindSelfLoops();
+}
+
+
+// Returns the first wide character class ending at or after the character
+std::vector<DFA::WideCharClass>::const_iterator DFAGen::FindWideCharClass(unsigned ch) const {
+    return std::lower_bound(WideCharClasses.begin(), WideCharClasses.end(), ch,
+                            [](const WideCharClass& wideClass, unsigned value) {
+                                return wideClass.To < value;
+                            });
+}
+
+
+// Returns the class of a wide character, EmptyClass if it has none
+DFA::ClassType DFAGen::GetWideCharClass(unsigned ch) const {
+    const auto iclass = FindWideCharClass(ch);
+    return iclass != WideCharClasses.end() && iclass->From <= ch ? iclass->Class : EmptyClass;
+}
+
+
 // Computes the epsilon closure of a set of nodes. This is a set of nodes that
 // can be reached with epsilon (empty) links alone
 void DFAGen::EpsilonClosure(std::vector<NFANode*>& setOfStates) {
@@ -537,8 +1346,8 @@ void DFAGen::EpsilonClosure(std::vector<NFANode*>& setOfStates) {
         const auto node = setOfStates[pos];
 
         // For epsilon all character links
-        for (size_t i = 0u; i < node->LinkChar.size(); ++i)
-            if (node->LinkChar[i] == NFANode::Epsilon) {
+        for (size_t i = 0u; i < node->LinkRange.size(); ++i)
+            if (node->LinkRange[i].From == NFANode::Epsilon) {
                 const auto pLinkNode = node->LinkPtr[i];
 
                 // Is node already added? If not added, add node
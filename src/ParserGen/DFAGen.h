@@ -9,7 +9,6 @@
 #include "DFA.h"
 #include "ParseMessage.h"
 #include "Lexeme.h"
-#include "MappedTable.h"
 
 #include <vector>
 
@@ -44,6 +43,18 @@ public:
 };
 
 
+// ***** Keyword found by Lex
+
+// Literal lexeme which is left out of the DFA, since the DFA recognizes its text
+// as a more general lexeme (see DFA::HasKeywords)
+struct Keyword final
+{
+    unsigned Lexeme;
+    unsigned MatchLexeme;
+    String   Text;
+};
+
+
 // ***** DFAGen Class declaration
 
 class DFAGen final : public DFA
@@ -58,6 +69,9 @@ public:
     static constexpr unsigned CT_RemoveEmpty      = 0x01;
     static constexpr unsigned CT_CombineDuplicate = 0x02;
 
+    // Default budget of the pair transition entries (see CreatePairTable)
+    static constexpr size_t   DefaultMaxPairEntries = 16384u;
+
 public:
     // Creates an empty DFA
     DFAGen() = default;
@@ -71,6 +85,9 @@ public:
     // Creates a DFA from an NFA
     bool     Create(const NFA& nfa, const std::vector<Lexeme>& lexemes, unsigned maxChar = 0u);
 
+    // Destroy the DFA and reset it to empty
+    void     Destroy() noexcept;
+
     // Compress the DFA data
     // Returns the new set size
     size_t   Compress(unsigned tableType, unsigned compressionType);
@@ -79,6 +96,17 @@ public:
     // Source DFA is emptied
     bool     Combine(DFAGen& sourceDFA);
 
+    // Sets the keywords left out of the DFA, and creates their perfect hash table
+    // Must be called after the DFA is created
+    void     SetKeywords(const std::vector<Keyword>& keywords);
+
+    // Creates the pair transitions (see DFA::GetPairTransition), taking two bytes at a time,
+    // for the states where they save lookups, with up to maxEntries entries in total
+    // Every pair row has (TableWidth + 1)^2 entries, so the character classes should be
+    // combined first (see CT_CombineDuplicate); no rows are created if a row exceeds the budget
+    // Must be called after the DFA is complete; returns the number of states with pair rows
+    size_t   CreatePairTable(size_t maxEntries = DefaultMaxPairEntries);
+
     // Tests the string against the DFA
     // Return LexemeID for match, 0 otherwise
     unsigned TestString(const String& str) const;
@@ -95,10 +123,24 @@ public:
     // Returns the list (buffer) of processing messages (errors, warnings, etc.)
     ParseMessageBuffer& GetMessageBuffer() noexcept { return Messages; }
 
+    // Return the size of the state entries of the static DFA: the narrowest one the states
+    // fit in, with the all ones entry left for EmptyTransition (see DFA::StateTable)
+    size_t   GetStaticStateSize() const noexcept {
+        const auto stateCount = GetStateCount();
+        return stateCount <= 0xFFu   ? sizeof(uint8_t)  :
+               stateCount <= 0xFFFFu ? sizeof(uint16_t) : sizeof(uint32_t);
+    }
+
     // Create a static DFA structure
     bool     CreateStaticDFA(String& str, const String& name,
                              const String& namespaceName = String{}) const;
 
+    // Create a direct-coded tokenizer class (a template on the token type)
+    // Every state becomes a labelled block switching on the next character,
+    // and the lexeme actions are inlined, so the class does not need DFA tables
+    bool     CreateScanner(String& str, const String& name,
+                           const String& namespaceName = String{}) const;
+
 private:
     friend class Lex;
 
@@ -107,13 +149,31 @@ private:
 
     size_t             EmptyStateCount = 0u;
 
+    // Transition table rows used during construction
+    // The runtime (flat) table is rebuilt from them by UpdateTransitionTable
+    TransitionRows     TransitionTable;
+    // Classes of the characters above the byte range, as sorted disjoint ranges
+    // The runtime (two-level) table is rebuilt from them by UpdateTransitionTable
+    std::vector<WideCharClass> WideCharClasses;
+
     // Calculates a set of states that can be accessed by
     // epsilon (empty) links from a given set of states
     void     EpsilonClosure(std::vector<NFANode*>& setOfStates);
 
     void     SetTransitionState(unsigned state, unsigned ch, unsigned value) {
-        TransitionTable[state][GetCharIndex(ch)] = StateType(value);
+        TransitionTable[state][CharTable.GetValue(ch)] = StateType(value);
     }
+
+    // Returns the first wide character class ending at or after the character
+    std::vector<WideCharClass>::const_iterator FindWideCharClass(unsigned ch) const;
+    // Returns the class of a wide character, EmptyClass if it has none
+    ClassType GetWideCharClass(unsigned ch) const;
+
+    // Rebuilds the runtime transition table from the construction rows
+    void     UpdateTransitionTable();
+
+    // Adds the static keyword table arrays (for both the static DFA and the scanner)
+    void     AddKeywordTables(String& dest, const String& name) const;
 };
 
 } // namespace Generator
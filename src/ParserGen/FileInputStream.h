@@ -6,6 +6,7 @@
 #define INC_SGPARSER_GENERATOR_FILE_INPUT_STREAM_H
 
 #include "SGStream.h"
+#include "MappedFileInputStream.h"
 
 #include <fstream>
 #include <filesystem>
@@ -16,6 +17,8 @@ namespace Generator
 {
 
 // Implementation of the SGParser input stream interface that allows to use standard file stream
+// The file can optionally be memory-mapped, so that its data is provided as contiguous
+// input and tokenized in place; the standard file stream is used if mapping fails
 class FileInputStream final : public InputStream
 {
 public:
@@ -26,12 +29,17 @@ public:
     FileInputStream& operator=(const FileInputStream&)     = delete;
     FileInputStream& operator=(FileInputStream&&) noexcept = delete;
 
-    bool Open(const std::filesystem::path& fileName) {
+    // NOTE: Mapped files are read as binary, no text-mode newline conversion is done
+    bool Open(const std::filesystem::path& fileName, bool mapped = false) {
+        if (mapped && mappedStream.Open(fileName.string()))
+            return true;
         fileStream.open(fileName.string(), std::fstream::in);
         return fileStream.is_open();
     }
 
     StreamSize Read(uint8_t* pBuffer, StreamSize numBytes) override {
+        if (mappedStream.IsOpen())
+            return mappedStream.Read(pBuffer, numBytes);
         if (fileStream.is_open()) {
             fileStream.read(reinterpret_cast<char*>(pBuffer),
                             static_cast<std::streamsize>(numBytes));
@@ -41,12 +49,18 @@ public:
     }
 
     bool Close() override {
+        mappedStream.Close();
         fileStream.close();
         return !fileStream.is_open();
     }
 
+    const uint8_t* GetContiguousData(size_t& size) noexcept override {
+        return mappedStream.GetContiguousData(size);
+    }
+
 private:
-    std::ifstream fileStream;
+    MappedFileInputStream mappedStream;
+    std::ifstream         fileStream;
 };
 
 } // namespace Generator
@@ -8,6 +8,8 @@
 #include "Grammar.h"
 #include "Lex.h"
 
+#include <algorithm>
+
 namespace SGParser
 {
 namespace Generator
@@ -398,7 +400,7 @@ struct Conflict final
 struct MakeTableData final
 {
     ParseTableGen&                                   Table;
-    std::vector<uint16_t*>&                          ActionTable;
+    std::vector<uint32_t*>&                          ActionTable;
     std::vector<std::vector<ParseTableProduction>*>& CanonicalSet;
 };
 
@@ -691,17 +693,18 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
             if (prod.pProduction->ErrorTerminal) {
                 // If Error Terminal, mark this production as possibly throwing an error
                 table.ReduceProductions[prod.pProduction->Id].ErrorTerminalFlag = uint32_t(1u);
-                // And record error value in a map for corresponding nonterminal
-                table.ProductionErrorTerminals[prod.pProduction->Id |
-                                                (prod.pProduction->Left << 16u)] =
-                    prod.pProduction->ErrorTerminal;
+                // And record error value for corresponding nonterminal
+                table.ProductionErrorTerminals.push_back(
+                    {ParseTable::GetProductionErrorKey(prod.pProduction->Id,
+                                                       prod.pProduction->Left),
+                     prod.pProduction->ErrorTerminal});
             }
         }
 
     // Construct the canonical set
     std::vector<std::vector<ParseTableProduction>*> canonicalSet;
-    std::vector<uint16_t*>                          actionTable;
-    std::vector<uint16_t*>                          gotoTable;
+    std::vector<uint32_t*>                          actionTable;
+    std::vector<uint32_t*>                          gotoTable;
     // Keep track of 'source' states (that generated this state) for debug dump
     std::vector<std::set<unsigned>>                 sourceStates;
 
@@ -721,12 +724,12 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
         Closure(*pgotoSet);
         // Add item, and space for its corresponding table entries
         canonicalSet.push_back(pgotoSet);
-        actionTable.push_back(new uint16_t[maxTerminal]);
-        std::fill(actionTable[state], actionTable[state] + maxTerminal, uint16_t(0u));
-        gotoTable.push_back(new uint16_t[maxNonTerminal]);
-        std::fill(gotoTable[state], gotoTable[state] + maxNonTerminal, uint16_t(-1));
+        actionTable.push_back(new uint32_t[maxTerminal]);
+        std::fill(actionTable[state], actionTable[state] + maxTerminal, uint32_t(0u));
+        gotoTable.push_back(new uint32_t[maxNonTerminal]);
+        std::fill(gotoTable[state], gotoTable[state] + maxNonTerminal, ParseTableGen::EmptyGoto);
         // Store starting state in nonterminal lookup table
-        table.NonTerminals[prod.pProduction->Right(0u)].StartState = uint16_t(state);
+        table.NonTerminals[prod.pProduction->Right(0u)].StartState = uint32_t(state);
         // Source state - no source
         sourceStates.emplace_back();
     }
@@ -761,10 +764,10 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
                 v.insert(state);
                 sourceStates.push_back(v);
                 // And allocate its tables
-                actionTable.push_back(new uint16_t[maxTerminal]);
-                std::fill(actionTable[newState], actionTable[newState] + maxTerminal, uint16_t(0u));
-                gotoTable.push_back(new uint16_t[maxNonTerminal]);
-                std::fill(gotoTable[newState], gotoTable[newState] + maxNonTerminal, uint16_t(-1));
+                actionTable.push_back(new uint32_t[maxTerminal]);
+                std::fill(actionTable[newState], actionTable[newState] + maxTerminal, uint32_t(0u));
+                gotoTable.push_back(new uint32_t[maxNonTerminal]);
+                std::fill(gotoTable[newState], gotoTable[newState] + maxNonTerminal, ParseTableGen::EmptyGoto);
             } else {
                 auto& cSetItem = *canonicalSet[newState];
 
@@ -844,9 +847,9 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
                                 // next symbol would lead us to
                                 if (nextSymbol & ProductionMask::Terminal) {
                                     // Masks out the action flags
-                                    if (nextState = (unsigned(actionTable[nextState][nextSymbol &
+                                    if (nextState = unsigned(actionTable[nextState][nextSymbol &
                                                      ProductionMask::TerminalValue]) &
-                                                     ~ParseTable::ActionMask) & 0x0000'FFFFu;
+                                                     ParseTable::ExtractMask;
                                         !nextState)
                                         break;
                                 }
@@ -885,20 +888,23 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
             if (symbol & ProductionMask::Terminal)
                 // Set Shift state, if it's a terminal
                 actionTable[state][symbol & ProductionMask::TerminalValue] =
-                    uint16_t(newState | ParseTable::ShiftMask);
+                    uint32_t(newState | ParseTable::ShiftMask);
             else
                 // Set Goto state for nonterminal
                 if (!(symbol & ProductionMask::AcceptingNonTerminal))
-                    gotoTable[state][symbol] = uint16_t(newState);
+                    gotoTable[state][symbol] = uint32_t(newState);
         }
     }
 
     // Resize state information std::vector
     table.StateInfos.resize(canonicalSet.size());
+    table.DefaultReductions.assign(canonicalSet.size(), uint32_t(0u));
 
     // *** Set Reduce actions for the state
 
     std::vector<Conflict> conflicts;
+    // States with non associative operators turned into errors, which must see the lookahead
+    std::vector<bool>     nonAssocErrors(canonicalSet.size(), false);
 
     // This can not be done in a previous look for LALR,
     // because extra look ahead can be added to a state after it is processed
@@ -908,6 +914,7 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
         // Initialize state information
         table.StateInfos[state].Record           = uint8_t(0u);
         table.StateInfos[state].BacktrackOnError = uint8_t(0u);
+        table.StateInfos[state].DefaultReduce    = uint32_t(0u);
 
         // Keep a map of which item caused a reduce for each terminal
         // This way we can lookup previous item in case of R-R conflict
@@ -941,15 +948,15 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
                 const auto la        = iTerminal & ProductionMask::TerminalValue;
                 auto&      actionRef = actionTable[state][la];
 
-                if (actionRef == uint16_t(0u)) {
+                if (actionRef == uint32_t(0u)) {
                 set_reduce_action:
                     terminalItems[iTerminal] = i;
                     // If reducing by a start symbol, set Accept action
                     if (la == TokenCode::TokenEOF &&
                         (prod.pProduction->Left & ProductionMask::AcceptingNonTerminal))
-                        actionRef = uint16_t(ParseTable::AcceptValue);
+                        actionRef = uint32_t(ParseTable::AcceptValue);
                     else  // otherwise, reduce as needed
-                        actionRef = uint16_t(ParseTable::ReduceMask | prod.pProduction->Id);
+                        actionRef = uint32_t(ParseTable::ReduceMask | prod.pProduction->Id);
                 } else {
                     // Save actionRef value for report in case we change it
                     const auto oldItem = terminalItems[iTerminal];
@@ -1000,7 +1007,8 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
                                 else if (assoc == TerminalPrec::NonAssoc) {
                                     // If non associative, same operator may not appear twice
                                     // So it's an error
-                                    actionRef = uint16_t(0u);
+                                    actionRef             = uint32_t(0u);
+                                    nonAssocErrors[state] = true;
                                 }
                                 // Otherwise shift
                                 goto no_conflict_warning;
@@ -1034,10 +1042,10 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
                                 // If reducing by a start symbol, set Accept action
                                 if (la == TokenCode::TokenEOF &&
                                     prod.pProduction->Left & ProductionMask::AcceptingNonTerminal)
-                                    actionRef = uint16_t(ParseTable::AcceptValue);
+                                    actionRef = uint32_t(ParseTable::AcceptValue);
                                 else
                                     actionRef =
-                                        uint16_t(ParseTable::ReduceMask | prod.pProduction->Id);
+                                        uint32_t(ParseTable::ReduceMask | prod.pProduction->Id);
                                 goto no_conflict_warning;
                             }
                         }
@@ -1048,10 +1056,10 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
                             // If reducing by a start symbol, set Accept action
                             if (la == TokenCode::TokenEOF &&
                                 prod.pProduction->Left & ProductionMask::AcceptingNonTerminal)
-                                actionRef = uint16_t(ParseTable::AcceptValue);
+                                actionRef = uint32_t(ParseTable::AcceptValue);
                             else
                                 actionRef =
-                                    uint16_t(ParseTable::ReduceMask | prod.pProduction->Id);
+                                    uint32_t(ParseTable::ReduceMask | prod.pProduction->Id);
                         }
 
                         // See if this is a user-controlled reduction, and if so, resolve it
@@ -1145,6 +1153,48 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
         }
     }
 
+    // *** Find default reductions
+
+    // A state with a single reduce action and nothing else reduces regardless of the lookahead,
+    // so the parser can reduce in it without reading the next token. An invalid next token is
+    // then detected in the state the reduction leads to, before it is shifted
+    // This changes what the reduce callbacks see, so they are only used if requested
+    // (see ParseTableGen::SetDefaultReductions)
+    // The lookahead is still needed by the productions throwing a named error, by the empty
+    // productions going to a recording state (the marker is set after the lookahead), and by
+    // the non associative operators
+    for (state = 0u; state < canonicalSet.size(); ++state) {
+        uint32_t reduceAction = 0u;
+        for (size_t terminal = 0u; terminal < maxTerminal; ++terminal) {
+            const auto action = actionTable[state][terminal];
+            if (action == uint32_t(0u) || action == reduceAction)
+                continue;
+            if (reduceAction != uint32_t(0u) || !(action & ParseTable::ReduceMask) ||
+                action == ParseTable::AcceptValue) {
+                reduceAction = uint32_t(0u);
+                break;
+            }
+            reduceAction = action;
+        }
+        if (reduceAction == uint32_t(0u) || nonAssocErrors[state])
+            continue;
+
+        const auto& rprod = table.ReduceProductions[reduceAction & ParseTable::ExtractMask];
+        if (rprod.ErrorTerminalFlag)
+            continue;
+        if (rprod.Length == 0u) {
+            size_t gotoState = 0u;
+            for (; gotoState < canonicalSet.size(); ++gotoState) {
+                const auto target = gotoTable[gotoState][rprod.Left];
+                if (target != ParseTableGen::EmptyGoto && table.StateInfos[target].Record)
+                    break;
+            }
+            if (gotoState != canonicalSet.size())
+                continue;
+        }
+        table.DefaultReductions[state] = reduceAction;
+    }
+
     // Free the extra GotoSet
     delete pgotoSet;
 
@@ -1271,9 +1321,16 @@ bool Grammar::MakeParseTable(ParseTableGen& table, ParseTableType type) {
         Messages.AddMessage(msg);
     }
 
+    // Production error terminals are looked up by the production
+    std::sort(table.ProductionErrorTerminals.begin(), table.ProductionErrorTerminals.end(),
+              [](const auto& left, const auto& right) {
+                  return left.Production < right.Production;
+              });
+
     // Setup the table type and initial state
     table.Type         = type;
     table.InitialState = 0u;
+    table.AttachOwnedTables();
 
     // Free inverse symbols
     GrammarSymbolsInv.clear();
@@ -30,6 +30,84 @@ struct RegExprParseToken final : public TokenCode
 };
 
 
+// Marks a malformed character escape
+static constexpr unsigned InvalidRegExprChar = unsigned(-1);
+
+// Reads the character escaped by a backslash and converts it into the character code
+// Besides the special characters, \uXXXX and \UXXXXXXXX give the character code in
+// hexadecimal (i.e. a Unicode code point); a malformed code gives InvalidRegExprChar
+unsigned ReadEscapedChar(TokenStream<RegExprParseToken>& stream) {
+    RegExprParseToken token;
+    const auto        ch = stream.GetNextToken(token).ch;
+
+    // Process characters with special meanings
+    switch (ch) {
+        case 'n': return '\n';
+        case 't': return '\t';
+        case 'v': return '\v';
+        case 'r': return '\r';
+        case 'f': return '\f';
+        case 'b': return '\b';
+        case 'u':
+        case 'U': break;
+        default:  return ch;
+    }
+
+    unsigned code = 0u;
+    for (unsigned digitCount = ch == 'u' ? 4u : 8u; digitCount > 0u; --digitCount) {
+        if (stream.GetNextToken(token).Code == TokenCode::TokenEOF)
+            return InvalidRegExprChar;
+        if (token.ch >= '0' && token.ch <= '9')
+            code = code * 16u + (token.ch - '0');
+        else if (token.ch >= 'a' && token.ch <= 'f')
+            code = code * 16u + (token.ch - 'a' + 10u);
+        else if (token.ch >= 'A' && token.ch <= 'F')
+            code = code * 16u + (token.ch - 'A' + 10u);
+        else
+            return InvalidRegExprChar;
+    }
+    // Character 0 is reserved for the empty (epsilon) transitions
+    return code != 0u && code <= DFA::MaxChar ? code : InvalidRegExprChar;
+}
+
+
+// Gets the text of a regular expression made of literal characters only
+// Returns false if the expression has any operators (or characters above the byte range)
+static bool GetLiteralText(const String& regExpr, String& text) {
+    text.clear();
+    for (size_t i = 0u; i < regExpr.size(); ++i) {
+        auto ch = regExpr[i];
+        switch (ch) {
+            case '+': case '.': case '|': case '*': case '(': case ')': case '[':
+            case ']': case '{': case '}': case '-': case '^': case '?':
+                return false;
+
+            // Same escapes as in ReadEscapedChar
+            case '\\':
+                if (++i == regExpr.size())
+                    return false;
+                switch (ch = regExpr[i]) {
+                    case 'n': ch = '\n'; break;
+                    case 't': ch = '\t'; break;
+                    case 'v': ch = '\v'; break;
+                    case 'r': ch = '\r'; break;
+                    case 'f': ch = '\f'; break;
+                    case 'b': ch = '\b'; break;
+                    case 'u':
+                    case 'U': return false;
+                    default:  break;
+                }
+                break;
+
+            default:
+                break;
+        }
+        text += ch;
+    }
+    return !text.empty();
+}
+
+
 // *** Creates an NFA Regular Expression
 
 // Constructs an NFA from a regular expression (using regular expression parser)
@@ -40,6 +118,7 @@ struct RegExprNFAParseElement final : public ParseStackElement<RegExprParseToken
         Null,
         NFA,
         Vector,
+        Set,
         Char
     };
 
@@ -49,6 +128,7 @@ struct RegExprNFAParseElement final : public ParseStackElement<RegExprParseToken
     {
         NFA*                   pNFA     = nullptr;
         std::vector<unsigned>* pVec;
+        CharRangeSet*          pSet;
         unsigned               ch;
     };
 
@@ -60,20 +140,8 @@ struct RegExprNFAParseElement final : public ParseStackElement<RegExprParseToken
         // If we are shifting token, parser will be looking at the next character next
         // So we can do this
         // Essentially, we are ignoring the next token code, and turning it into a character
-        if (ch == '\\' && token.Code != TokenCode::TokenEOF) {
-            TokenType tok;
-            stream.GetNextToken(tok);
-            ch = tok.ch;
-            // Process characters with special meanings
-            switch (ch) {
-                case 'n': ch = '\n'; break;
-                case 't': ch = '\t'; break;
-                case 'v': ch = '\v'; break;
-                case 'r': ch = '\r'; break;
-                case 'f': ch = '\f'; break;
-                case 'b': ch = '\b'; break;
-            }
-        }
+        if (ch == '\\' && token.Code != TokenCode::TokenEOF)
+            ch = ReadEscapedChar(stream);
     }
 
     void Destroy() {
@@ -81,6 +149,7 @@ struct RegExprNFAParseElement final : public ParseStackElement<RegExprParseToken
             case RegExprDataType::Null:                break;
             case RegExprDataType::NFA:    delete pNFA; break;
             case RegExprDataType::Vector: delete pVec; break;
+            case RegExprDataType::Set:    delete pSet; break;
             case RegExprDataType::Char:                break;
         }
         DataType = RegExprDataType::Null;
@@ -97,6 +166,14 @@ public:
     Lex*                    pLex       = nullptr;
     std::map<String, NFA*>* pMacroNFAs = nullptr;
 
+    // Reports malformed character escapes
+    bool CheckChar(unsigned ch) {
+        if (ch != InvalidRegExprChar)
+            return true;
+        pLex->CheckForErrorAndReport("Invalid character code escape in regular expression");
+        return false;
+    }
+
     bool Reduce(Parse<RegExprNFAParseElement>& parse, unsigned productionID) override {
         switch (productionID) {
             // RegExp --> RegExp  A
@@ -151,6 +228,8 @@ public:
 
                 // C --> character
             case RE_CChar:
+                if (!CheckChar(parse[0].ch))
+                    return false;
                 // Make an NFA from the character. Assign to parseStack
                 parse[0].pNFA     = new NFA{parse[0].ch, LexemeID};
                 parse[0].DataType = RegExprNFAParseElement::RegExprDataType::NFA;
@@ -158,63 +237,37 @@ public:
 
                 // C --> '.'
             case RE_CDot: {
-                // Construct a list of all characters but '\n'
-                std::vector<unsigned> charList;
-                charList.reserve(253u);
-                for (unsigned k = 1u; k <= 255u; k++)
-                    if (k != '\n' && k != '\r')
-                        charList.push_back(k);
+                // Construct a set of all characters but '\n' and '\r'
+                CharRangeSet charSet{1u, DFA::MaxChar};
+                charSet.Remove('\n', '\n');
+                charSet.Remove('\r', '\r');
 
                 // ...and then make the NFA
-                parse[0].pNFA     = new NFA{charList, LexemeID};
+                parse[0].pNFA     = new NFA{charSet, LexemeID};
                 parse[0].DataType = RegExprNFAParseElement::RegExprDataType::NFA;
                 break;
             }
 
                 // C --> '[' GroupSet ']'
             case RE_CGroupSet: {
-                // Make a NFA out of the sequence
-                const auto pgroupSet = parse[1].pVec;
-                std::vector<unsigned> charList;
-
-                // Construct a list of all the characters represented by the pgroupSet...
-                for (size_t i = 0u; i < pgroupSet->size(); i += 2u)
-                    for (unsigned j = (*pgroupSet)[i]; j <= (*pgroupSet)[i + 1u]; ++j)
-                        charList.push_back(j);
+                // Make a NFA out of the character set
+                parse[0].pNFA     = new NFA{*parse[1].pSet, LexemeID};
+                parse[0].DataType = RegExprNFAParseElement::RegExprDataType::NFA;
 
-                // Delete std::vector
+                // Delete the set
                 parse[1].Destroy();
-
-                // ...and then make the NFA
-                parse[0].pNFA     = new NFA{charList, LexemeID};
-                parse[0].DataType = RegExprNFAParseElement::RegExprDataType::NFA;
                 break;
             }
 
                 // C --> '[' '^' GroupSet ']'
             case RE_CNotGroupSet: {
-                // Make a NFA out of the sequence
-                const auto            pgroupSet = parse[2].pVec;
-                std::vector<unsigned> charList;
-
-                // Construct a list of all the characters NOT represented by the pgroupSet...
-                // NOTE: Depends on 0..255 ASCII
-                for (unsigned k = 1u; k <= 255u; ++k) {
-                    bool f = false;
-                    for (size_t i = 0u; i < pgroupSet->size(); i += 2u)
-                        for (unsigned j = (*pgroupSet)[i]; j <= (*pgroupSet)[i + 1u]; ++j)
-                            if (j == k)
-                                f = true;
+                // Make a NFA out of all the characters NOT represented by the set
+                parse[0].pNFA     = new NFA{parse[2].pSet->Complement(1u, DFA::MaxChar),
+                                            LexemeID};
+                parse[0].DataType = RegExprNFAParseElement::RegExprDataType::NFA;
 
-                    if (!f)
-                        charList.push_back(k);
-                }
-                // Delete std::vector
+                // Delete the set
                 parse[2].Destroy();
-
-                // ...and then make the NFA
-                parse[0].pNFA     = new NFA{charList, LexemeID};
-                parse[0].DataType = RegExprNFAParseElement::RegExprDataType::NFA;
                 break;
             }
 
@@ -262,47 +315,49 @@ public:
 
             // GroupSet --> character
             case RE_GroupSetChar: {
-                // Start off a new std::vector of char pairs
+                // Start off a new character set
                 const auto code   = parse[0].ch;
+                if (!CheckChar(code))
+                    return false;
 
-                parse[0].pVec     = new std::vector<unsigned>;
-                parse[0].DataType = RegExprNFAParseElement::RegExprDataType::Vector;
-                parse[0].pVec->push_back(code);
-                parse[0].pVec->push_back(code);
+                parse[0].pSet     = new CharRangeSet{code, code};
+                parse[0].DataType = RegExprNFAParseElement::RegExprDataType::Set;
                 break;
             }
 
                 // GroupSet --> character GroupSet
             case RE_GroupSetCharGroupSet:
-                // Add the char to the end of the CharSet std::vector
-                parse[1].pVec->push_back(parse[0].ch);
-                parse[1].pVec->push_back(parse[0].ch);
-                parse[0].pVec     = parse[1].pVec;
+                // Add the char to the character set
+                if (!CheckChar(parse[0].ch))
+                    return false;
+                parse[1].pSet->Add(parse[0].ch);
+                parse[0].pSet     = parse[1].pSet;
                 parse[0].DataType = parse[1].DataType;
                 break;
 
                 // GroupSet --> character '-' character
             case RE_GroupSetCharList: {
-                // Start off a new std::vector of char pairs
+                // Start off a new character set
                 const auto code   = parse[0].ch;
                 const auto code2  = parse[2].ch;
+                if (!CheckChar(code) || !CheckChar(code2))
+                    return false;
 
-                parse[0].pVec     = new std::vector<unsigned>;
-                parse[0].DataType = RegExprNFAParseElement::RegExprDataType::Vector;
-                parse[0].pVec->push_back(code);
-                parse[0].pVec->push_back(code2);
+                parse[0].pSet     = new CharRangeSet{code, code2};
+                parse[0].DataType = RegExprNFAParseElement::RegExprDataType::Set;
                 break;
             }
 
                 // GroupSet --> character '-' character GroupSet
             case RE_GroupSetCharListGroupSet: {
-                // Add the char to the end of the CharSet std::vector
+                // Add the range to the character set
                 const auto code   = parse[0].ch;
                 const auto code2  = parse[2].ch;
+                if (!CheckChar(code) || !CheckChar(code2))
+                    return false;
 
-                parse[3].pVec->push_back(code);
-                parse[3].pVec->push_back(code2);
-                parse[0].pVec     = parse[3].pVec;
+                parse[3].pSet->Add(code, code2);
+                parse[0].pSet     = parse[3].pSet;
                 parse[0].DataType = parse[3].DataType;
                 break;
             }
@@ -563,20 +618,8 @@ struct RegExprDFAParseElement final : public ParseStackElement<RegExprParseToken
         // If we are shifting token, parser will be looking at the next character next
         // So we can do this
         // Essentially, we are ignoring the next token code, and turning it into a character
-        if (ch == '\\' && token.Code != TokenCode::TokenEOF) {
-            TokenType tempToken;
-            ch = stream.GetNextToken(tempToken).ch;
-            // Process characters with special meanings
-            switch (ch) {
-                case 'n': ch='\n'; break;
-                case 't': ch='\t'; break;
-                case 'v': ch='\v'; break;
-                case 'r': ch='\r'; break;
-                case 'f': ch='\f'; break;
-                case 'b': ch='\b'; break;
-                default:           break;
-            }
-        }
+        if (ch == '\\' && token.Code != TokenCode::TokenEOF)
+            ch = ReadEscapedChar(stream);
     }
 
     void Destroy() {
@@ -1073,13 +1116,20 @@ bool Lex::MakeDFAUsingNFA(DFAGen& dfa) {
         Expressions.push_back({0u, unsigned(Lexemes.size())});
 
     // Go through all expression lexemes and construct a list of DFA
-    std::vector<NFA*> lexemeNFAList;
-    DFAGen            dfa2;
+    std::vector<NFA*>    lexemeNFAList;
+    DFAGen               dfa2;
+    std::vector<Keyword> keywords;
 
     for (size_t i = 0u; i < Expressions.size(); ++i) {
+        // Keywords are left out of the DFA, which matches them as another lexeme
+        const auto isKeyword = FindKeywords(Expressions[i], macroNFAs, keywords);
+
         // Store NFAs for this expression
         const auto EndLexeme = Expressions[i].StartLexeme + Expressions[i].LexemeCount;
         for (unsigned j = Expressions[i].StartLexeme; j < EndLexeme; ++j) {
+            if (isKeyword[j - Expressions[i].StartLexeme])
+                continue;
+
             const auto pnfa = new NFA{j + TokenCode::TokenFirstID};
 
             // if the nfa failed to initialize then quit
@@ -1095,6 +1145,8 @@ bool Lex::MakeDFAUsingNFA(DFAGen& dfa) {
 
                 return false;
             }
+            if (Lexemes[j].NoCase)
+                pnfa->FoldCase();
 
             lexemeNFAList.push_back(pnfa);
         }
@@ -1113,7 +1165,7 @@ bool Lex::MakeDFAUsingNFA(DFAGen& dfa) {
             dfa.Create(combinedNFA, Lexemes, 256u);
         else {
             // And combine it to form an expression
-            dfa2.Create(combinedNFA, Lexemes, unsigned(dfa.GetCharCount() - 1u));
+            dfa2.Create(combinedNFA, Lexemes, unsigned(dfa.CharTable.size() - 1u));
             if (!dfa.Combine(dfa2)) {
                 // ERROR: Failed to combine DFAs, probably inconsistent states
                 CheckForErrorAndReport("Failed to combine DFAs.");
@@ -1126,10 +1178,83 @@ bool Lex::MakeDFAUsingNFA(DFAGen& dfa) {
     for (const auto& [_, nfa] : macroNFAs)
         delete nfa;
 
+    if (dfa.IsValid())
+        dfa.SetKeywords(keywords);
+
     return true;
 }
 
 
+// Finds the literal lexemes of an expression matched by a more general lexeme
+// A DFA is made of the non-literal lexemes, and the text of every literal is tested on it
+// If the text is matched as a lexeme the literal takes precedence over, then leaving the
+// literal out of the DFA changes only the lexeme recognized for that text, as the lexeme
+// matching the literal text matches its prefixes too; so the DFA tokenizer can tell the
+// literal apart by the text, when the other lexeme is recognized
+std::vector<bool> Lex::FindKeywords(const Expression& expression,
+                                    std::map<String, NFA*>& macroNFAs,
+                                    std::vector<Keyword>& keywords) {
+    std::vector<bool>   isKeyword(expression.LexemeCount, false);
+    std::vector<String> texts(expression.LexemeCount);
+    std::vector<NFA*>   lexemeNFAList;
+    bool                hasLiterals = false;
+
+    const auto freeNFAs = [&]() {
+        for (const auto nfa : lexemeNFAList)
+            delete nfa;
+        lexemeNFAList.clear();
+    };
+
+    for (unsigned i = 0u; i < expression.LexemeCount; ++i) {
+        const auto j = expression.StartLexeme + i;
+        // Keywords are told apart by the exact text, so a literal matched in either case
+        // stays in the DFA
+        if (!Lexemes[j].NoCase && GetLiteralText(Lexemes[j].RegularExpression, texts[i]) &&
+            texts[i].size() <= KeywordTable::MaxTextSize) {
+            hasLiterals = true;
+            continue;
+        }
+        texts[i].clear();
+
+        const auto pnfa = new NFA{j + TokenCode::TokenFirstID};
+        lexemeNFAList.push_back(pnfa);
+        // Errors are reported when the expression DFA is made
+        if (!MakeNFA(*pnfa, Lexemes[j].RegularExpression, macroNFAs)) {
+            freeNFAs();
+            return isKeyword;
+        }
+        if (Lexemes[j].NoCase)
+            pnfa->FoldCase();
+    }
+
+    if (!hasLiterals || lexemeNFAList.empty()) {
+        freeNFAs();
+        return isKeyword;
+    }
+
+    NFA combinedNFA{1u};
+    combinedNFA.CombineNFAs(lexemeNFAList);
+    freeNFAs();
+
+    DFAGen testDFA;
+    if (!testDFA.Create(combinedNFA, Lexemes, 256u))
+        return isKeyword;
+
+    for (unsigned i = 0u; i < expression.LexemeCount; ++i) {
+        if (texts[i].empty())
+            continue;
+        const auto lexeme      = expression.StartLexeme + i + TokenCode::TokenFirstID;
+        const auto matchLexeme = testDFA.TestString(texts[i]);
+        // The latest lexeme takes precedence
+        if (matchLexeme != 0u && matchLexeme < lexeme) {
+            isKeyword[i] = true;
+            keywords.push_back({lexeme, matchLexeme, texts[i]});
+        }
+    }
+    return isKeyword;
+}
+
+
 // Lexemes is a complete list of all the R.E.'s in the form name, R.E.
 // LexemeNFAList is a shorter list containing the NFAs generated so far
 bool Lex::MakeNFA(NFA& nfa, const String& regExp, std::map<String, NFA*>& macroNFAs) {
@@ -1194,7 +1319,7 @@ bool Lex::MakeDFA(DFAGen& dfa, DFASyntaxTree<T>& tree, std::vector<Lexeme>& lexe
         for (const auto ch: charNode->Chars)
             if (ch != 1u)  // Magic number detected
                 if (!charTable.HasValue(ch))
-                    charTable.SetValue(ch, unsigned(dfa.GetCharCount()));
+                    charTable.SetValue(ch, DFA::ClassType(charTable.size()));
     }
 
     auto& transitionTable = dfa.TransitionTable;
@@ -1204,7 +1329,7 @@ bool Lex::MakeDFA(DFAGen& dfa, DFASyntaxTree<T>& tree, std::vector<Lexeme>& lexe
 
     // And allocate the transition table for the first state
     transitionTable.resize(1u);
-    transitionTable[0u].resize(dfa.GetCharCount(), DFA::EmptyTransition);
+    transitionTable[0u].resize(charTable.size(), DFA::EmptyTransition);
 
     for (unsigned state = 0u; state < unsigned(dfaStates.size()); ++state) {
         // Calculate Move on all characters
@@ -1243,7 +1368,7 @@ bool Lex::MakeDFA(DFAGen& dfa, DFASyntaxTree<T>& tree, std::vector<Lexeme>& lexe
                 // And allocate transition table for the state
                 const auto size = transitionTable.size();
                 transitionTable.resize(size + 1u);
-                transitionTable[size].resize(dfa.GetCharCount(), DFA::EmptyTransition);
+                transitionTable[size].resize(charTable.size(), DFA::EmptyTransition);
             }
 
             dfa.SetTransitionState(state, state, unsigned(j));
@@ -1301,6 +1426,8 @@ bool Lex::MakeDFA(DFAGen& dfa, DFASyntaxTree<T>& tree, std::vector<Lexeme>& lexe
     // Only one expression created
     dfa.ExpressionStartStates.push_back(DFA::StateType{0u});
 
+    dfa.UpdateTransitionTable();
+
     return true;
 }
 
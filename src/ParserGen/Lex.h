@@ -13,30 +13,12 @@
 
 
 /** @todo Complete Unicode support.
-    Currently, Parser supports UTF-8 characters in string literals, comments, and keywords,
-    but not in regular expressions.
-    The root cause of this limitation is that the grammar's regular-expression machinery
-    can handle char-sets containing characters from 7-bit ASCII only.
-    Possible steps to support non-ASCII characters in numeric-literals and/or non-keyword
-    identifiers are:
-**/
-/**
-    - Tokenizer should be modified to properly read UTF-8 characters, e.g. by adopting
-      existing UTF8::String class.
-**/
-/**
-    - CharTable class should be modified to provide a mapping from the character range
-      to some state in the DFA table. Character range should not unfold to the array
-      of characters, instead, it should represent the ranges in the form [from, to]
-      (and possibly ^[from, to] - inverted range). Such an approach may require
-      the implementation of functions for ranges manipulation, e.g. union, intersection,
-      splitting, etc.
-**/
-/**
-    - Optional: DFA table can be optimized by reducing the number of rows to an actual
-      number of character ranges in use. Such an approach will probably require two passes
-      for parsing (first pass for gathering the needed character ranges, the second pass
-      for creating corresponding DFA table).
+    Character sets of the regular expressions are sets of character ranges (CharRangeSet),
+    so they can contain any Unicode code points; the characters above 0xFF are written
+    with the \uXXXX and \UXXXXXXXX escapes, and are looked up in a two-level table by
+    the DFA. Tokens using UTF8CharReaderBase as the input reader match them in UTF-8 input.
+    Literal characters of the regular expressions are still taken as single bytes, so that
+    the UTF-8 characters in string literals, comments, and keywords keep matching byte-wise.
 **/
 
 namespace SGParser
@@ -131,6 +113,13 @@ private:
     // Builds an NFA from a regular expression
     bool MakeNFA(NFA& nfa, const String& regExpr, std::map<String, NFA*>& macroNFAs);
 
+    // Finds the literal lexemes of an expression, which are also matched by a more general
+    // lexeme of the expression that they take precedence over (i.e. keywords and an identifier)
+    // Returns a flag for every lexeme of the expression, set for the keywords
+    std::vector<bool> FindKeywords(const Expression& expression,
+                                   std::map<String, NFA*>& macroNFAs,
+                                   std::vector<Keyword>& keywords);
+
     // Builds a Syntax Tree from a regular expression (used for DFA creation)
     template <class T>
     bool MakeSyntaxTree(DFASyntaxTree<T>& tree, const String& regExpr,
@@ -25,12 +25,15 @@ struct Lexeme final
     LexemeInfo Info;
     // Action parameter expression name String, if any
     String     ActionParam;
+    // Letters are matched in either case
+    bool       NoCase = false;
 
     void SetLexeme(const String& name, const String& regExpr, unsigned tokenCode = 0u) {
         Name              = name;
         RegularExpression = regExpr;
         Info              = {tokenCode, LexemeInfo::ActionNone};
         ActionParam.clear();
+        NoCase            = false;
     }
 };
 
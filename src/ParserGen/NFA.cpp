@@ -36,7 +36,7 @@ bool NFA::Create(unsigned c, unsigned lexemeID) {
 
 // Creates a Multi-character NFA
 // Builds an NFA that will accept any one of characters provided (only length 1)
-bool NFA::Create(const std::vector<unsigned>& c, unsigned lexemeID) {
+bool NFA::Create(const CharRangeSet& c, unsigned lexemeID) {
     // Make sure this NFA is empty
     if (pStartState)
         return false;
@@ -46,9 +46,9 @@ bool NFA::Create(const std::vector<unsigned>& c, unsigned lexemeID) {
     pStartState          = NewState(0u);
     const auto ptempNode = NewState(1u);
 
-    // ...with many links between them on c[i].
-    for (const auto ch : c)
-        AddLink(pStartState, ch, ptempNode);
+    // ...with a link between them on every range of c.
+    for (const auto& range : c)
+        AddLink(pStartState, range, ptempNode);
 
     return true;
 }
@@ -88,7 +88,7 @@ bool NFA::Create(const NFA& n, unsigned newLexemeId) {
 
         n2->AcceptingState = n1->AcceptingState;
         n2->Id             = n1->Id;
-        n2->LinkChar       = n1->LinkChar;
+        n2->LinkRange      = n1->LinkRange;
 
         for (const auto ptr : n1->LinkPtr)
             n2->LinkPtr.push_back(pointerMap[ptr]);
@@ -300,6 +300,46 @@ void NFA::CombineNFAs(const std::vector<NFA*>& NFAList) {
 }
 
 
+// Makes the NFA match the ASCII letters in either case
+// Every link on letters gets a link on the same letters in the other case, unless the node
+// has it already, so that the DFA made of the NFA can't tell the cases apart, and puts
+// both cases into the same character class, unless other lexemes tell them apart
+void NFA::FoldCase() {
+    if (!pStartState)
+        return;
+
+    constexpr unsigned caseShift = 'a' - 'A';
+
+    NodeSet graph;
+    TraverseGraph(pStartState, graph);
+
+    for (const auto pnode : graph) {
+        // Characters linked to every target, and the letters of the links in the other case
+        std::map<NFANode*, CharRangeSet> linked;
+        std::map<NFANode*, CharRangeSet> folded;
+
+        for (size_t i = 0u; i < pnode->LinkRange.size(); ++i) {
+            const auto& range   = pnode->LinkRange[i];
+            const auto  ptarget = pnode->LinkPtr[i];
+            if (range.From == NFANode::Epsilon)
+                continue;
+
+            linked[ptarget].Add(range.From, range.To);
+            if (const auto from = std::max(range.From, unsigned('A')),
+                           to   = std::min(range.To, unsigned('Z')); from <= to)
+                folded[ptarget].Add(from + caseShift, to + caseShift);
+            if (const auto from = std::max(range.From, unsigned('a')),
+                           to   = std::min(range.To, unsigned('z')); from <= to)
+                folded[ptarget].Add(from - caseShift, to - caseShift);
+        }
+
+        for (const auto& [ptarget, letters] : folded)
+            for (const auto& range : letters.Intersection(linked[ptarget].Complement('A', 'z')))
+                AddLink(pnode, range, ptarget);
+    }
+}
+
+
 // Debugging routine that prints all the nodes in the NFA
 void NFA::PrintFA() const {
     NodeSet graph;
@@ -310,8 +350,9 @@ void NFA::PrintFA() const {
         std::printf("NFANode %zu (%p) [%u]: accepting = %u:", i,
                     (void*)pn, pn->Id, pn->AcceptingState);
 
-        for (size_t j = 0u; j < pn->LinkChar.size(); ++j)
-            std::printf("\n%c --> %p", char(pn->LinkChar[j]), (void*)pn->LinkPtr[j]);
+        for (size_t j = 0u; j < pn->LinkRange.size(); ++j)
+            std::printf("\n%X-%X --> %p", pn->LinkRange[j].From, pn->LinkRange[j].To,
+                        (void*)pn->LinkPtr[j]);
 
         std::printf("\n");
         ++i;
@@ -334,14 +375,16 @@ void NFA::PrintFADotty(String& str) const {
             dest += StringWithFormat("n%u [label=\"n%u: a%u\" peripheries=3]\n",
                                      pn->Id, pn->Id, pn->AcceptingState);
 
-        for (size_t j = 0u; j < pn->LinkChar.size(); ++j) {
-            String     label;
-            const auto x = pn->LinkChar[j];
+        for (size_t j = 0u; j < pn->LinkRange.size(); ++j) {
+            const auto formatChar = [](unsigned x) {
+                return x >= 32u && x <= 126u ? StringWithFormat("'%c'", char(x))
+                                             : StringWithFormat("%u", x);
+            };
 
-            if (x >= 32u && x <= 126u)
-                label = StringWithFormat("'%c'", char(x));
-            else
-                label = StringWithFormat("%u", x);
+            const auto& range = pn->LinkRange[j];
+            auto        label = formatChar(range.From);
+            if (range.To != range.From)
+                label += "-" + formatChar(range.To);
 
             dest += StringWithFormat("n%u -> n%u [label=\"%s\"]\n",
                                      pn->Id, pn->LinkPtr[j]->Id, label.data());
@@ -397,9 +440,9 @@ NFANode* NFA::NewState(unsigned accepting) {
 }
 
 
-// Creates a link between two nodes on a character c
-void    NFA::AddLink(NFANode* modify, unsigned c, NFANode* target) {
-    modify->LinkChar.push_back(c);
+// Creates a link between two nodes on a range of characters
+void    NFA::AddLink(NFANode* modify, const CharRange& range, NFANode* target) {
+    modify->LinkRange.push_back(range);
     modify->LinkPtr.push_back(target);
 }
 
@@ -6,6 +6,7 @@
 #define INC_SGPARSER_GENERATOR_NFA_H
 
 #include "SGString.h"
+#include "CharRangeSet.h"
 
 #include <set>
 #include <vector>
@@ -29,10 +30,10 @@ struct NFANode final
     unsigned              Id;
     // 0 if not accepting, Lexeme ID # > 0 if accepting
     unsigned              AcceptingState;
-    // A list of transitions to different nodes for a particular character
-    // Epsilon (empty link) is character value 0
-    std::vector<unsigned> LinkChar;
-    std::vector<NFANode*> LinkPtr;
+    // A list of transitions to different nodes for a particular character range
+    // Epsilon (empty link) is the range of the single character value 0
+    std::vector<CharRange> LinkRange;
+    std::vector<NFANode*>  LinkPtr;
 };
 
 
@@ -70,7 +71,7 @@ public:
     }
 
     // Construct a NFA that accepts any one of the given characters
-    NFA(const std::vector<unsigned>& c, unsigned lexemeId) {
+    NFA(const CharRangeSet& c, unsigned lexemeId) {
         Create(c, lexemeId);
     }
 
@@ -95,7 +96,7 @@ public:
     // Construct a NFA that accepts the one character String
     bool     Create(unsigned c, unsigned lexemeID);
     // Construct a NFA that accepts any one of the given characters
-    bool     Create(const std::vector<unsigned>& c, unsigned lexemeID);
+    bool     Create(const CharRangeSet& c, unsigned lexemeID);
     // Construct a NFA from another NFA (n)
     // Assigns a new lexeme id if newLexemeId != 0
     bool     Create(const NFA& nfa, unsigned newLexemId = 0u);
@@ -126,6 +127,9 @@ public:
     // Combines a set of NFAs into one by Or'ing them all together
     void     CombineNFAs(const std::vector<NFA*>& nfaList);
 
+    // Makes the NFA match the ASCII letters in either case
+    void     FoldCase();
+
     // Get the lexeme ID of the NFA
     unsigned GetLexemeID() const noexcept { return LexemeId; }
 
@@ -158,7 +162,11 @@ private:
     NFANode* NewState(unsigned accepting);
 
     // Form a new link between two existing nodes on character c
-    void     AddLink(NFANode* pmodify, unsigned c, NFANode* ptarget);
+    void     AddLink(NFANode* pmodify, unsigned c, NFANode* ptarget) {
+        AddLink(pmodify, CharRange{c, c}, ptarget);
+    }
+    // Form a new link between two existing nodes on a range of characters
+    void     AddLink(NFANode* pmodify, const CharRange& range, NFANode* ptarget);
 
     // Traverses the graph and constructs a list of all nodes reachable from seed in visited
     void     TraverseGraph(NFANode* pseed, NodeSet& visited) const;
@@ -79,7 +79,7 @@ void StdGrammarParseData::CreateVectors(std::map<String, unsigned>& grammarSymbo
     for (size_t i = 0u; i < terminalCount; ++i)
         grammarSymbols.insert_or_assign(terminalSet[i], unsigned(i));
 
-    static constexpr size_t nonTerminalCount = 34u;
+    static constexpr size_t nonTerminalCount = 35u;
     static constexpr struct nonTerminalInfo {
         const char* pName;
         unsigned    Id;
@@ -98,6 +98,7 @@ void StdGrammarParseData::CreateVectors(std::map<String, unsigned>& grammarSymbo
       {"push",             SGL_push},
       {"pop",              SGL_pop},
       {"goto",             SGL_goto},
+      {"nocase",           SGL_nocase},
 
       {"prec",             SGL_prec},
       {"left",             SGL_left},
@@ -131,7 +132,7 @@ void StdGrammarParseData::CreateVectors(std::map<String, unsigned>& grammarSymbo
         grammarSymbols.insert_or_assign(nonTerminalSet[i].pName,
                                         nonTerminalSet[i].Id | ProductionMask::Terminal);
 
-    static constexpr size_t productionCount = 107u;
+    static constexpr size_t productionCount = 109u;
     static constexpr struct ProductionInit {
         const char* pName;
         const char* pGrammarSymbol;
@@ -165,6 +166,7 @@ void StdGrammarParseData::CreateVectors(std::map<String, unsigned>& grammarSymbo
       {"ExprSectionListEmpty",        "EXPRESSION_SECTIONLIST",     0u, {}                                                                                      },
 
       {"ExprSection",                 "EXPRESSION_SECTION",         3u, {"expression", "identifier", "EXPRESSION_BLOCK"}                                        },
+      {"ExprSectionNoCase",           "EXPRESSION_SECTION",         4u, {"expression", "identifier", "nocase", "EXPRESSION_BLOCK"}                              },
       {"ExprSectionError",            "EXPRESSION_SECTION",         2u, {"expression", "%error"}                                                                },
 
       {"ExprBlock",                   "EXPRESSION_BLOCK",           2u, {"EXPRESSION_BLOCK","EXPRESSION_LINE"}                                                  },
@@ -178,6 +180,7 @@ void StdGrammarParseData::CreateVectors(std::map<String, unsigned>& grammarSymbo
       {"OptActionPush",               "OPT_ACTION",                 3u, {",","push","identifier"}                                                               },
       {"OptActionPop",                "OPT_ACTION",                 2u, {",","pop"}                                                                             },
       {"OptActionGoto",               "OPT_ACTION",                 3u, {",","goto","identifier"}                                                               },
+      {"OptActionNoCase",             "OPT_ACTION",                 3u, {",","nocase","OPT_ACTION"}                                                             },
       {"OptActionNone",               "OPT_ACTION",                 0u, {}                                                                                      },
 
       // Precedence
@@ -309,7 +312,7 @@ void StdGrammarParseData::CreateVectors(std::map<String, unsigned>& grammarSymbo
 
 void StdGrammarParseData::CreateLexemes(std::vector<Lexeme>& lexemes) {
     // Create the hard-coded internal lexemes structure
-    static constexpr size_t LexemeCount = 36u;
+    static constexpr size_t LexemeCount = 37u;
     static constexpr struct LexemeInit {
         const char* Name;
         const char* RegulaRegExpr;
@@ -328,6 +331,7 @@ void StdGrammarParseData::CreateLexemes(std::vector<Lexeme>& lexemes) {
       {"push",             "%push"                   },
       {"pop",              "%pop"                    },
       {"goto",             "%goto"                   },
+      {"nocase",           "%nocase"                 },
 
       {"prec",             "%prec"                   },
       {"left",             "%left"                   },
@@ -753,6 +757,29 @@ bool StdGrammarParseHandler::Reduce(Parse<StdGrammarStackElement>& parse, unsign
         parse[assoc].Cleanup();
     };
 
+    // Helper function to store the action of OPT_ACTION in a lexeme
+    const auto setLexemeAction = [](Lexeme& lexeme, const String& action) {
+        // Every 'i' in front of the action code stands for a '%nocase'
+        const auto i  = action.find_first_not_of('i');
+        lexeme.NoCase = i != 0u;
+
+        switch (action[i]) {
+            case 'n': // nothing
+                break;
+            case 'p': // push
+                lexeme.Info.Action = LexemeInfo::ActionPush;
+                lexeme.ActionParam = action.substr(i + 1u);
+                break;
+            case 'o': // pop
+                lexeme.Info.Action = LexemeInfo::ActionPop;
+                break;
+            case 'g': // goto
+                lexeme.Info.Action = LexemeInfo::ActionGoto;
+                lexeme.ActionParam = action.substr(i + 1u);
+                break;
+        }
+    };
+
     // Check for an error and report if needed
     const auto checkForErrorAndReport = [&](size_t index, const String& code,
                                             const char* message...) {
@@ -908,7 +935,9 @@ bool StdGrammarParseHandler::Reduce(Parse<StdGrammarStackElement>& parse, unsign
             break;
 
             // EXPRESSION_SECTION  -> 'expression' 'identifier' EXPRESSION_BLOCK
-        case SG_ExprSection: {
+            // EXPRESSION_SECTION  -> 'expression' 'identifier' 'nocase' EXPRESSION_BLOCK
+        case SG_ExprSection:
+        case SG_ExprSectionNoCase: {
             // We are reducing by expression, so store its identifier
             // Calculate starting lexeme
             auto       str            = *parse[1].pString;
@@ -930,6 +959,11 @@ bool StdGrammarParseHandler::Reduce(Parse<StdGrammarStackElement>& parse, unsign
                                        "Expression block '%s' already defined on line %zu",
                                        str.data(), ExpressionBlocks[str] + 1u);
 
+            // All the lexemes of a '%nocase' block match letters in either case
+            if (productionID == SG_ExprSectionNoCase)
+                for (auto i = startingLexeme; i != startingLexeme + lexemeCount; ++i)
+                    pLex->Lexemes[i].NoCase = true;
+
             // Make sure there are regular expressions defined within the block
             if (lexemeCount == 0u)
                 checkForWarningAndReport(1, "YC0030W",
@@ -968,21 +1002,7 @@ bool StdGrammarParseHandler::Reduce(Parse<StdGrammarStackElement>& parse, unsign
             lexeme.SetLexeme(s1, s0);
 
             // Store action in lexeme
-            switch ((*parse[2].pString)[0u]) {
-                case 'n': // nothing
-                    break;
-                case 'p': // push
-                    lexeme.Info.Action = LexemeInfo::ActionPush;
-                    lexeme.ActionParam = parse[2].pString->substr(1u);
-                    break;
-                case 'o': // pop
-                    lexeme.Info.Action = LexemeInfo::ActionPop;
-                    break;
-                case 'g': // goto
-                    lexeme.Info.Action = LexemeInfo::ActionGoto;
-                    lexeme.ActionParam = parse[2].pString->substr(1u);
-                    break;
-            }
+            setLexemeAction(lexeme, *parse[2].pString);
 
             // Two different expressions can produce the same token code (generated based
             // on the lexeme name). So if the name is already in use, re-use the token code
@@ -1035,21 +1055,7 @@ bool StdGrammarParseHandler::Reduce(Parse<StdGrammarStackElement>& parse, unsign
             lexeme.SetLexeme(*parse[1].pString, *parse[0].pString);
 
             // Store action in lexeme
-            switch ((*parse[4].pString)[0u]) {
-                case 'n': // nothing
-                    break;
-                case 'p': // push
-                    lexeme.Info.Action = LexemeInfo::ActionPush;
-                    lexeme.ActionParam = parse[4].pString->substr(1u);
-                    break;
-                case 'o': // pop
-                    lexeme.Info.Action = LexemeInfo::ActionPop;
-                    break;
-                case 'g': // goto
-                    lexeme.Info.Action = LexemeInfo::ActionGoto;
-                    lexeme.ActionParam = parse[4].pString->substr(1u);
-                    break;
-            }
+            setLexemeAction(lexeme, *parse[4].pString);
 
             // Allow multiple lexemes to share token
 
@@ -1085,21 +1091,7 @@ bool StdGrammarParseHandler::Reduce(Parse<StdGrammarStackElement>& parse, unsign
             lexeme.SetLexeme("", *parse[0].pString);
 
             // Store action in lexeme
-            switch ((*parse[2].pString)[0u]) {
-                case 'n': // nothing
-                    break;
-                case 'p': // push
-                    lexeme.Info.Action = LexemeInfo::ActionPush;
-                    lexeme.ActionParam = parse[2].pString->substr(1u);
-                    break;
-                case 'o': // pop
-                    lexeme.Info.Action = LexemeInfo::ActionPop;
-                    break;
-                case 'g': // goto
-                    lexeme.Info.Action = LexemeInfo::ActionGoto;
-                    lexeme.ActionParam = parse[2].pString->substr(1u);
-                    break;
-            }
+            setLexemeAction(lexeme, *parse[2].pString);
 
             // Store the lexeme
             pLex->Lexemes.push_back(std::move(lexeme));
@@ -1137,6 +1129,13 @@ bool StdGrammarParseHandler::Reduce(Parse<StdGrammarStackElement>& parse, unsign
             parse[2].Cleanup();
             break;
 
+            // OPT_ACTION -> 'comma' 'nocase' OPT_ACTION
+        case SG_OptActionNoCase:
+            parse[0].pString = new String{"i" + *parse[2].pString};
+            parse[0].Type    = StdGrammarStackElement::DataString;
+            parse[2].Cleanup();
+            break;
+
             // OPT_ACTION -> <empty>
         case SG_OptActionNone:
             // Use one character code to represent OptAction
@@ -5,6 +5,7 @@
 #include "ParseTableGen.h"
 #include "Grammar.h"
 
+#include <algorithm>
 #include <map>
 
 namespace SGParser
@@ -29,26 +30,161 @@ void ParseTableGen::AllocateTables(size_t stateCount, size_t terminalCount,
     // *** Allocate memory for the action table
 
     ActionWidth = terminalCount;
-    ActionTable.reserve(stateCount);
-
-    const auto newActionSize  = stateCount * ActionWidth;
-    auto       newActionTable = new uint16_t[newActionSize];
-    std::fill(newActionTable, newActionTable + newActionSize, uint16_t(0u));
-
-    for (size_t i = 0u; i < stateCount; ++i, newActionTable += ActionWidth)
-        ActionTable.push_back(newActionTable);
+    ActionTable.assign(stateCount * ActionWidth, uint32_t(0u));
 
     // *** Allocate memory for the goto table
 
     GotoWidth = nonTerminalCount;
-    GotoTable.reserve(stateCount);
+    GotoTable.assign(stateCount * GotoWidth, EmptyGoto);
+}
+
+
+// *** Default reductions
+
+size_t ParseTableGen::SetDefaultReductions() {
+    size_t count = 0u;
+    for (size_t state = 0u; state < DefaultReductions.size(); ++state) {
+        StateInfos[state].DefaultReduce = DefaultReductions[state];
+        if (DefaultReductions[state] != uint32_t(0u))
+            ++count;
+    }
+    return count;
+}
 
-    const auto newGotoSize  = stateCount * GotoWidth;
-    auto       newGotoTable = new uint16_t[newGotoSize];
-    std::fill(newGotoTable, newGotoTable + newGotoSize, EmptyGoto);
 
-    for (size_t i = 0u; i < stateCount; ++i, newGotoTable += GotoWidth)
-        GotoTable.push_back(newGotoTable);
+// *** Table compression
+
+// Compresses the action and goto tables
+void ParseTableGen::Compress() {
+    if (!IsValid() || IsCompressed())
+        return;
+
+    // The goto table is packed with a row for every nonterminal, so that the most common
+    // state to go to after reducing to the nonterminal is the default
+    // Empty goto entries are stored as any other state, so that they are still reported
+    // as InvalidState (i.e. for Parse::SetReduceNonterminal)
+    std::vector<uint32_t> gotoColumns(GotoTable.size());
+    for (size_t state = 0u; state < StateCount; ++state)
+        for (size_t nonTerminal = 0u; nonTerminal < GotoWidth; ++nonTerminal)
+            gotoColumns[nonTerminal * StateCount + state] = GotoTable[state * GotoWidth +
+                                                                      nonTerminal];
+
+    PackTable(ActionTable, ActionWidth, ActionPackData);
+    PackTable(gotoColumns, StateCount, GotoPackData);
+    ActionTable = {};
+    GotoTable   = {};
+    AttachOwnedTables();
+}
+
+
+// Packs a dense table by row displacement
+void ParseTableGen::PackTable(const std::vector<uint32_t>& table, size_t width,
+                              PackedTableData& pack) {
+    const auto rowCount = width != 0u ? table.size() / width : 0u;
+
+    // Columns with identical entries in all the rows share a class
+    std::map<std::vector<uint32_t>, uint16_t> classes;
+    std::vector<uint32_t>                     column(rowCount);
+    pack.ColumnClasses.resize(width);
+    for (size_t c = 0u; c < width; ++c) {
+        for (size_t r = 0u; r < rowCount; ++r)
+            column[r] = table[r * width + c];
+        pack.ColumnClasses[c] = classes.emplace(column, uint16_t(classes.size())).first->second;
+    }
+    const auto classCount = classes.size();
+    SG_ASSERT(classCount < 0xFFFFu);
+
+    // The most common entry of every row is its default (the lowest one of the most common),
+    // and only the other entries are stored, as (class, entry) pairs
+    using RowEntries = std::vector<std::pair<uint16_t, uint32_t>>;
+    std::vector<RowEntries> rowEntries(rowCount);
+    pack.Defaults.resize(rowCount);
+    for (size_t r = 0u; r < rowCount; ++r) {
+        std::vector<uint32_t> classRow(classCount);
+        for (size_t c = 0u; c < width; ++c)
+            classRow[pack.ColumnClasses[c]] = table[r * width + c];
+
+        std::map<uint32_t, size_t> counts;
+        for (const auto entry : classRow)
+            ++counts[entry];
+        pack.Defaults[r] = std::max_element(counts.begin(), counts.end(),
+                                            [](const auto& left, const auto& right) {
+                                                return left.second < right.second;
+                                            })->first;
+
+        for (size_t c = 0u; c < classCount; ++c)
+            if (classRow[c] != pack.Defaults[r])
+                rowEntries[r].emplace_back(uint16_t(c), classRow[c]);
+    }
+
+    // Rows with the most entries are placed first, each one at the lowest offset where its
+    // entries don't collide with the entries placed already, and which is not the offset
+    // of another row. Rows with the same entries are placed once
+    std::vector<size_t> order(rowCount);
+    for (size_t r = 0u; r < rowCount; ++r)
+        order[r] = r;
+    std::stable_sort(order.begin(), order.end(), [&](size_t left, size_t right) {
+        return rowEntries[left].size() > rowEntries[right].size();
+    });
+
+    std::map<RowEntries, uint32_t> placedRows;
+    std::vector<bool>              usedSlots;
+    std::vector<bool>              usedOffsets;
+    pack.RowOffsets.assign(rowCount, 0u);
+    for (const auto r : order) {
+        const auto& entries = rowEntries[r];
+        if (entries.empty())
+            break;
+        if (const auto iplaced = placedRows.find(entries); iplaced != placedRows.end()) {
+            pack.RowOffsets[r] = iplaced->second;
+            continue;
+        }
+
+        const auto collides = [&](size_t offset) {
+            if (offset < usedOffsets.size() && usedOffsets[offset])
+                return true;
+            return std::any_of(entries.begin(), entries.end(), [&](const auto& entry) {
+                return offset + entry.first < usedSlots.size() && usedSlots[offset + entry.first];
+            });
+        };
+        size_t offset = 0u;
+        while (collides(offset))
+            ++offset;
+
+        usedSlots.resize(std::max(usedSlots.size(), offset + entries.back().first + 1u), false);
+        usedOffsets.resize(std::max(usedOffsets.size(), offset + 1u), false);
+        for (const auto& entry : entries)
+            usedSlots[offset + entry.first] = true;
+        usedOffsets[offset] = true;
+        pack.RowOffsets[r]  = uint32_t(offset);
+        placedRows.emplace(entries, uint32_t(offset));
+    }
+
+    // Rows without entries share an offset of no other row, so that no entry passes the check
+    const auto emptyOffset = size_t(std::find(usedOffsets.begin(), usedOffsets.end(), false) -
+                                    usedOffsets.begin());
+    for (size_t r = 0u; r < rowCount; ++r)
+        if (rowEntries[r].empty())
+            pack.RowOffsets[r] = uint32_t(emptyOffset);
+
+    // Every offset leaves room for all the classes, so that any lookup is within the entries
+    const auto size = std::max(usedOffsets.size(), emptyOffset + 1u) - 1u + classCount;
+    pack.Entries.assign(size, uint32_t(0u));
+    pack.CheckClasses.assign(size, uint16_t(0xFFFFu));
+    for (size_t r = 0u; r < rowCount; ++r)
+        for (const auto& [c, entry] : rowEntries[r]) {
+            pack.Entries[pack.RowOffsets[r] + c]      = entry;
+            pack.CheckClasses[pack.RowOffsets[r] + c] = c;
+        }
+}
+
+
+// Returns whether the static parse table needs 32-bit action and goto table entries
+bool ParseTableGen::NeedsWideEntries() const noexcept {
+    // The 16-bit shift entries hold the states up to NarrowExtractMask, and the 16-bit
+    // reduce entries hold the productions below the one of NarrowAcceptValue
+    return StateCount > NarrowExtractMask + 1u ||
+           ReduceProductions.size() > (NarrowAcceptValue & NarrowExtractMask);
 }
 
 
@@ -66,10 +202,11 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     static constexpr size_t ntRowCount     = 10u;
     static constexpr size_t tRowCount      = 10u;
     static constexpr size_t siRowCount     = 10u;
+    static constexpr size_t ctRowCount     = 16u;
 
     // Data structure sizes
-    const auto actionHeight = ActionTable.size();
-    const auto gotoHeight   = GotoTable.size();
+    const auto actionHeight = GetStateCount();
+    const auto gotoHeight   = GetStateCount();
     const auto rpSize       = ReduceProductions.size();
     const auto ntSize       = NonTerminals.size();
     const auto tSize        = Terminals.size();
@@ -87,6 +224,54 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     const auto siSizeStr       = StringFromNumber(siSize);
     const auto petSizeStr      = StringFromNumber(petSize);
 
+    // The action and goto table entries are 16-bit, unless the states or productions need more
+    const auto wide          = NeedsWideEntries();
+    const auto entryType     = wide ? "uint32_t" : "uint16_t";
+    const auto formatAction  = [wide](uint32_t action) {
+        if (wide)
+            return StringWithFormat("0x%08X", unsigned(action));
+        return StringWithFormat("0x%04X",
+                                action == AcceptValue
+                                    ? unsigned(NarrowAcceptValue)
+                                    : (action & ActionMask) >> 16u | (action & ExtractMask));
+    };
+    const auto formatGoto    = [wide](uint32_t state) {
+        return wide ? StringWithFormat("0x%08X", unsigned(state))
+                    : StringWithFormat("0x%04X", unsigned(uint16_t(state)));
+    };
+
+    // Adds an array of count values to dest, ctRowCount values per line
+    const auto addArray = [&name](String& dest, const char* type, const String& arrayName,
+                                  size_t count, auto formatValue) {
+        dest += StringWithFormat("static const %s %s_%s[%zu] =\n{", type, name.data(),
+                                 arrayName.data(), count);
+        for (size_t i = 0u; i < count; ++i) {
+            if (i != 0u)
+                dest += ",";
+            dest += i % ctRowCount == 0u ? "\n    " : " ";
+            dest += formatValue(i);
+        }
+        dest += "\n};\n\n";
+    };
+
+    // Adds the arrays of a packed table
+    const auto addPackedTable = [&](String& dest, const String& tableName,
+                                    const PackedTableData& pack, auto formatEntry) {
+        const auto hex16 = [](const std::vector<uint16_t>& values) {
+            return [&values](size_t i) { return StringWithFormat("0x%04X", unsigned(values[i])); };
+        };
+        addArray(dest, "uint16_t", tableName + "ColumnClasses", pack.ColumnClasses.size(),
+                 hex16(pack.ColumnClasses));
+        addArray(dest, entryType, tableName + "Defaults", pack.Defaults.size(),
+                 [&](size_t i) { return formatEntry(pack.Defaults[i]); });
+        addArray(dest, "uint32_t", tableName + "RowOffsets", pack.RowOffsets.size(),
+                 [&pack](size_t i) { return StringWithFormat("%u", pack.RowOffsets[i]); });
+        addArray(dest, entryType, tableName + "Entries", pack.Entries.size(),
+                 [&](size_t i) { return formatEntry(pack.Entries[i]); });
+        addArray(dest, "uint16_t", tableName + "CheckClasses", pack.CheckClasses.size(),
+                 hex16(pack.CheckClasses));
+    };
+
     String dest;
 
     // *** Add the includes
@@ -98,54 +283,62 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     if (!namespaceName.empty())
         dest += "namespace " + namespaceName + "\n{\n\n";
 
-    // *** Add the Action table
+    if (!IsCompressed()) {
+        // *** Add the Action table
 
-    dest += "static uint16_t " + name + "_ActionTable[" +
-            actionHeightStr + "][" + actionWidthStr +"] =\n{\n";
+        dest += "static const " + String{entryType} + " " + name + "_ActionTable[" +
+                actionHeightStr + "][" + actionWidthStr +"] =\n{\n";
 
-    // Go through all the transitions and add them
-    for (size_t h = 0u; h < actionHeight; ++h) {
-        dest += "    {";
-        auto sep = "";
-        for (size_t w = 0u; w < ActionWidth; ++w) {
-            dest += sep + StringWithFormat("0x%04X", unsigned(ActionTable[h][w]));
-            sep = ", ";
+        // Go through all the transitions and add them
+        for (size_t h = 0u; h < actionHeight; ++h) {
+            dest += "    {";
+            auto sep = "";
+            for (size_t w = 0u; w < ActionWidth; ++w) {
+                dest += sep + formatAction(ActionTable[h * ActionWidth + w]);
+                sep = ", ";
+            }
+            dest += "}";
+
+            if ((h + 1u) % actionRowCount == 0u)
+                dest += h != actionHeight - 1u ? ",\n" : "\n";
+            else
+                dest += h != actionHeight - 1u ? "," : "\n";
         }
-        dest += "}";
+        dest += "};\n\n";
 
-        if ((h + 1u) % actionRowCount == 0u)
-            dest += h != actionHeight - 1u ? ",\n" : "\n";
-        else
-            dest += h != actionHeight - 1u ? "," : "\n";
-    }
-    dest += "};\n\n";
+        // *** Add the Goto table
 
-    // *** Add the Goto table
+        dest += "static const " + String{entryType} + " " + name + "_GotoTable[" +
+                gotoHeightStr + "][" + gotoWidthStr + "] =\n{\n";
 
-    dest += "static uint16_t " + name + "_GotoTable[" +
-            gotoHeightStr + "][" + gotoWidthStr + "] =\n{\n";
+        // Go through all the transitions and add them
+        for (size_t h = 0u; h < gotoHeight; ++h) {
+            dest += "    {";
+            auto sep = "";
+            for (size_t w = 0u; w < GotoWidth; ++w) {
+                dest += sep + formatGoto(GotoTable[h * GotoWidth + w]);
+                sep = ", ";
+            }
+            dest += "}";
 
-    // Go through all the transitions and add them
-    for (size_t h = 0u; h < gotoHeight; ++h) {
-        dest += "    {";
-        auto sep = "";
-        for (size_t w = 0u; w < GotoWidth; ++w) {
-            dest += sep + StringWithFormat("0x%04X", unsigned(GotoTable[h][w]));
-            sep = ", ";
+            if ((h + 1u) % gotoRowCount == 0u)
+                dest += h != gotoHeight - 1u ? ",\n" : "\n";
+            else
+                dest += h != gotoHeight - 1u ? "," : "\n";
         }
-        dest += "}";
+        dest += "};\n\n";
+    } else {
+        // *** Add the packed Action and Goto tables
 
-        if ((h + 1u) % gotoRowCount == 0u)
-            dest += h != gotoHeight - 1u ? ",\n" : "\n";
-        else
-            dest += h != gotoHeight - 1u ? "," : "\n";
+        addPackedTable(dest, "Action", ActionPackData, formatAction);
+        addPackedTable(dest, "Goto", GotoPackData, formatGoto);
     }
-    dest += "};\n\n";
 
     if (rpSize > 0u) {
         // *** Add the Reduce production table
 
-        dest += "static uint32_t " + name + "_ReduceProduction[" + rpSizeStr + "][4] =\n{\n    ";
+        dest += "static const SGParser::ParseTable::ReduceProduction " + name +
+                "_ReduceProduction[" + rpSizeStr + "] =\n{\n    ";
 
         size_t i = 1u;
         // Go through all the accept states and add them
@@ -165,12 +358,13 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     if (ntSize > 0u) {
         // *** Add the Non Terminals
 
-        dest += "static uint16_t " + name +"_Nonterminals[" + ntSizeStr + "] =\n{\n    ";
+        dest += "static const SGParser::ParseTable::NonTerminal " + name + "_Nonterminals[" +
+                ntSizeStr + "] =\n{\n    ";
 
         size_t i = 1u;
         // Go through all the accept states and add them
         for (const auto [startState]: NonTerminals) {
-            dest += StringWithFormat("0x%04X", unsigned(startState));
+            dest += StringWithFormat("{0x%04X}", unsigned(startState));
 
             if (i % ntRowCount == 0u)
                 dest += i != ntSize ? ",\n    " : "\n";
@@ -184,12 +378,13 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     if (tSize > 0u) {
         // *** Add the Terminals
 
-        dest += "static uint8_t " + name + "_Terminals[" + tSizeStr + "] =\n{\n    ";
+        dest += "static const SGParser::ParseTable::Terminal " + name + "_Terminals[" +
+                tSizeStr + "] =\n{\n    ";
 
         size_t i = 1u;
         // Go through all the accept states and add them
         for (const auto [errorTerminal]: Terminals) {
-            dest += StringWithFormat("%u", unsigned(errorTerminal));
+            dest += StringWithFormat("{%u}", unsigned(errorTerminal));
 
             if (i % tRowCount == 0u)
                 dest += i != tSize ? ",\n    " : "\n";
@@ -203,12 +398,14 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     if (siSize > 0u) {
         // *** Add the StateInfos
 
-        dest += "static uint8_t " + name + "_StateInfos[" + siSizeStr + "][2] =\n{\n    ";
+        dest += "static const SGParser::ParseTable::StateInfo " + name + "_StateInfos[" +
+                siSizeStr + "] =\n{\n    ";
 
         size_t i = 1u;
         // Go through all the accept states and add them
-        for (const auto [record, backtrackOnError]: StateInfos) {
-            dest += StringWithFormat("{%u, %u}", unsigned(record), unsigned(backtrackOnError));
+        for (const auto [record, backtrackOnError, defaultReduce]: StateInfos) {
+            dest += StringWithFormat("{%u, %u, 0x%08X}", unsigned(record),
+                                     unsigned(backtrackOnError), unsigned(defaultReduce));
 
             if (i % siRowCount == 0u)
                 dest += i != siSize ? ",\n    " : "\n";
@@ -222,22 +419,19 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     if (petSize > 0u) {
         // *** Add the Production Error Terminals
 
-        dest += "static uint32_t " + name + "_ProductionErrorTerminals[" +
-                petSizeStr + "][2] =\n{\n    ";
+        dest += "static const SGParser::ParseTable::ProductionErrorTerminal " + name +
+                "_ProductionErrorTerminals[" + petSizeStr + "] =\n{\n    ";
 
-        // Create an ordered map from (unordered) ProductionErrorTerminals
-        // only for the sake of pretty looking output
-        std::map<unsigned, unsigned> sortedProdErrorTerminals{ProductionErrorTerminals.begin(),
-                                                              ProductionErrorTerminals.end()};
         size_t i = 1u;
-        // Go through all the accept states and add them
-        for (const auto& [prodId, errorTerminal]: sortedProdErrorTerminals) {
-            dest += StringWithFormat("{%u, %u}", prodId, errorTerminal);
+        // Go through all the production error terminals (sorted by the production) and add them
+        for (const auto [prodId, errorTerminal]: ProductionErrorTerminals) {
+            dest += StringWithFormat("{%llu, %u}", static_cast<unsigned long long>(prodId),
+                                     unsigned(errorTerminal));
 
             if (i % rpRowCount == 0u)
-                dest += i != rpSize ? ",\n    " : "\n";
+                dest += i != petSize ? ",\n    " : "\n";
             else
-                dest += i != rpSize ? ", " : "\n";
+                dest += i != petSize ? ", " : "\n";
             ++i;
         }
         dest += "};\n\n";
@@ -245,7 +439,7 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
 
     // *** Add the StaticParseTable structure
 
-    dest += "static SGParser::StaticParseTable " + name + " =\n{\n    ";
+    dest += "static const SGParser::StaticParseTable " + name + " =\n{\n    ";
 
     // The table type
     dest += "SGParser::ParseTableType::";
@@ -271,17 +465,19 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     dest += ",\n    ";
 
     // Action table entry
+    const auto narrowDense = !wide && !IsCompressed();
+    const auto wideDense   = wide && !IsCompressed();
     dest += actionHeightStr + "u,\n    " + actionWidthStr + "u,\n    " +
-            name + "_ActionTable[0u],\n    ";
+            (narrowDense ? name + "_ActionTable[0u]" : String{"nullptr"}) + ",\n    ";
 
     // Goto table entry
     dest += gotoHeightStr + "u,\n    " + gotoWidthStr + "u,\n    " +
-            name + "_GotoTable[0u],\n    ";
+            (narrowDense ? name + "_GotoTable[0u]" : String{"nullptr"}) + ",\n    ";
 
     // Reduce Production entry
     dest += rpSizeStr + "u,\n    ";
     if (rpSize > 0u)
-        dest += name + "_ReduceProduction[0u],\n    ";
+        dest += name + "_ReduceProduction,\n    ";
     else
         dest += "nullptr,\n    ";
 
@@ -302,16 +498,37 @@ bool ParseTableGen::CreateStaticParseTable(String& str, const String& name,
     // StateInfo entry
     dest += siSizeStr + "u,\n    ";
     if (siSize > 0u)
-        dest += name + "_StateInfos[0u],\n    ";
+        dest += name + "_StateInfos,\n    ";
     else
         dest += "nullptr,\n    ";
 
     // Production Error Terminal entry
     dest += petSizeStr + "u,\n    ";
     if (petSize > 0u)
-        dest += name + "_ProductionErrorTerminals[0u]\n    };";
+        dest += name + "_ProductionErrorTerminals,\n    ";
     else
-        dest += "nullptr\n};\n";
+        dest += "nullptr,\n    ";
+
+    // Packed Action and Goto table entries
+    const auto addPackedEntry = [&](const String& tableName, const PackedTableData& pack,
+                                    bool used) {
+        if (!used)
+            return String{"{0u, nullptr, nullptr, nullptr, nullptr, nullptr}"};
+        const auto prefix = name + "_" + tableName;
+        return StringWithFormat("{%zuu, ", pack.Entries.size()) + prefix + "ColumnClasses, " +
+               prefix + "Defaults, " + prefix + "RowOffsets, " + prefix + "Entries, " +
+               prefix + "CheckClasses}";
+    };
+    const auto narrowPacked = !wide && IsCompressed();
+    const auto widePacked   = wide && IsCompressed();
+    dest += addPackedEntry("Action", ActionPackData, narrowPacked) + ",\n    " +
+            addPackedEntry("Goto", GotoPackData, narrowPacked) + ",\n    ";
+
+    // Action and Goto table entries with 32-bit entries
+    dest += (wideDense ? name + "_ActionTable[0u]" : String{"nullptr"}) + ",\n    " +
+            (wideDense ? name + "_GotoTable[0u]" : String{"nullptr"}) + ",\n    " +
+            addPackedEntry("Action", ActionPackData, widePacked) + ",\n    " +
+            addPackedEntry("Goto", GotoPackData, widePacked) + "\n};\n";
 
     // Close namespace declaration of needed
     if (!namespaceName.empty())
@@ -34,7 +34,25 @@ public:
     // Initialize the ParseTable out of grammar
     bool     Create(Generator::Grammar& grammar, ParseTableType tableType = ParseTableType::CLR);
 
+    // Compresses the action and goto tables (see ParseTable::PackedTable)
+    // The dense tables are freed, the lookups go through the packed ones
+    void     Compress();
+
+    // Sets the default reductions found on table creation in StateInfo::DefaultReduce,
+    // so that the parser reduces in these states without reading the lookahead
+    // Returns the number of states with a default reduction
+    size_t   SetDefaultReductions();
+
+    // Returns whether the static parse table needs 32-bit action and goto table entries,
+    // because the states or the productions don't fit the 16-bit ones
+    bool     NeedsWideEntries() const noexcept;
+    // Returns the size of the action and goto tables of the static parse table in bytes
+    size_t   GetStaticTableSize() const noexcept {
+        return GetTableSize(NeedsWideEntries() ? sizeof(uint32_t) : sizeof(uint16_t));
+    }
+
     // Create a static parse table structure
+    // The action and goto tables have 16-bit entries, unless NeedsWideEntries
     bool     CreateStaticParseTable(String& str, const String& name,
                                     const String& namespaceName = String{}) const;
 
@@ -42,22 +60,29 @@ private:
     friend class Grammar;
 
     // Marker for empty goto table slot (used in table construction)
-    static constexpr uint16_t EmptyGoto = uint16_t(-1);
+    static constexpr uint32_t EmptyGoto = uint32_t(-1);
+
+    // Default reduction of every state, 0 for none; set by SetDefaultReductions
+    std::vector<uint32_t> DefaultReductions;
 
     // Get reference to Action & Goto entries; for building the table
-    uint16_t& GetActionRef(unsigned state, unsigned terminal) {
-        SG_ASSERT(state < ActionTable.size() && terminal < ActionWidth);
-        return ActionTable[state][terminal];
+    uint32_t& GetActionRef(unsigned state, unsigned terminal) {
+        SG_ASSERT(state * ActionWidth < ActionTable.size() && terminal < ActionWidth);
+        return ActionTable[state * ActionWidth + terminal];
     }
 
     // Get reference to action slot
-    uint16_t& GetGotoRef(unsigned state, unsigned nonTerminal) {
-        SG_ASSERT(state < GotoTable.size() && nonTerminal < GotoWidth);
-        return GotoTable[state][nonTerminal];
+    uint32_t& GetGotoRef(unsigned state, unsigned nonTerminal) {
+        SG_ASSERT(state * GotoWidth < GotoTable.size() && nonTerminal < GotoWidth);
+        return GotoTable[state * GotoWidth + nonTerminal];
     }
 
     // Internal function used on table creation, allocates empty tables
     void      AllocateTables(size_t stateCount, size_t terminalCount, size_t nonTerminalCount);
+
+    // Packs a dense table of width columns
+    static void PackTable(const std::vector<uint32_t>& table, size_t width,
+                          PackedTableData& pack);
 };
 
 } // namespace Generator
@@ -19,6 +19,7 @@ enum StdGrammarLexemeEnum
     SGL_push,
     SGL_pop,
     SGL_goto,
+    SGL_nocase,
 
     SGL_prec,
     SGL_left,
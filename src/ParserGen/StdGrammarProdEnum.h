@@ -30,6 +30,7 @@ enum  StdGrammarProductionEnum
     SG_ExprSectionListEmpty,
 
     SG_ExprSection,
+    SG_ExprSectionNoCase,
     SG_ExprSectionError,
 
     SG_ExprBlock,
@@ -43,6 +44,7 @@ enum  StdGrammarProductionEnum
     SG_OptActionPush,
     SG_OptActionPop,
     SG_OptActionGoto,
+    SG_OptActionNoCase,
     SG_OptActionNone,
 
     // Precedence
@@ -54,52 +54,57 @@ inline String const cmdLineGrammar = R"~grammar(
 
 '\@'                                                        opConfigFile,       '@';                        // Uses the configuration file
 
-'\-[lL][rR]'                                                opTableTypeLR,      '-lr';
-'\-[lL][aA][lL][rR]'                                        opTableTypeLALR,    '-lalr';
-'\-[cC][lL][rR]'                                            opTableTypeCLR,     '-clr';
-
-'\-([pP]|([pP][aA][rR][sS][eE]))'                           opParseData,        '-parse';                   // Parse a test data string/file
-'\-[nN][aA][mM][eE][sS][pP][aA][cC][eE][sS]'                opNamespaces,       '-namespaces';              // Enclose generated code into the namespace
-'\-[eE][nN][uU][mM][fF][iI][lL][eE]'                        opEnumFile,         '-enumfile';                // Global enumeration filename
-'\-[eE][nN][uU][mM][cC][lL][aA][sS][sS][eE][sS]'            opEnumClasses,      '-enumclasses';             // Use 'enum class' instead of 'enum'
-'\-[eE][nN][uU][mM][sS][tT][rR][iI][nN][gG][sS]'            opEnumStrings,      '-enumstrings';             // Create string literals for enumeration stringification
-'\-[tT][eE][rR][mM][eE][nN][uU][mM]'                        opTermEnum,         '-termenum';                // Writes out an enumeration of terminals
-'\-[nN][oO][nN][tT][eE][rR][mM][eE][nN][uU][mM]'            opNonTermEnum,      '-nontermenum';             // Writes out an enumeration of nonterminals
-'\-[pP][rR][oO][dD][eE][nN][uU][mM]'                        opProdEnum,         '-prodenum';                // Writes out production enumeration
-'\-(([rR][fF])|([rR][eE][dD][uU][cC][eE][fF][uU][nN][cC]))' opReduceFunc,       '-reducefunc';              // Writes out the reduce function
-'\-[dD][fF][aA]'                                            opStaticDFA,        '-dfa';                     // Create a static DFA structure
-'\-(([pP][tT])|([pP][aA][rR][sS][eE][tT][aA][bB][lL][eE]))' opStaticParseTable, '-parsetable';              // Create a static ParseTable structure
-'\-(([cC][dD])|([cC][aA][nN][oO][nN][iI][cC][aA][lL]))'     opCanonical,        '-canonical';               // Output the Canonical debug data
-'\-(([cC][rR])|([cC][oO][nN][fF][lL][iI][cC][tT][sS]))'     opConflictReport,   '-conflicts';               // Output the Conflict report
-'\-[nN][oO][wW][aA][rR][nN][iI][nN][gG][sS]'                opNoWarnings,       '-nowarnings';              // Control the message handling
-'\-[nN][oO][tT][eE][sS]'                                    opNotes,            '-notes';                   // Control the message handling
-'\-[sS][tT][aA][tT][sS]'                                    opStats,            '-stats';                   // Control the message handling
-'\-(\?|[hH]|([hH][eE][lL][pP]))'                            opHelp,             '-help';                    // Display help (generic and specific)
-'\-([qQ]|([qQ][uU][iI][eE][tT]))'                           opQuietMode,        '-quiet';                   // Prevents screen output
-'\-([vV]|([vV][eE][rR])|([vV][eE][rR][sS][iI][oO][nN]))'    opVersion,          '-version';                 // Displays the program version
-'\-[cC][lL][gG]'                                            opCLGrammar,        '-clg';                     // Writes out the command line grammar
+'\-lr'                                                      opTableTypeLR,      '-lr', %nocase;
+'\-lalr'                                                    opTableTypeLALR,    '-lalr', %nocase;
+'\-clr'                                                     opTableTypeCLR,     '-clr', %nocase;
+
+'\-(p|(parse))'                                             opParseData,        '-parse', %nocase;          // Parse a test data string/file
+'\-namespaces'                                              opNamespaces,       '-namespaces', %nocase;     // Enclose generated code into the namespace
+'\-enumfile'                                                opEnumFile,         '-enumfile', %nocase;       // Global enumeration filename
+'\-enumclasses'                                             opEnumClasses,      '-enumclasses', %nocase;    // Use 'enum class' instead of 'enum'
+'\-enumstrings'                                             opEnumStrings,      '-enumstrings', %nocase;    // Create string literals for enumeration stringification
+'\-termenum'                                                opTermEnum,         '-termenum', %nocase;       // Writes out an enumeration of terminals
+'\-nontermenum'                                             opNonTermEnum,      '-nontermenum', %nocase;    // Writes out an enumeration of nonterminals
+'\-prodenum'                                                opProdEnum,         '-prodenum', %nocase;       // Writes out production enumeration
+'\-((rf)|(reducefunc))'                                     opReduceFunc,       '-reducefunc', %nocase;     // Writes out the reduce function
+'\-dfa'                                                     opStaticDFA,        '-dfa', %nocase;            // Create a static DFA structure
+'\-((pt)|(parsetable))'                                     opStaticParseTable, '-parsetable', %nocase;     // Create a static ParseTable structure
+'\-scanner'                                                 opScanner,          '-scanner', %nocase;        // Create a direct-coded scanner class
+'\-scan'                                                    opScan,             '-scan', %nocase;           // Scan a file for the lexemes
+'\-((cd)|(canonical))'                                      opCanonical,        '-canonical', %nocase;      // Output the Canonical debug data
+'\-((cr)|(conflicts))'                                      opConflictReport,   '-conflicts', %nocase;      // Output the Conflict report
+'\-nowarnings'                                              opNoWarnings,       '-nowarnings', %nocase;     // Control the message handling
+'\-notes'                                                   opNotes,            '-notes', %nocase;          // Control the message handling
+'\-stats'                                                   opStats,            '-stats', %nocase;          // Control the message handling
+'\-(\?|h|(help))'                                           opHelp,             '-help', %nocase;           // Display help (generic and specific)
+'\-(q|(quiet))'                                             opQuietMode,        '-quiet', %nocase;          // Prevents screen output
+'\-(v|(ver)|(version))'                                     opVersion,          '-version', %nocase;        // Displays the program version
+'\-clg'                                                     opCLGrammar,        '-clg', %nocase;            // Writes out the command line grammar
 
 
 //----------------------------------------
 // Option Parameters
 //----------------------------------------
 
-'\+([fF]|([fF][iI][lL][eE][nN][aA][mM][eE]))'               fileNameParam,      '+filename';
-'\+([nN]|([nN][sS][nN][aA][mM][eE]))'                       namespaceNameParam, '+nsname';
-'\+([cC]|([cC][lL][aA][sS][sS][nN][aA][mM][eE]))'           classNameParam,     '+classname';
-'\+([sS]|([sS][tT][aA][cC][kK][nN][aA][mM][eE]))'           stackNameParam,     '+stackname';
-'\+([pP]|([pP][rR][eE][fF][iI][xX]))'                       prefixParam,        '+prefix';
+'\+(f|(filename))'                                          fileNameParam,      '+filename', %nocase;
+'\+(n|(nsname))'                                            namespaceNameParam, '+nsname', %nocase;
+'\+(c|(classname))'                                         classNameParam,     '+classname', %nocase;
+'\+(s|(stackname))'                                         stackNameParam,     '+stackname', %nocase;
+'\+(p|(prefix))'                                            prefixParam,        '+prefix', %nocase;
+'\+stride'                                                  strideParam,        '+stride', %nocase;
+'\+compress'                                                compressParam,      '+compress', %nocase;
+'\+defaultreduce'                                           defaultReduceParam, '+defaultreduce', %nocase;
 
-'\+(([sS][tT][rR])|([sS][tT][rR][iI][nN][gG]))'             stringParam,        '+string';
+'\+((str)|(string))'                                        stringParam,        '+string', %nocase;
 
-'\+([oO][pP][tT][iI][oO][nN])'                              optionParam,        '+option';
-'\+([mM][sS][gG])'                                          messageParam,       '+msg';
-'\+([dD][fF][aA])'                                          dfaParam,           '+dfa';
-'\+[lL][iI][nN][eE][sS]'                                    linesParam,         '+lines';
-'\+[lL][aA][bB][eE][lL][sS]'                                labelsParam,        '+labels';
-'\+[pP][oO][iI][nN][tT][sS]'                                pointsParam,        '+points';
+'\+(option)'                                                optionParam,        '+option', %nocase;
+'\+(msg)'                                                   messageParam,       '+msg', %nocase;
+'\+(dfa)'                                                   dfaParam,           '+dfa', %nocase;
+'\+lines'                                                   linesParam,         '+lines', %nocase;
+'\+labels'                                                  labelsParam,        '+labels', %nocase;
+'\+points'                                                  pointsParam,        '+points', %nocase;
 
-'\+([dD]|([dD][iI][sS][pP][lL][aA][yY]))'                   displayParam,       '+display';
+'\+(d|(display))'                                           displayParam,       '+display', %nocase;
 
 
 %expression StringLiteral
@@ -232,6 +237,7 @@ StaticDFAParamListEmpty             StaticDFAParamList          -> ;
 
 StaticDFAFileNameParam              StaticDFAParam              -> '+filename' ':' FileName;
 StaticDFAClassNameParam             StaticDFAParam              -> '+classname' ':' ClassName;
+StaticDFAStrideParam                StaticDFAParam              -> '+stride';
 
 // *** StaticParseTable
 
@@ -242,6 +248,26 @@ StaticParseTableParamListEmpty      StaticParseTableParamList   -> ;
 
 StaticParseTableFileNameParam       StaticParseTableParam       -> '+filename' ':' FileName;
 StaticParseTableClassNameParam      StaticParseTableParam       -> '+classname' ':' ClassName;
+StaticParseTableCompressParam       StaticParseTableParam       -> '+compress';
+StaticParseTableDefaultReduceParam  StaticParseTableParam       -> '+defaultreduce';
+
+// *** Scanner
+
+ScannerOption                       Option                      -> '-scanner' ScannerParamList;
+
+ScannerParamList                    ScannerParamList            -> ScannerParam ScannerParamList;
+ScannerParamListEmpty               ScannerParamList            -> ;
+
+ScannerFileNameParam                ScannerParam                -> '+filename' ':' FileName;
+ScannerClassNameParam               ScannerParam                -> '+classname' ':' ClassName;
+
+
+// *** Scan
+
+ScanOption                          Option                      -> '-scan' ScanParam;
+
+ScanFileNameParam                   ScanParam                   -> '+filename' ':' FileName;
+ScanFileNameParamEmpty              ScanParam                   -> ;
 
 
 // *** Canonical
@@ -6,6 +6,7 @@
 #include "CmdLineProdEnum.h"
 #include "FileInputStream.h"
 #include "FileOutputStream.h"
+#include "MappedFileInputStream.h"
 
 #include <filesystem>
 
@@ -245,6 +246,16 @@ bool CmdLineParseHandler::Reduce(Parse<ParseStackGenericElement>& parse, unsigne
             SetOption("StaticParse_Table");
             break;
 
+        // Option -> '-scanner' ScannerParamList
+        case CL_ScannerOption:
+            SetOption("Scanner");
+            break;
+
+        // Option -> '-scan' ScanParam
+        case CL_ScanOption:
+            SetOption("Scan");
+            break;
+
         // Option -> '-canonical' CanonicalParamList
         case CL_CanonicalOption:
             SetOption("Canonical");
@@ -444,6 +455,11 @@ bool CmdLineParseHandler::Reduce(Parse<ParseStackGenericElement>& parse, unsigne
             SetOptionParam("StaticDFA", "Classname", parse[2].Str);
             break;
 
+        // StaticDFAParam -> '+stride'
+        case CL_StaticDFAStrideParam:
+            SetOptionParam("StaticDFA", "Stride", "1");
+            break;
+
         // StaticParseTableParamList -> StaticParseTableParam StaticParseTableParamList
         case CL_StaticParseTableParamList:
             break;
@@ -458,6 +474,42 @@ bool CmdLineParseHandler::Reduce(Parse<ParseStackGenericElement>& parse, unsigne
             SetOptionParam("StaticParseTable", "Classname", parse[2].Str);
             break;
 
+        // StaticParseTableParam -> '+compress'
+        case CL_StaticParseTableCompressParam:
+            SetOptionParam("StaticParseTable", "Compress", "1");
+            break;
+
+        // StaticParseTableParam -> '+defaultreduce'
+        case CL_StaticParseTableDefaultReduceParam:
+            SetOptionParam("StaticParseTable", "DefaultReduce", "1");
+            break;
+
+        // ScannerParamList -> ScannerParam ScannerParamList
+        case CL_ScannerParamList:
+            break;
+
+        case CL_ScannerParamListEmpty:
+            break;
+
+        // ScannerParam -> '+filename' ':' FileName
+        case CL_ScannerFileNameParam:
+            SetOptionParam("Scanner", "Filename", parse[2].Str);
+            break;
+
+        // ScannerParam -> '+classname' ':' 'ClassName'
+        case CL_ScannerClassNameParam:
+            SetOptionParam("Scanner", "Classname", parse[2].Str);
+            break;
+
+        // ScanParam -> '+filename' ':' FileName
+        case CL_ScanFileNameParam:
+            SetOptionParam("Scan", "Filename", parse[2].Str);
+            break;
+
+        // ScanParam -> <empty>
+        case CL_ScanFileNameParamEmpty:
+            break;
+
         // CanonicalParam -> '+filename' ':' FileName
         case CL_CanonicalFileNameParam:
             SetOptionParam("Canonical", "Filename", parse[2].Str);
@@ -564,9 +616,17 @@ const char* CmdLineParseHandler::GetHelpText() const noexcept {
         "-dfa                  Create a StaticDFA structure\n"
         "                          [+f[ilename]:<targetfile>]   DFA table output file\n"
         "                          [+c[lassname]:<classname>]   staticDFA object name\n"
+        "                          [+stride]                    2-byte stride transitions\n"
         "-pt,-parsetable       Create a StaticParseTable structure\n"
         "                          [+f[ilename]:<targetfile>]   Parse table output file\n"
         "                          [+c[lassname]:<classname>]   StaticParseTable name\n"
+        "                          [+compress]                  compressed tables\n"
+        "                          [+defaultreduce]             default reductions\n"
+        "-scanner              Create a direct-coded scanner class\n"
+        "                          [+f[ilename]:<targetfile>]   Scanner output file\n"
+        "                          [+c[lassname]:<classname>]   Scanner class name\n"
+        "-scan                 Scan a file for the lexemes, printing the matches\n"
+        "                          [+f[ilename]:<scanfile>]     specify scanned file\n"
         "-cd,-canonical[data]  Store the canonical data to a file\n"
         "                          [[+f[ilename]]:<targetfile>] destination output file\n"
         "-cr,-conflicts        Create the extended conflict report\n"
@@ -707,7 +767,7 @@ void CmdLineParseHandler::Execute(Generator::StdGrammarParseData& parseData) {
                                 messageFlags | ParseMessageBuffer::MessageQuickPrint);
 
     // Open the tokenizer input file
-    if (!tokenFileInput.Open(GrammarFileName)) {
+    if (!tokenFileInput.Open(GrammarFileName, true)) {
         // ERROR: Opening file
         if (pmessages->GetMessageFlags() & ParseMessageBuffer::MessageError) {
             const auto str = "Failed to open the user grammar file - '" + GrammarFileName + "' ";
@@ -1048,6 +1108,14 @@ void CmdLineParseHandler::Execute(Generator::StdGrammarParseData& parseData) {
         GetOptionParam("StaticDFA", "Filename", filename);
         GetOptionParam("StaticDFA", "Classname", classname);
 
+        // Pair transitions need the character classes combined, so that their rows are compact
+        if (CheckOptionParam("StaticDFA", "Stride")) {
+            dfa.Compress(0u, DFAGen::CT_CombineDuplicate);
+            const auto pairRowCount = dfa.CreatePairTable();
+            output.Add(StringWithFormat("Created 2-byte stride transitions for %zu of %zu states",
+                                        pairRowCount, dfa.GetStateCount()));
+        }
+
         // Create the production switch
         dfa.CreateStaticDFA(staticDFA, classname, namespaceName);
 
@@ -1081,6 +1149,19 @@ void CmdLineParseHandler::Execute(Generator::StdGrammarParseData& parseData) {
         GetOptionParam("StaticParseTable", "Filename", filename);
         GetOptionParam("StaticParseTable", "Classname", classname);
 
+        // Reduce without the lookahead in the states with a single reduce action
+        if (CheckOptionParam("StaticParseTable", "DefaultReduce"))
+            output.Add(StringWithFormat("Set default reductions in %zu states",
+                                        parseTable.SetDefaultReductions()));
+
+        // Pack the action and goto tables, which also makes the test parsing use them
+        if (CheckOptionParam("StaticParseTable", "Compress")) {
+            const auto tableSize = parseTable.GetStaticTableSize();
+            parseTable.Compress();
+            output.Add(StringWithFormat("Compressed the parse tables from %zu to %zu bytes",
+                                        tableSize, parseTable.GetStaticTableSize()));
+        }
+
         // Create the production switch
         parseTable.CreateStaticParseTable(staticParseTable, classname, namespaceName);
 
@@ -1103,6 +1184,71 @@ void CmdLineParseHandler::Execute(Generator::StdGrammarParseData& parseData) {
         }
     }
 
+    // Scanner
+    if (CheckOption("Scanner")) {
+        FileOutputStream file;
+        String scanner;
+        String filename  = "Scanner.h";
+        String classname = "Scanner";
+
+        // Set the default value
+        GetOptionParam("Scanner", "Filename", filename);
+        GetOptionParam("Scanner", "Classname", classname);
+
+        // Create the scanner class
+        dfa.CreateScanner(scanner, classname, namespaceName);
+
+        // Open the file
+        if (file.Open(filename, FileOutputStream::Mode::Truncate)) {
+            TextOutputStream tstream{file};
+            // Dump the pseudo-copyright header
+            tstream.WriteText(copyrightHeader);
+            // Dump the string
+            tstream.WriteText(scanner);
+
+            output.Add("Wrote the scanner class to '" + filename + "'");
+        } else {
+            // ERROR: Opening file
+            if (pmessages->GetMessageFlags() & ParseMessageBuffer::MessageError) {
+                const auto str = "Failed to open '" + filename + "' file";
+                const ParseMessage msg{ParseMessage::ErrorMessage, "FL0001E", str};
+                pmessages->AddMessage(msg);
+            }
+        }
+    }
+
+    // Scan a file
+    // Outputs the lexemes found, matched directly on the mapped file data
+    if (CheckOption("Scan")) {
+        MappedFileInputStream file;
+        String                filename = "ScanData.txt";
+        GetOptionParam("Scan", "Filename", filename);
+
+        if (file.Open(filename)) {
+            size_t      size  = 0u;
+            const auto  pdata = reinterpret_cast<const char*>(file.GetContiguousData(size));
+            const auto& lex   = parseData.GetLex();
+            size_t      count = 0u;
+
+            // Lexeme IDs start with 2, after the error and EOF tokens
+            dfa.Scan(pdata, size, [&](const DFA::Match& match) {
+                if (!output.Quiet)
+                    std::printf("%zu %zu %s\n", match.Offset, match.Length,
+                                lex.Lexemes[match.LexemeID - 2u].Name.data());
+                ++count;
+            });
+
+            output.Add(StringWithFormat("Found %zu lexemes in '%s'", count, filename.data()));
+        } else {
+            // ERROR: Opening file
+            if (pmessages->GetMessageFlags() & ParseMessageBuffer::MessageError) {
+                const auto str = "Failed to open '" + filename + "' file";
+                const ParseMessage msg{ParseMessage::ErrorMessage, "FL0001E", str};
+                pmessages->AddMessage(msg);
+            }
+        }
+    }
+
     // Test an expression
     // Outputs the reductions
     if (CheckOption("ParseData")) {
@@ -70,12 +70,25 @@ enum CmdLineProdEnum
     CL_StaticDFAParamListEmpty,
     CL_StaticDFAFileNameParam,
     CL_StaticDFAClassNameParam,
+    CL_StaticDFAStrideParam,
 
     CL_StaticParseTableOption,
     CL_StaticParseTableParamList,
     CL_StaticParseTableParamListEmpty,
     CL_StaticParseTableFileNameParam,
     CL_StaticParseTableClassNameParam,
+    CL_StaticParseTableCompressParam,
+    CL_StaticParseTableDefaultReduceParam,
+
+    CL_ScannerOption,
+    CL_ScannerParamList,
+    CL_ScannerParamListEmpty,
+    CL_ScannerFileNameParam,
+    CL_ScannerClassNameParam,
+
+    CL_ScanOption,
+    CL_ScanFileNameParam,
+    CL_ScanFileNameParamEmpty,
 
     CL_CanonicalOption,
     CL_CanonicalFileNameParam,
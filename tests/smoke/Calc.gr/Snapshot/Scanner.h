@@ -0,0 +1,387 @@
+// This is a generated file.
+// Copyright is in `Calc.gr` - see that file for details.
+
+#include "Tokenizer.h"
+
+#include <vector>
+
+// Direct-coded tokenizer generated from the DFA
+template <class Token>
+class Scanner : public SGParser::TokenizerImpl<Token>
+{
+public:
+    // Default constructor
+    Scanner() = default;
+
+    // Initialization constructor
+    explicit Scanner(SGParser::InputStream* pinputStream) { Create(pinputStream); }
+
+    // Initializes the tokenizer to use a specified input stream
+    bool Create(SGParser::InputStream* pinputStream) {
+        if (!SetInputStream(pinputStream))
+            return false;
+        ExpressionStackTop = 0u;
+        ExpressionStack.clear();
+        return true;
+    }
+
+    // *** Token Stream interface
+
+    // Return next token / EOF Token
+    Token& GetNextToken(Token& token) override;
+
+    // Fill in up to count tokens, stopping after EOF
+    size_t GetTokens(Token* ptokens, size_t count) override {
+        size_t index = 0u;
+        while (index < count)
+            if (Scanner::GetNextToken(ptokens[index++]).Code ==
+                SGParser::TokenCode::TokenEOF)
+                break;
+        return index;
+    }
+
+private:
+    using CodeType = typename Token::CodeType;
+
+    using typename SGParser::TokenizerBase::ByteReader;
+    using typename SGParser::TokenizerImpl<Token>::InputCharReader;
+    using typename SGParser::TokenizerImpl<Token>::BufferPos;
+    using typename SGParser::TokenizerImpl<Token>::PosTracker;
+    using SGParser::TokenizerImpl<Token>::SetInputStream;
+    using SGParser::TokenizerImpl<Token>::HeadPos;
+    using SGParser::TokenizerImpl<Token>::TailPos;
+    using SGParser::TokenizerImpl<Token>::GetHeadPos;
+    using SGParser::TokenizerImpl<Token>::GetTailPos;
+    using SGParser::TokenizerImpl<Token>::SetTailPos;
+    using SGParser::TokenizerImpl<Token>::AdjustHead;
+
+    unsigned              ExpressionStackTop = 0u;
+
+    // Expression stack, controls starting state
+    std::vector<unsigned> ExpressionStack;
+};
+
+template <class Token>
+Token& Scanner<Token>::GetNextToken(Token& token) {
+    CodeType        code;
+    InputCharReader charReader{ByteReader{*this}, TailPos};
+
+    do {
+        HeadPos = TailPos;
+        AdjustHead();
+
+        if (charReader.IsEOF()) {
+            token.CopyFromTokenizer(SGParser::TokenCode::TokenEOF, *this);
+            return token;
+        }
+
+        // Lexeme 0 means nothing has been recognized yet
+        unsigned   lastLexemeID = 0u;
+        BufferPos  lastTail;
+        BufferPos  startHead{GetHeadPos()};
+        PosTracker lastTailPos{TailPos};
+        bool       advanced;
+
+        switch (ExpressionStackTop) {
+            case 0u: goto Dispatch0;
+            default: goto Done;
+        }
+
+    Dispatch0:
+        switch (charReader.GetChar()) {
+            case 0x09: case 0x20:
+                goto State1;
+            case 0x0A:
+                goto State2;
+            case 0x28:
+                goto State3;
+            case 0x29:
+                goto State4;
+            case 0x2A:
+                goto State5;
+            case 0x2B:
+                goto State6;
+            case 0x2D:
+                goto State7;
+            case 0x2E:
+                goto State8;
+            case 0x2F:
+                goto State9;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State10;
+            case 0x3A:
+                goto State11;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x5F: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65:
+            case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D:
+            case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75:
+            case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State12;
+            case 0x5E:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State1:
+        charReader.Advance();
+        lastLexemeID = 12u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State2:
+        charReader.Advance();
+        lastLexemeID = 13u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State3:
+        charReader.Advance();
+        lastLexemeID = 9u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State4:
+        charReader.Advance();
+        lastLexemeID = 10u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State5:
+        charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State6:
+        charReader.Advance();
+        lastLexemeID = 3u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State7:
+        charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State8:
+        advanced = charReader.Advance();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State14;
+            default:
+                goto Done;
+        }
+
+    State9:
+        charReader.Advance();
+        lastLexemeID = 6u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State10:
+        advanced = charReader.Advance();
+        lastLexemeID = 2u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State8;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State10;
+            default:
+                goto Done;
+        }
+
+    State11:
+        advanced = charReader.Advance();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x3D:
+                goto State15;
+            default:
+                goto Done;
+        }
+
+    State12:
+        advanced = charReader.Advance();
+        lastLexemeID = 11u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State16;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x5F: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65:
+            case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D:
+            case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75:
+            case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State17;
+            default:
+                goto Done;
+        }
+
+    State13:
+        charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State14:
+        advanced = charReader.Advance();
+        lastLexemeID = 2u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State14;
+            default:
+                goto Done;
+        }
+
+    State15:
+        charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State16:
+        advanced = charReader.Advance();
+        lastLexemeID = 11u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46:
+            case 0x47: case 0x48: case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E:
+            case 0x4F: case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56:
+            case 0x57: case 0x58: case 0x59: case 0x5A: case 0x5F: case 0x61: case 0x62: case 0x63:
+            case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B:
+            case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73:
+            case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State16;
+            default:
+                goto Done;
+        }
+
+    State17:
+        advanced = charReader.Advance();
+        lastLexemeID = 11u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State16;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x5F: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65:
+            case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D:
+            case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75:
+            case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State17;
+            default:
+                goto Done;
+        }
+
+    Done:
+        if (lastLexemeID == 0u) {
+            if (charReader.IsEOF() && startHead == GetTailPos())
+                code = SGParser::TokenCode::TokenEOF;
+            else {
+                SetTailPos(startHead);
+                TailPos = HeadPos;
+                code    = SGParser::TokenCode::TokenError;
+                // Skip the character in error from the rewound tail
+                if (!charReader.IsEOF())
+                    InputCharReader{ByteReader{*this}, TailPos}.Advance();
+            }
+            token.CopyFromTokenizer(code, *this);
+            return token;
+        }
+
+        SetTailPos(lastTail);
+        TailPos = lastTailPos;
+
+        switch (lastLexemeID) {
+            case 2u:
+                code = 2u;
+                break;
+            case 3u:
+                code = 3u;
+                break;
+            case 4u:
+                code = 4u;
+                break;
+            case 5u:
+                code = 5u;
+                break;
+            case 6u:
+                code = 6u;
+                break;
+            case 7u:
+                code = 7u;
+                break;
+            case 8u:
+                code = 8u;
+                break;
+            case 9u:
+                code = 9u;
+                break;
+            case 10u:
+                code = 10u;
+                break;
+            case 11u:
+                code = 11u;
+                break;
+            case 12u:
+                code = 0u;
+                break;
+            case 13u:
+                code = 12u;
+                break;
+            default:
+                code = 0u;
+                break;
+        }
+
+        // if code == 0, then ignore token
+    } while (code == 0u);
+
+    token.CopyFromTokenizer(code, *this);
+    return token;
+}
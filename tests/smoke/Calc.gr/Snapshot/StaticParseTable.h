@@ -5,7 +5,7 @@
 
 #include <cstdint>
 
-static uint16_t StaticParseTableData_ActionTable[28][13] =
+static const uint16_t StaticParseTableData_ActionTable[28][13] =
 {
     {0x0000, 0x0000, 0x8008, 0x0000, 0x8002, 0x0000, 0x0000, 0x0000, 0x0000, 0x8001, 0x0000, 0x8007, 0x8005},
     {0x0000, 0x0000, 0x8008, 0x0000, 0x8002, 0x0000, 0x0000, 0x0000, 0x0000, 0x8001, 0x0000, 0x800B, 0x0000},
@@ -37,7 +37,7 @@ static uint16_t StaticParseTableData_ActionTable[28][13] =
     {0x0000, 0x400F, 0x400F, 0x800E, 0x800F, 0x800D, 0x8010, 0x8011, 0x0000, 0x400F, 0x0000, 0x400F, 0x400F}
 };
 
-static uint16_t StaticParseTableData_GotoTable[28][4] =
+static const uint16_t StaticParseTableData_GotoTable[28][4] =
 {
     {0x0009, 0x0004, 0x0006, 0x0003},
     {0xFFFF, 0xFFFF, 0x000A, 0xFFFF},
@@ -69,31 +69,31 @@ static uint16_t StaticParseTableData_GotoTable[28][4] =
     {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF}
 };
 
-static uint32_t StaticParseTableData_ReduceProduction[17][4] =
+static const SGParser::ParseTable::ReduceProduction StaticParseTableData_ReduceProduction[17] =
 {
     {1, 0, 0, 0}, {2, 0, 0, 0}, {1, 0, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {1, 1, 0, 0}, {1, 2, 0, 0}, {1, 2, 0, 0}, {2, 2, 0, 0}, {3, 2, 0, 0},
     {3, 2, 0, 0}, {3, 2, 0, 0}, {3, 2, 0, 0}, {3, 2, 0, 0}, {3, 2, 0, 0}, {3, 3, 0, 0}, {3, 3, 0, 0}
 };
 
-static uint16_t StaticParseTableData_Nonterminals[4] =
+static const SGParser::ParseTable::NonTerminal StaticParseTableData_Nonterminals[4] =
 {
-    0x0000, 0xFFFF, 0xFFFF, 0xFFFF
+    {0x0000}, {0xFFFFFFFF}, {0xFFFFFFFF}, {0xFFFFFFFF}
 };
 
-static uint8_t StaticParseTableData_Terminals[13] =
+static const SGParser::ParseTable::Terminal StaticParseTableData_Terminals[13] =
 {
-    1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0
+    {1}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0}, {0},
+    {0}, {0}, {0}
 };
 
-static uint8_t StaticParseTableData_StateInfos[28][2] =
+static const SGParser::ParseTable::StateInfo StaticParseTableData_StateInfos[28] =
 {
-    {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0},
-    {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0},
-    {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}
+    {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000},
+    {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000},
+    {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}, {0, 0, 0x00000000}
 };
 
-static SGParser::StaticParseTable StaticParseTableData =
+static const SGParser::StaticParseTable StaticParseTableData =
 {
     SGParser::ParseTableType::CLR,
     28u,
@@ -103,13 +103,19 @@ static SGParser::StaticParseTable StaticParseTableData =
     4u,
     StaticParseTableData_GotoTable[0u],
     17u,
-    StaticParseTableData_ReduceProduction[0u],
+    StaticParseTableData_ReduceProduction,
     4u,
     StaticParseTableData_Nonterminals,
     13u,
     StaticParseTableData_Terminals,
     28u,
-    StaticParseTableData_StateInfos[0u],
+    StaticParseTableData_StateInfos,
     0u,
-    nullptr
+    nullptr,
+    {0u, nullptr, nullptr, nullptr, nullptr, nullptr},
+    {0u, nullptr, nullptr, nullptr, nullptr, nullptr},
+    nullptr,
+    nullptr,
+    {0u, nullptr, nullptr, nullptr, nullptr, nullptr},
+    {0u, nullptr, nullptr, nullptr, nullptr, nullptr}
 };
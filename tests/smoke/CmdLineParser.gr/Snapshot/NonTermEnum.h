@@ -27,10 +27,13 @@ enum NonTermEnum
     /*19*/ NTE_StaticDFAParam,
     /*20*/ NTE_StaticParseTableParamList,
     /*21*/ NTE_StaticParseTableParam,
-    /*22*/ NTE_CanonicalParam,
-    /*23*/ NTE_ConflictReportParamList,
-    /*24*/ NTE_ConflictReportParam,
-    /*25*/ NTE_HelpParamList,
-    /*26*/ NTE_HelpParam,
-    /*27*/ NTE_CmdLineGrammarParam
+    /*22*/ NTE_ScannerParamList,
+    /*23*/ NTE_ScannerParam,
+    /*24*/ NTE_ScanParam,
+    /*25*/ NTE_CanonicalParam,
+    /*26*/ NTE_ConflictReportParamList,
+    /*27*/ NTE_ConflictReportParam,
+    /*28*/ NTE_HelpParamList,
+    /*29*/ NTE_HelpParam,
+    /*30*/ NTE_CmdLineGrammarParam
 };
@@ -30,12 +30,15 @@ enum class NonTermEnum
     /*19*/ StaticDFAParam,
     /*20*/ StaticParseTableParamList,
     /*21*/ StaticParseTableParam,
-    /*22*/ CanonicalParam,
-    /*23*/ ConflictReportParamList,
-    /*24*/ ConflictReportParam,
-    /*25*/ HelpParamList,
-    /*26*/ HelpParam,
-    /*27*/ CmdLineGrammarParam
+    /*22*/ ScannerParamList,
+    /*23*/ ScannerParam,
+    /*24*/ ScanParam,
+    /*25*/ CanonicalParam,
+    /*26*/ ConflictReportParamList,
+    /*27*/ ConflictReportParam,
+    /*28*/ HelpParamList,
+    /*29*/ HelpParam,
+    /*30*/ CmdLineGrammarParam
 };
 
 constexpr char const* const StringifyEnumNonTermEnum[] =
@@ -62,12 +65,15 @@ constexpr char const* const StringifyEnumNonTermEnum[] =
     /*19*/ "StaticDFAParam",
     /*20*/ "StaticParseTableParamList",
     /*21*/ "StaticParseTableParam",
-    /*22*/ "CanonicalParam",
-    /*23*/ "ConflictReportParamList",
-    /*24*/ "ConflictReportParam",
-    /*25*/ "HelpParamList",
-    /*26*/ "HelpParam",
-    /*27*/ "CmdLineGrammarParam"
+    /*22*/ "ScannerParamList",
+    /*23*/ "ScannerParam",
+    /*24*/ "ScanParam",
+    /*25*/ "CanonicalParam",
+    /*26*/ "ConflictReportParamList",
+    /*27*/ "ConflictReportParam",
+    /*28*/ "HelpParamList",
+    /*29*/ "HelpParam",
+    /*30*/ "CmdLineGrammarParam"
 };
 
 } // namespace XC
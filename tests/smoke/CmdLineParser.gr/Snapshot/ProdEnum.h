@@ -59,38 +59,49 @@ enum ProductionEnum
     /*51*/ PE_StaticDFAParamListEmpty,
     /*52*/ PE_StaticDFAFileNameParam,
     /*53*/ PE_StaticDFAClassNameParam,
-    /*54*/ PE_StaticParseTableOption,
-    /*55*/ PE_StaticParseTableParamList,
-    /*56*/ PE_StaticParseTableParamListEmpty,
-    /*57*/ PE_StaticParseTableFileNameParam,
-    /*58*/ PE_StaticParseTableClassNameParam,
-    /*59*/ PE_CanonicalOption,
-    /*60*/ PE_CanonicalFileNameParam,
-    /*61*/ PE_CanonicalFileNameParamEmpty,
-    /*62*/ PE_ConflictReportOption,
-    /*63*/ PE_ConflictReportParamList,
-    /*64*/ PE_ConflictReportParamListEmpty,
-    /*65*/ PE_ConflictReportFileNameParam,
-    /*66*/ PE_ConflictReportLinesParam,
-    /*67*/ PE_ConflictReportLabelsParam,
-    /*68*/ PE_ConflictReportPointsParam,
-    /*69*/ PE_WarningOption,
-    /*70*/ PE_NotesOption,
-    /*71*/ PE_StatsOption,
-    /*72*/ PE_HelpOption,
-    /*73*/ PE_HelpParamList,
-    /*74*/ PE_HelpParamListEmpty,
-    /*75*/ PE_HelpMessageParam,
-    /*76*/ PE_HelpOptionParam,
-    /*77*/ PE_QuietModeOption,
-    /*78*/ PE_VersionOption,
-    /*79*/ PE_CmdLineGrammarOption,
-    /*80*/ PE_CmdLineGrammarFileNameParam1,
-    /*81*/ PE_CmdLineGrammarFileNameParam2,
-    /*82*/ PE_CmdLineGrammarFileNameParamEmpty,
-    /*83*/ PE_FileName1,
-    /*84*/ PE_FileName2,
-    /*85*/ PE_FileName3,
-    /*86*/ PE_ClassName1,
-    /*87*/ PE_ClassName2
+    /*54*/ PE_StaticDFAStrideParam,
+    /*55*/ PE_StaticParseTableOption,
+    /*56*/ PE_StaticParseTableParamList,
+    /*57*/ PE_StaticParseTableParamListEmpty,
+    /*58*/ PE_StaticParseTableFileNameParam,
+    /*59*/ PE_StaticParseTableClassNameParam,
+    /*60*/ PE_StaticParseTableCompressParam,
+    /*61*/ PE_StaticParseTableDefaultReduceParam,
+    /*62*/ PE_ScannerOption,
+    /*63*/ PE_ScannerParamList,
+    /*64*/ PE_ScannerParamListEmpty,
+    /*65*/ PE_ScannerFileNameParam,
+    /*66*/ PE_ScannerClassNameParam,
+    /*67*/ PE_ScanOption,
+    /*68*/ PE_ScanFileNameParam,
+    /*69*/ PE_ScanFileNameParamEmpty,
+    /*70*/ PE_CanonicalOption,
+    /*71*/ PE_CanonicalFileNameParam,
+    /*72*/ PE_CanonicalFileNameParamEmpty,
+    /*73*/ PE_ConflictReportOption,
+    /*74*/ PE_ConflictReportParamList,
+    /*75*/ PE_ConflictReportParamListEmpty,
+    /*76*/ PE_ConflictReportFileNameParam,
+    /*77*/ PE_ConflictReportLinesParam,
+    /*78*/ PE_ConflictReportLabelsParam,
+    /*79*/ PE_ConflictReportPointsParam,
+    /*80*/ PE_WarningOption,
+    /*81*/ PE_NotesOption,
+    /*82*/ PE_StatsOption,
+    /*83*/ PE_HelpOption,
+    /*84*/ PE_HelpParamList,
+    /*85*/ PE_HelpParamListEmpty,
+    /*86*/ PE_HelpMessageParam,
+    /*87*/ PE_HelpOptionParam,
+    /*88*/ PE_QuietModeOption,
+    /*89*/ PE_VersionOption,
+    /*90*/ PE_CmdLineGrammarOption,
+    /*91*/ PE_CmdLineGrammarFileNameParam1,
+    /*92*/ PE_CmdLineGrammarFileNameParam2,
+    /*93*/ PE_CmdLineGrammarFileNameParamEmpty,
+    /*94*/ PE_FileName1,
+    /*95*/ PE_FileName2,
+    /*96*/ PE_FileName3,
+    /*97*/ PE_ClassName1,
+    /*98*/ PE_ClassName2
 };
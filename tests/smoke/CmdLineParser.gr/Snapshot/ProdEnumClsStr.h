@@ -62,40 +62,51 @@ enum class ProductionEnum
     /*51*/ StaticDFAParamListEmpty,
     /*52*/ StaticDFAFileNameParam,
     /*53*/ StaticDFAClassNameParam,
-    /*54*/ StaticParseTableOption,
-    /*55*/ StaticParseTableParamList,
-    /*56*/ StaticParseTableParamListEmpty,
-    /*57*/ StaticParseTableFileNameParam,
-    /*58*/ StaticParseTableClassNameParam,
-    /*59*/ CanonicalOption,
-    /*60*/ CanonicalFileNameParam,
-    /*61*/ CanonicalFileNameParamEmpty,
-    /*62*/ ConflictReportOption,
-    /*63*/ ConflictReportParamList,
-    /*64*/ ConflictReportParamListEmpty,
-    /*65*/ ConflictReportFileNameParam,
-    /*66*/ ConflictReportLinesParam,
-    /*67*/ ConflictReportLabelsParam,
-    /*68*/ ConflictReportPointsParam,
-    /*69*/ WarningOption,
-    /*70*/ NotesOption,
-    /*71*/ StatsOption,
-    /*72*/ HelpOption,
-    /*73*/ HelpParamList,
-    /*74*/ HelpParamListEmpty,
-    /*75*/ HelpMessageParam,
-    /*76*/ HelpOptionParam,
-    /*77*/ QuietModeOption,
-    /*78*/ VersionOption,
-    /*79*/ CmdLineGrammarOption,
-    /*80*/ CmdLineGrammarFileNameParam1,
-    /*81*/ CmdLineGrammarFileNameParam2,
-    /*82*/ CmdLineGrammarFileNameParamEmpty,
-    /*83*/ FileName1,
-    /*84*/ FileName2,
-    /*85*/ FileName3,
-    /*86*/ ClassName1,
-    /*87*/ ClassName2
+    /*54*/ StaticDFAStrideParam,
+    /*55*/ StaticParseTableOption,
+    /*56*/ StaticParseTableParamList,
+    /*57*/ StaticParseTableParamListEmpty,
+    /*58*/ StaticParseTableFileNameParam,
+    /*59*/ StaticParseTableClassNameParam,
+    /*60*/ StaticParseTableCompressParam,
+    /*61*/ StaticParseTableDefaultReduceParam,
+    /*62*/ ScannerOption,
+    /*63*/ ScannerParamList,
+    /*64*/ ScannerParamListEmpty,
+    /*65*/ ScannerFileNameParam,
+    /*66*/ ScannerClassNameParam,
+    /*67*/ ScanOption,
+    /*68*/ ScanFileNameParam,
+    /*69*/ ScanFileNameParamEmpty,
+    /*70*/ CanonicalOption,
+    /*71*/ CanonicalFileNameParam,
+    /*72*/ CanonicalFileNameParamEmpty,
+    /*73*/ ConflictReportOption,
+    /*74*/ ConflictReportParamList,
+    /*75*/ ConflictReportParamListEmpty,
+    /*76*/ ConflictReportFileNameParam,
+    /*77*/ ConflictReportLinesParam,
+    /*78*/ ConflictReportLabelsParam,
+    /*79*/ ConflictReportPointsParam,
+    /*80*/ WarningOption,
+    /*81*/ NotesOption,
+    /*82*/ StatsOption,
+    /*83*/ HelpOption,
+    /*84*/ HelpParamList,
+    /*85*/ HelpParamListEmpty,
+    /*86*/ HelpMessageParam,
+    /*87*/ HelpOptionParam,
+    /*88*/ QuietModeOption,
+    /*89*/ VersionOption,
+    /*90*/ CmdLineGrammarOption,
+    /*91*/ CmdLineGrammarFileNameParam1,
+    /*92*/ CmdLineGrammarFileNameParam2,
+    /*93*/ CmdLineGrammarFileNameParamEmpty,
+    /*94*/ FileName1,
+    /*95*/ FileName2,
+    /*96*/ FileName3,
+    /*97*/ ClassName1,
+    /*98*/ ClassName2
 };
 
 constexpr char const* const StringifyEnumProductionEnum[] =
@@ -154,40 +165,51 @@ constexpr char const* const StringifyEnumProductionEnum[] =
     /*51*/ "StaticDFAParamListEmpty",
     /*52*/ "StaticDFAFileNameParam",
     /*53*/ "StaticDFAClassNameParam",
-    /*54*/ "StaticParseTableOption",
-    /*55*/ "StaticParseTableParamList",
-    /*56*/ "StaticParseTableParamListEmpty",
-    /*57*/ "StaticParseTableFileNameParam",
-    /*58*/ "StaticParseTableClassNameParam",
-    /*59*/ "CanonicalOption",
-    /*60*/ "CanonicalFileNameParam",
-    /*61*/ "CanonicalFileNameParamEmpty",
-    /*62*/ "ConflictReportOption",
-    /*63*/ "ConflictReportParamList",
-    /*64*/ "ConflictReportParamListEmpty",
-    /*65*/ "ConflictReportFileNameParam",
-    /*66*/ "ConflictReportLinesParam",
-    /*67*/ "ConflictReportLabelsParam",
-    /*68*/ "ConflictReportPointsParam",
-    /*69*/ "WarningOption",
-    /*70*/ "NotesOption",
-    /*71*/ "StatsOption",
-    /*72*/ "HelpOption",
-    /*73*/ "HelpParamList",
-    /*74*/ "HelpParamListEmpty",
-    /*75*/ "HelpMessageParam",
-    /*76*/ "HelpOptionParam",
-    /*77*/ "QuietModeOption",
-    /*78*/ "VersionOption",
-    /*79*/ "CmdLineGrammarOption",
-    /*80*/ "CmdLineGrammarFileNameParam1",
-    /*81*/ "CmdLineGrammarFileNameParam2",
-    /*82*/ "CmdLineGrammarFileNameParamEmpty",
-    /*83*/ "FileName1",
-    /*84*/ "FileName2",
-    /*85*/ "FileName3",
-    /*86*/ "ClassName1",
-    /*87*/ "ClassName2"
+    /*54*/ "StaticDFAStrideParam",
+    /*55*/ "StaticParseTableOption",
+    /*56*/ "StaticParseTableParamList",
+    /*57*/ "StaticParseTableParamListEmpty",
+    /*58*/ "StaticParseTableFileNameParam",
+    /*59*/ "StaticParseTableClassNameParam",
+    /*60*/ "StaticParseTableCompressParam",
+    /*61*/ "StaticParseTableDefaultReduceParam",
+    /*62*/ "ScannerOption",
+    /*63*/ "ScannerParamList",
+    /*64*/ "ScannerParamListEmpty",
+    /*65*/ "ScannerFileNameParam",
+    /*66*/ "ScannerClassNameParam",
+    /*67*/ "ScanOption",
+    /*68*/ "ScanFileNameParam",
+    /*69*/ "ScanFileNameParamEmpty",
+    /*70*/ "CanonicalOption",
+    /*71*/ "CanonicalFileNameParam",
+    /*72*/ "CanonicalFileNameParamEmpty",
+    /*73*/ "ConflictReportOption",
+    /*74*/ "ConflictReportParamList",
+    /*75*/ "ConflictReportParamListEmpty",
+    /*76*/ "ConflictReportFileNameParam",
+    /*77*/ "ConflictReportLinesParam",
+    /*78*/ "ConflictReportLabelsParam",
+    /*79*/ "ConflictReportPointsParam",
+    /*80*/ "WarningOption",
+    /*81*/ "NotesOption",
+    /*82*/ "StatsOption",
+    /*83*/ "HelpOption",
+    /*84*/ "HelpParamList",
+    /*85*/ "HelpParamListEmpty",
+    /*86*/ "HelpMessageParam",
+    /*87*/ "HelpOptionParam",
+    /*88*/ "QuietModeOption",
+    /*89*/ "VersionOption",
+    /*90*/ "CmdLineGrammarOption",
+    /*91*/ "CmdLineGrammarFileNameParam1",
+    /*92*/ "CmdLineGrammarFileNameParam2",
+    /*93*/ "CmdLineGrammarFileNameParamEmpty",
+    /*94*/ "FileName1",
+    /*95*/ "FileName2",
+    /*96*/ "FileName3",
+    /*97*/ "ClassName1",
+    /*98*/ "ClassName2"
 };
 
 } // namespace XC
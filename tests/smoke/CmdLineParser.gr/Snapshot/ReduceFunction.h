@@ -217,6 +217,10 @@ bool ParseHandler::Reduce(Parse<StackElement> &parse, unsigned productionID)
         case PE_StaticDFAClassNameParam:
             break;
 
+        // StaticDFAParam -> '+stride' 
+        case PE_StaticDFAStrideParam:
+            break;
+
         // Option -> '-parsetable' StaticParseTableParamList 
         case PE_StaticParseTableOption:
             break;
@@ -237,6 +241,46 @@ bool ParseHandler::Reduce(Parse<StackElement> &parse, unsigned productionID)
         case PE_StaticParseTableClassNameParam:
             break;
 
+        // StaticParseTableParam -> '+compress' 
+        case PE_StaticParseTableCompressParam:
+            break;
+
+        // StaticParseTableParam -> '+defaultreduce' 
+        case PE_StaticParseTableDefaultReduceParam:
+            break;
+
+        // Option -> '-scanner' ScannerParamList 
+        case PE_ScannerOption:
+            break;
+
+        // ScannerParamList -> ScannerParam ScannerParamList 
+        case PE_ScannerParamList:
+            break;
+
+        // ScannerParamList -> <empty>
+        case PE_ScannerParamListEmpty:
+            break;
+
+        // ScannerParam -> '+filename' ':' FileName 
+        case PE_ScannerFileNameParam:
+            break;
+
+        // ScannerParam -> '+classname' ':' ClassName 
+        case PE_ScannerClassNameParam:
+            break;
+
+        // Option -> '-scan' ScanParam 
+        case PE_ScanOption:
+            break;
+
+        // ScanParam -> '+filename' ':' FileName 
+        case PE_ScanFileNameParam:
+            break;
+
+        // ScanParam -> <empty>
+        case PE_ScanFileNameParamEmpty:
+            break;
+
         // Option -> '-canonical' CanonicalParam 
         case PE_CanonicalOption:
             break;
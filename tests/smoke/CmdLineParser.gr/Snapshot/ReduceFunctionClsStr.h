@@ -220,6 +220,10 @@ bool ParseHandler::Reduce(Parse<StackElement> &parse, unsigned productionID)
         case ProductionEnum::StaticDFAClassNameParam:
             break;
 
+        // StaticDFAParam -> '+stride' 
+        case ProductionEnum::StaticDFAStrideParam:
+            break;
+
         // Option -> '-parsetable' StaticParseTableParamList 
         case ProductionEnum::StaticParseTableOption:
             break;
@@ -240,6 +244,46 @@ bool ParseHandler::Reduce(Parse<StackElement> &parse, unsigned productionID)
         case ProductionEnum::StaticParseTableClassNameParam:
             break;
 
+        // StaticParseTableParam -> '+compress' 
+        case ProductionEnum::StaticParseTableCompressParam:
+            break;
+
+        // StaticParseTableParam -> '+defaultreduce' 
+        case ProductionEnum::StaticParseTableDefaultReduceParam:
+            break;
+
+        // Option -> '-scanner' ScannerParamList 
+        case ProductionEnum::ScannerOption:
+            break;
+
+        // ScannerParamList -> ScannerParam ScannerParamList 
+        case ProductionEnum::ScannerParamList:
+            break;
+
+        // ScannerParamList -> <empty>
+        case ProductionEnum::ScannerParamListEmpty:
+            break;
+
+        // ScannerParam -> '+filename' ':' FileName 
+        case ProductionEnum::ScannerFileNameParam:
+            break;
+
+        // ScannerParam -> '+classname' ':' ClassName 
+        case ProductionEnum::ScannerClassNameParam:
+            break;
+
+        // Option -> '-scan' ScanParam 
+        case ProductionEnum::ScanOption:
+            break;
+
+        // ScanParam -> '+filename' ':' FileName 
+        case ProductionEnum::ScanFileNameParam:
+            break;
+
+        // ScanParam -> <empty>
+        case ProductionEnum::ScanFileNameParamEmpty:
+            break;
+
         // Option -> '-canonical' CanonicalParam 
         case ProductionEnum::CanonicalOption:
             break;
@@ -0,0 +1,6999 @@
+// This is a generated file.
+// Copyright is in `CmdLineParser.gr` - see that file for details.
+
+#include "Tokenizer.h"
+
+#include <vector>
+
+// Direct-coded tokenizer generated from the DFA
+template <class Token>
+class Scanner : public SGParser::TokenizerImpl<Token>
+{
+public:
+    // Default constructor
+    Scanner() = default;
+
+    // Initialization constructor
+    explicit Scanner(SGParser::InputStream* pinputStream) { Create(pinputStream); }
+
+    // Initializes the tokenizer to use a specified input stream
+    bool Create(SGParser::InputStream* pinputStream) {
+        if (!SetInputStream(pinputStream))
+            return false;
+        ExpressionStackTop = 0u;
+        ExpressionStack.clear();
+        return true;
+    }
+
+    // *** Token Stream interface
+
+    // Return next token / EOF Token
+    Token& GetNextToken(Token& token) override;
+
+    // Fill in up to count tokens, stopping after EOF
+    size_t GetTokens(Token* ptokens, size_t count) override {
+        size_t index = 0u;
+        while (index < count)
+            if (Scanner::GetNextToken(ptokens[index++]).Code ==
+                SGParser::TokenCode::TokenEOF)
+                break;
+        return index;
+    }
+
+private:
+    using CodeType = typename Token::CodeType;
+
+    using typename SGParser::TokenizerBase::ByteReader;
+    using typename SGParser::TokenizerImpl<Token>::InputCharReader;
+    using typename SGParser::TokenizerImpl<Token>::BufferPos;
+    using typename SGParser::TokenizerImpl<Token>::PosTracker;
+    using SGParser::TokenizerImpl<Token>::SetInputStream;
+    using SGParser::TokenizerImpl<Token>::HeadPos;
+    using SGParser::TokenizerImpl<Token>::TailPos;
+    using SGParser::TokenizerImpl<Token>::GetHeadPos;
+    using SGParser::TokenizerImpl<Token>::GetTailPos;
+    using SGParser::TokenizerImpl<Token>::SetTailPos;
+    using SGParser::TokenizerImpl<Token>::AdjustHead;
+
+    unsigned              ExpressionStackTop = 0u;
+
+    // Expression stack, controls starting state
+    std::vector<unsigned> ExpressionStack;
+};
+
+template <class Token>
+Token& Scanner<Token>::GetNextToken(Token& token) {
+    CodeType        code;
+    InputCharReader charReader{ByteReader{*this}, TailPos};
+
+    do {
+        HeadPos = TailPos;
+        AdjustHead();
+
+        if (charReader.IsEOF()) {
+            token.CopyFromTokenizer(SGParser::TokenCode::TokenEOF, *this);
+            return token;
+        }
+
+        // Lexeme 0 means nothing has been recognized yet
+        unsigned   lastLexemeID = 0u;
+        BufferPos  lastTail;
+        BufferPos  startHead{GetHeadPos()};
+        PosTracker lastTailPos{TailPos};
+        bool       advanced;
+
+        switch (ExpressionStackTop) {
+            case 0u: goto Dispatch0;
+            case 1u: goto Dispatch288;
+            default: goto Done;
+        }
+
+    Dispatch0:
+        switch (charReader.GetChar()) {
+            case 0x09: case 0x0A: case 0x0D: case 0x20:
+                goto State1;
+            case 0x22:
+                goto State2;
+            case 0x2B:
+                goto State3;
+            case 0x2D:
+                goto State4;
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State7;
+            case 0x3A:
+                goto State8;
+            case 0x40:
+                goto State9;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+            case 0x78: case 0x79: case 0x7A:
+                goto State10;
+            case 0x4C:
+                goto State11;
+            case 0x5F:
+                goto State12;
+            default:
+                goto Done;
+        }
+
+    State1:
+        charReader.Advance();
+        lastLexemeID = 2u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State2:
+        charReader.Advance();
+        lastLexemeID = 3u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State3:
+        advanced = charReader.Advance();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x45: case 0x47: case 0x48: case 0x49: case 0x4A: case 0x4B:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x65: case 0x67: case 0x68: case 0x69: case 0x6A:
+            case 0x6B: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x43: case 0x63:
+                goto State14;
+            case 0x44: case 0x64:
+                goto State15;
+            case 0x46: case 0x66:
+                goto State16;
+            case 0x4C: case 0x6C:
+                goto State17;
+            case 0x4D: case 0x6D:
+                goto State18;
+            case 0x4E: case 0x6E:
+                goto State19;
+            case 0x4F: case 0x6F:
+                goto State20;
+            case 0x50: case 0x70:
+                goto State21;
+            case 0x53: case 0x73:
+                goto State22;
+            default:
+                goto Done;
+        }
+
+    State4:
+        advanced = charReader.Advance();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x3F:
+                goto State23;
+            case 0x41: case 0x42: case 0x46: case 0x47: case 0x49: case 0x4A: case 0x4B: case 0x4D:
+            case 0x4F: case 0x55: case 0x57: case 0x58: case 0x59: case 0x5A: case 0x61: case 0x62:
+            case 0x66: case 0x67: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6F: case 0x75:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x43: case 0x63:
+                goto State25;
+            case 0x44: case 0x64:
+                goto State26;
+            case 0x45: case 0x65:
+                goto State27;
+            case 0x48: case 0x68:
+                goto State28;
+            case 0x4C: case 0x6C:
+                goto State29;
+            case 0x4E: case 0x6E:
+                goto State30;
+            case 0x50: case 0x70:
+                goto State31;
+            case 0x51: case 0x71:
+                goto State32;
+            case 0x52: case 0x72:
+                goto State33;
+            case 0x53: case 0x73:
+                goto State34;
+            case 0x54: case 0x74:
+                goto State35;
+            case 0x56: case 0x76:
+                goto State36;
+            default:
+                goto Done;
+        }
+
+    State5:
+        advanced = charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2F:
+                goto State6;
+            case 0x2E:
+                goto State37;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State38;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State39;
+            case 0x5F:
+                goto State40;
+            default:
+                goto Done;
+        }
+
+    State6:
+        advanced = charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State38;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State39;
+            case 0x5F:
+                goto State40;
+            default:
+                goto Done;
+        }
+
+    State7:
+        advanced = charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State7;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State39;
+            case 0x5F:
+                goto State40;
+            default:
+                goto Done;
+        }
+
+    State8:
+        charReader.Advance();
+        lastLexemeID = 10u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State9:
+        charReader.Advance();
+        lastLexemeID = 11u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State10:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State43;
+            case 0x5F:
+                goto State44;
+            default:
+                goto Done;
+        }
+
+    State11:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x22:
+                goto State2;
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State43;
+            case 0x5F:
+                goto State44;
+            default:
+                goto Done;
+        }
+
+    State12:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State45;
+            default:
+                goto Done;
+        }
+
+    State13:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State14:
+        advanced = charReader.Advance();
+        lastLexemeID = 39u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x70: case 0x71: case 0x72:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            case 0x4C: case 0x6C:
+                goto State46;
+            case 0x4F: case 0x6F:
+                goto State47;
+            default:
+                goto Done;
+        }
+
+    State15:
+        advanced = charReader.Advance();
+        lastLexemeID = 52u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x47: case 0x48: case 0x4A: case 0x4B:
+            case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51: case 0x52: case 0x53:
+            case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A: case 0x61:
+            case 0x62: case 0x63: case 0x64: case 0x67: case 0x68: case 0x6A: case 0x6B: case 0x6C:
+            case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74:
+            case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State48;
+            case 0x46: case 0x66:
+                goto State49;
+            case 0x49: case 0x69:
+                goto State50;
+            default:
+                goto Done;
+        }
+
+    State16:
+        advanced = charReader.Advance();
+        lastLexemeID = 37u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x49: case 0x69:
+                goto State51;
+            default:
+                goto Done;
+        }
+
+    State17:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x4A:
+            case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x6A:
+            case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State52;
+            case 0x49: case 0x69:
+                goto State53;
+            default:
+                goto Done;
+        }
+
+    State18:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State54;
+            default:
+                goto Done;
+        }
+
+    State19:
+        advanced = charReader.Advance();
+        lastLexemeID = 38u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State55;
+            default:
+                goto Done;
+        }
+
+    State20:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x50: case 0x70:
+                goto State56;
+            default:
+                goto Done;
+        }
+
+    State21:
+        advanced = charReader.Advance();
+        lastLexemeID = 41u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x50: case 0x51:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x70: case 0x71:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            case 0x4F: case 0x6F:
+                goto State57;
+            case 0x52: case 0x72:
+                goto State58;
+            default:
+                goto Done;
+        }
+
+    State22:
+        advanced = charReader.Advance();
+        lastLexemeID = 40u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x54: case 0x74:
+                goto State59;
+            default:
+                goto Done;
+        }
+
+    State23:
+        charReader.Advance();
+        lastLexemeID = 33u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State24:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State25:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49: case 0x4A:
+            case 0x4B: case 0x4D: case 0x4E: case 0x50: case 0x51: case 0x53: case 0x54: case 0x55:
+            case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A: case 0x62: case 0x63: case 0x65:
+            case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State60;
+            case 0x44: case 0x64:
+                goto State61;
+            case 0x4C: case 0x6C:
+                goto State62;
+            case 0x4F: case 0x6F:
+                goto State63;
+            case 0x52: case 0x72:
+                goto State64;
+            default:
+                goto Done;
+        }
+
+    State26:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x46: case 0x66:
+                goto State65;
+            default:
+                goto Done;
+        }
+
+    State27:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State66;
+            default:
+                goto Done;
+        }
+
+    State28:
+        advanced = charReader.Advance();
+        lastLexemeID = 33u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State67;
+            default:
+                goto Done;
+        }
+
+    State29:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69:
+            case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State68;
+            case 0x52: case 0x72:
+                goto State69;
+            default:
+                goto Done;
+        }
+
+    State30:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69:
+            case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x70: case 0x71: case 0x72:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State70;
+            case 0x4F: case 0x6F:
+                goto State71;
+            default:
+                goto Done;
+        }
+
+    State31:
+        advanced = charReader.Advance();
+        lastLexemeID = 15u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A: case 0x62:
+            case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A:
+            case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x73:
+            case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State72;
+            case 0x52: case 0x72:
+                goto State73;
+            case 0x54: case 0x74:
+                goto State74;
+            default:
+                goto Done;
+        }
+
+    State32:
+        advanced = charReader.Advance();
+        lastLexemeID = 34u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x55: case 0x75:
+                goto State75;
+            default:
+                goto Done;
+        }
+
+    State33:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x47: case 0x48: case 0x49: case 0x4A:
+            case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x61: case 0x62: case 0x63: case 0x64: case 0x67: case 0x68: case 0x69: case 0x6A:
+            case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State76;
+            case 0x46: case 0x66:
+                goto State77;
+            default:
+                goto Done;
+        }
+
+    State34:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x61: case 0x62: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69:
+            case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71:
+            case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x43: case 0x63:
+                goto State78;
+            case 0x54: case 0x74:
+                goto State79;
+            default:
+                goto Done;
+        }
+
+    State35:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State80;
+            default:
+                goto Done;
+        }
+
+    State36:
+        advanced = charReader.Advance();
+        lastLexemeID = 35u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State81;
+            default:
+                goto Done;
+        }
+
+    State37:
+        advanced = charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State37;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State38;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State39;
+            case 0x5F:
+                goto State40;
+            case 0x2F:
+                goto State82;
+            default:
+                goto Done;
+        }
+
+    State38:
+        advanced = charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State38;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State39;
+            case 0x5F:
+                goto State40;
+            default:
+                goto Done;
+        }
+
+    State39:
+        advanced = charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State38;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State39;
+            case 0x5F:
+                goto State40;
+            default:
+                goto Done;
+        }
+
+    State40:
+        advanced = charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State38;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State39;
+            case 0x5F:
+                goto State40;
+            default:
+                goto Done;
+        }
+
+    State41:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State83;
+            case 0x5F:
+                goto State84;
+            default:
+                goto Done;
+        }
+
+    State42:
+        advanced = charReader.Advance();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x3A:
+                goto State85;
+            default:
+                goto Done;
+        }
+
+    State43:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State86;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State87;
+            default:
+                goto Done;
+        }
+
+    State44:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State45;
+            default:
+                goto Done;
+        }
+
+    State45:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State45;
+            default:
+                goto Done;
+        }
+
+    State46:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State88;
+            default:
+                goto Done;
+        }
+
+    State47:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4D: case 0x6D:
+                goto State89;
+            default:
+                goto Done;
+        }
+
+    State48:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x46: case 0x66:
+                goto State90;
+            default:
+                goto Done;
+        }
+
+    State49:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State91;
+            default:
+                goto Done;
+        }
+
+    State50:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State92;
+            default:
+                goto Done;
+        }
+
+    State51:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4C: case 0x6C:
+                goto State93;
+            default:
+                goto Done;
+        }
+
+    State52:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x42: case 0x62:
+                goto State94;
+            default:
+                goto Done;
+        }
+
+    State53:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4E: case 0x6E:
+                goto State95;
+            default:
+                goto Done;
+        }
+
+    State54:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x47: case 0x67:
+                goto State96;
+            default:
+                goto Done;
+        }
+
+    State55:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4E: case 0x6E:
+                goto State97;
+            default:
+                goto Done;
+        }
+
+    State56:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x54: case 0x74:
+                goto State98;
+            default:
+                goto Done;
+        }
+
+    State57:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x49: case 0x69:
+                goto State99;
+            default:
+                goto Done;
+        }
+
+    State58:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State100;
+            default:
+                goto Done;
+        }
+
+    State59:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69:
+            case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State101;
+            case 0x52: case 0x72:
+                goto State102;
+            default:
+                goto Done;
+        }
+
+    State60:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State103;
+            default:
+                goto Done;
+        }
+
+    State61:
+        advanced = charReader.Advance();
+        lastLexemeID = 28u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State62:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x68: case 0x69:
+            case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x47: case 0x67:
+                goto State104;
+            case 0x52: case 0x72:
+                goto State105;
+            default:
+                goto Done;
+        }
+
+    State63:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State106;
+            default:
+                goto Done;
+        }
+
+    State64:
+        advanced = charReader.Advance();
+        lastLexemeID = 29u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State65:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State107;
+            default:
+                goto Done;
+        }
+
+    State66:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x55: case 0x75:
+                goto State108;
+            default:
+                goto Done;
+        }
+
+    State67:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4C: case 0x6C:
+                goto State109;
+            default:
+                goto Done;
+        }
+
+    State68:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4C: case 0x6C:
+                goto State110;
+            default:
+                goto Done;
+        }
+
+    State69:
+        advanced = charReader.Advance();
+        lastLexemeID = 12u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State70:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4D: case 0x6D:
+                goto State111;
+            default:
+                goto Done;
+        }
+
+    State71:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x55: case 0x56: case 0x58: case 0x59: case 0x5A: case 0x61:
+            case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69:
+            case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70: case 0x71: case 0x72:
+            case 0x73: case 0x75: case 0x76: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State112;
+            case 0x54: case 0x74:
+                goto State113;
+            case 0x57: case 0x77:
+                goto State114;
+            default:
+                goto Done;
+        }
+
+    State72:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x52: case 0x72:
+                goto State115;
+            default:
+                goto Done;
+        }
+
+    State73:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4F: case 0x6F:
+                goto State116;
+            default:
+                goto Done;
+        }
+
+    State74:
+        advanced = charReader.Advance();
+        lastLexemeID = 25u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State75:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x49: case 0x69:
+                goto State117;
+            default:
+                goto Done;
+        }
+
+    State76:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x44: case 0x64:
+                goto State118;
+            default:
+                goto Done;
+        }
+
+    State77:
+        advanced = charReader.Advance();
+        lastLexemeID = 23u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State78:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State119;
+            default:
+                goto Done;
+        }
+
+    State79:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State120;
+            default:
+                goto Done;
+        }
+
+    State80:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x52: case 0x72:
+                goto State121;
+            default:
+                goto Done;
+        }
+
+    State81:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x52: case 0x72:
+                goto State122;
+            default:
+                goto Done;
+        }
+
+    State82:
+        advanced = charReader.Advance();
+        lastLexemeID = 7u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State38;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State39;
+            case 0x5F:
+                goto State40;
+            default:
+                goto Done;
+        }
+
+    State83:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State83;
+            case 0x5F:
+                goto State84;
+            default:
+                goto Done;
+        }
+
+    State84:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State83;
+            case 0x5F:
+                goto State84;
+            default:
+                goto Done;
+        }
+
+    State85:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x3A:
+                goto State42;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State123;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State124;
+            case 0x5F:
+                goto State125;
+            default:
+                goto Done;
+        }
+
+    State86:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State84;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State126;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State127;
+            default:
+                goto Done;
+        }
+
+    State87:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State126;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State128;
+            default:
+                goto Done;
+        }
+
+    State88:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State129;
+            default:
+                goto Done;
+        }
+
+    State89:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x50: case 0x70:
+                goto State130;
+            default:
+                goto Done;
+        }
+
+    State90:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State131;
+            default:
+                goto Done;
+        }
+
+    State91:
+        advanced = charReader.Advance();
+        lastLexemeID = 48u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State92:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x50: case 0x70:
+                goto State132;
+            default:
+                goto Done;
+        }
+
+    State93:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State133;
+            default:
+                goto Done;
+        }
+
+    State94:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State134;
+            default:
+                goto Done;
+        }
+
+    State95:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State135;
+            default:
+                goto Done;
+        }
+
+    State96:
+        advanced = charReader.Advance();
+        lastLexemeID = 47u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State97:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State136;
+            default:
+                goto Done;
+        }
+
+    State98:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x49: case 0x69:
+                goto State137;
+            default:
+                goto Done;
+        }
+
+    State99:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4E: case 0x6E:
+                goto State138;
+            default:
+                goto Done;
+        }
+
+    State100:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x46: case 0x66:
+                goto State139;
+            default:
+                goto Done;
+        }
+
+    State101:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x43: case 0x63:
+                goto State140;
+            default:
+                goto Done;
+        }
+
+    State102:
+        advanced = charReader.Advance();
+        lastLexemeID = 45u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x49: case 0x69:
+                goto State141;
+            default:
+                goto Done;
+        }
+
+    State103:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4F: case 0x6F:
+                goto State142;
+            default:
+                goto Done;
+        }
+
+    State104:
+        advanced = charReader.Advance();
+        lastLexemeID = 36u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State105:
+        advanced = charReader.Advance();
+        lastLexemeID = 14u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State106:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x46: case 0x66:
+                goto State143;
+            default:
+                goto Done;
+        }
+
+    State107:
+        advanced = charReader.Advance();
+        lastLexemeID = 24u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State108:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4D: case 0x6D:
+                goto State144;
+            default:
+                goto Done;
+        }
+
+    State109:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x50: case 0x70:
+                goto State145;
+            default:
+                goto Done;
+        }
+
+    State110:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x52: case 0x72:
+                goto State146;
+            default:
+                goto Done;
+        }
+
+    State111:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State147;
+            default:
+                goto Done;
+        }
+
+    State112:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x54: case 0x74:
+                goto State148;
+            default:
+                goto Done;
+        }
+
+    State113:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State149;
+            default:
+                goto Done;
+        }
+
+    State114:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State150;
+            default:
+                goto Done;
+        }
+
+    State115:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State151;
+            default:
+                goto Done;
+        }
+
+    State116:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x44: case 0x64:
+                goto State152;
+            default:
+                goto Done;
+        }
+
+    State117:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State153;
+            default:
+                goto Done;
+        }
+
+    State118:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x55: case 0x75:
+                goto State154;
+            default:
+                goto Done;
+        }
+
+    State119:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State155;
+            default:
+                goto Done;
+        }
+
+    State120:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x54: case 0x74:
+                goto State156;
+            default:
+                goto Done;
+        }
+
+    State121:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4D: case 0x6D:
+                goto State157;
+            default:
+                goto Done;
+        }
+
+    State122:
+        advanced = charReader.Advance();
+        lastLexemeID = 35u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State158;
+            default:
+                goto Done;
+        }
+
+    State123:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x3A:
+                goto State42;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State123;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State124;
+            case 0x5F:
+                goto State125;
+            default:
+                goto Done;
+        }
+
+    State124:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x3A:
+                goto State42;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State123;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State124;
+            case 0x5F:
+                goto State125;
+            default:
+                goto Done;
+        }
+
+    State125:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x3A:
+                goto State42;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State123;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State124;
+            case 0x5F:
+                goto State125;
+            default:
+                goto Done;
+        }
+
+    State126:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State84;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State159;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State160;
+            default:
+                goto Done;
+        }
+
+    State127:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State84;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State159;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State160;
+            default:
+                goto Done;
+        }
+
+    State128:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State159;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State161;
+            default:
+                goto Done;
+        }
+
+    State129:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State162;
+            default:
+                goto Done;
+        }
+
+    State130:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x52: case 0x72:
+                goto State163;
+            default:
+                goto Done;
+        }
+
+    State131:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x55: case 0x75:
+                goto State164;
+            default:
+                goto Done;
+        }
+
+    State132:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4C: case 0x6C:
+                goto State165;
+            default:
+                goto Done;
+        }
+
+    State133:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4E: case 0x6E:
+                goto State166;
+            default:
+                goto Done;
+        }
+
+    State134:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4C: case 0x6C:
+                goto State167;
+            default:
+                goto Done;
+        }
+
+    State135:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State168;
+            default:
+                goto Done;
+        }
+
+    State136:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4D: case 0x6D:
+                goto State169;
+            default:
+                goto Done;
+        }
+
+    State137:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4F: case 0x6F:
+                goto State170;
+            default:
+                goto Done;
+        }
+
+    State138:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x54: case 0x74:
+                goto State171;
+            default:
+                goto Done;
+        }
+
+    State139:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x49: case 0x69:
+                goto State172;
+            default:
+                goto Done;
+        }
+
+    State140:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4B: case 0x6B:
+                goto State173;
+            default:
+                goto Done;
+        }
+
+    State141:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x61: case 0x62: case 0x63: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69:
+            case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70: case 0x71: case 0x72:
+            case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            case 0x44: case 0x64:
+                goto State174;
+            case 0x4E: case 0x6E:
+                goto State175;
+            default:
+                goto Done;
+        }
+
+    State142:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State176;
+            default:
+                goto Done;
+        }
+
+    State143:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4C: case 0x6C:
+                goto State177;
+            default:
+                goto Done;
+        }
+
+    State144:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x47: case 0x48: case 0x49: case 0x4A:
+            case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51: case 0x52:
+            case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A: case 0x61:
+            case 0x62: case 0x64: case 0x65: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B:
+            case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x74:
+            case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            case 0x43: case 0x63:
+                goto State178;
+            case 0x46: case 0x66:
+                goto State179;
+            case 0x53: case 0x73:
+                goto State180;
+            default:
+                goto Done;
+        }
+
+    State145:
+        advanced = charReader.Advance();
+        lastLexemeID = 33u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State146:
+        advanced = charReader.Advance();
+        lastLexemeID = 13u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State147:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State181;
+            default:
+                goto Done;
+        }
+
+    State148:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State182;
+            default:
+                goto Done;
+        }
+
+    State149:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State183;
+            default:
+                goto Done;
+        }
+
+    State150:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x52: case 0x72:
+                goto State184;
+            default:
+                goto Done;
+        }
+
+    State151:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State185;
+            default:
+                goto Done;
+        }
+
+    State152:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State186;
+            default:
+                goto Done;
+        }
+
+    State153:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x54: case 0x74:
+                goto State187;
+            default:
+                goto Done;
+        }
+
+    State154:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x43: case 0x63:
+                goto State188;
+            default:
+                goto Done;
+        }
+
+    State155:
+        advanced = charReader.Advance();
+        lastLexemeID = 27u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State189;
+            default:
+                goto Done;
+        }
+
+    State156:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State190;
+            default:
+                goto Done;
+        }
+
+    State157:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State191;
+            default:
+                goto Done;
+        }
+
+    State158:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x49: case 0x69:
+                goto State192;
+            default:
+                goto Done;
+        }
+
+    State159:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State84;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State193;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State194;
+            default:
+                goto Done;
+        }
+
+    State160:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State84;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State193;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State194;
+            default:
+                goto Done;
+        }
+
+    State161:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State193;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State195;
+            default:
+                goto Done;
+        }
+
+    State162:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4E: case 0x6E:
+                goto State196;
+            default:
+                goto Done;
+        }
+
+    State163:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State197;
+            default:
+                goto Done;
+        }
+
+    State164:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4C: case 0x6C:
+                goto State198;
+            default:
+                goto Done;
+        }
+
+    State165:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State199;
+            default:
+                goto Done;
+        }
+
+    State166:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State200;
+            default:
+                goto Done;
+        }
+
+    State167:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State201;
+            default:
+                goto Done;
+        }
+
+    State168:
+        advanced = charReader.Advance();
+        lastLexemeID = 49u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State169:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State202;
+            default:
+                goto Done;
+        }
+
+    State170:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4E: case 0x6E:
+                goto State203;
+            default:
+                goto Done;
+        }
+
+    State171:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State204;
+            default:
+                goto Done;
+        }
+
+    State172:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x58: case 0x78:
+                goto State205;
+            default:
+                goto Done;
+        }
+
+    State173:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4E: case 0x6E:
+                goto State206;
+            default:
+                goto Done;
+        }
+
+    State174:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State207;
+            default:
+                goto Done;
+        }
+
+    State175:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x47: case 0x67:
+                goto State208;
+            default:
+                goto Done;
+        }
+
+    State176:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x49: case 0x69:
+                goto State209;
+            default:
+                goto Done;
+        }
+
+    State177:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x49: case 0x69:
+                goto State210;
+            default:
+                goto Done;
+        }
+
+    State178:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4C: case 0x6C:
+                goto State211;
+            default:
+                goto Done;
+        }
+
+    State179:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x49: case 0x69:
+                goto State212;
+            default:
+                goto Done;
+        }
+
+    State180:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x54: case 0x74:
+                goto State213;
+            default:
+                goto Done;
+        }
+
+    State181:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x50: case 0x70:
+                goto State214;
+            default:
+                goto Done;
+        }
+
+    State182:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x52: case 0x72:
+                goto State215;
+            default:
+                goto Done;
+        }
+
+    State183:
+        advanced = charReader.Advance();
+        lastLexemeID = 31u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State184:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State216;
+            default:
+                goto Done;
+        }
+
+    State185:
+        advanced = charReader.Advance();
+        lastLexemeID = 15u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x54: case 0x74:
+                goto State217;
+            default:
+                goto Done;
+        }
+
+    State186:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State218;
+            default:
+                goto Done;
+        }
+
+    State187:
+        advanced = charReader.Advance();
+        lastLexemeID = 34u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State188:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State219;
+            default:
+                goto Done;
+        }
+
+    State189:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State220;
+            default:
+                goto Done;
+        }
+
+    State190:
+        advanced = charReader.Advance();
+        lastLexemeID = 32u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State191:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State221;
+            default:
+                goto Done;
+        }
+
+    State192:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4F: case 0x6F:
+                goto State222;
+            default:
+                goto Done;
+        }
+
+    State193:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State84;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State223;
+            default:
+                goto Done;
+        }
+
+    State194:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State84;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State223;
+            default:
+                goto Done;
+        }
+
+    State195:
+        advanced = charReader.Advance();
+        lastLexemeID = 8u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State224;
+            default:
+                goto Done;
+        }
+
+    State196:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State225;
+            default:
+                goto Done;
+        }
+
+    State197:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State226;
+            default:
+                goto Done;
+        }
+
+    State198:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x54: case 0x74:
+                goto State227;
+            default:
+                goto Done;
+        }
+
+    State199:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+            case 0x78: case 0x7A:
+                goto State13;
+            case 0x59: case 0x79:
+                goto State228;
+            default:
+                goto Done;
+        }
+
+    State200:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4D: case 0x6D:
+                goto State229;
+            default:
+                goto Done;
+        }
+
+    State201:
+        advanced = charReader.Advance();
+        lastLexemeID = 50u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State202:
+        advanced = charReader.Advance();
+        lastLexemeID = 38u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State203:
+        advanced = charReader.Advance();
+        lastLexemeID = 46u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State204:
+        advanced = charReader.Advance();
+        lastLexemeID = 51u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State205:
+        advanced = charReader.Advance();
+        lastLexemeID = 41u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State206:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x41: case 0x61:
+                goto State230;
+            default:
+                goto Done;
+        }
+
+    State207:
+        advanced = charReader.Advance();
+        lastLexemeID = 42u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State208:
+        advanced = charReader.Advance();
+        lastLexemeID = 45u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State209:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x43: case 0x63:
+                goto State231;
+            default:
+                goto Done;
+        }
+
+    State210:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x43: case 0x63:
+                goto State232;
+            default:
+                goto Done;
+        }
+
+    State211:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State233;
+            default:
+                goto Done;
+        }
+
+    State212:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4C: case 0x6C:
+                goto State234;
+            default:
+                goto Done;
+        }
+
+    State213:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x52: case 0x72:
+                goto State235;
+            default:
+                goto Done;
+        }
+
+    State214:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State236;
+            default:
+                goto Done;
+        }
+
+    State215:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4D: case 0x6D:
+                goto State237;
+            default:
+                goto Done;
+        }
+
+    State216:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x49: case 0x69:
+                goto State238;
+            default:
+                goto Done;
+        }
+
+    State217:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State239;
+            default:
+                goto Done;
+        }
+
+    State218:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x55: case 0x75:
+                goto State240;
+            default:
+                goto Done;
+        }
+
+    State219:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x46: case 0x66:
+                goto State241;
+            default:
+                goto Done;
+        }
+
+    State220:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x52: case 0x72:
+                goto State242;
+            default:
+                goto Done;
+        }
+
+    State221:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x55: case 0x75:
+                goto State243;
+            default:
+                goto Done;
+        }
+
+    State222:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State244;
+            default:
+                goto Done;
+        }
+
+    State223:
+        advanced = charReader.Advance();
+        lastLexemeID = 9u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State83;
+            case 0x5F:
+                goto State84;
+            default:
+                goto Done;
+        }
+
+    State224:
+        advanced = charReader.Advance();
+        lastLexemeID = 9u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x2E:
+                goto State5;
+            case 0x2F:
+                goto State6;
+            case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+            case 0x38: case 0x39:
+                goto State41;
+            case 0x3A:
+                goto State42;
+            case 0x5F:
+                goto State44;
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State45;
+            default:
+                goto Done;
+        }
+
+    State225:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4D: case 0x6D:
+                goto State245;
+            default:
+                goto Done;
+        }
+
+    State226:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x53: case 0x73:
+                goto State246;
+            default:
+                goto Done;
+        }
+
+    State227:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x52: case 0x72:
+                goto State247;
+            default:
+                goto Done;
+        }
+
+    State228:
+        advanced = charReader.Advance();
+        lastLexemeID = 52u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State229:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State248;
+            default:
+                goto Done;
+        }
+
+    State230:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x4D: case 0x6D:
+                goto State249;
+            default:
+                goto Done;
+        }
+
+    State231:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x41: case 0x61:
+                goto State250;
+            default:
+                goto Done;
+        }
+
+    State232:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x54: case 0x74:
+                goto State251;
+            default:
+                goto Done;
+        }
+
+    State233:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State252;
+            default:
+                goto Done;
+        }
+
+    State234:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State253;
+            default:
+                goto Done;
+        }
+
+    State235:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x49: case 0x69:
+                goto State254;
+            default:
+                goto Done;
+        }
+
+    State236:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x43: case 0x63:
+                goto State255;
+            default:
+                goto Done;
+        }
+
+    State237:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State256;
+            default:
+                goto Done;
+        }
+
+    State238:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State257;
+            default:
+                goto Done;
+        }
+
+    State239:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x42: case 0x62:
+                goto State258;
+            default:
+                goto Done;
+        }
+
+    State240:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4D: case 0x6D:
+                goto State259;
+            default:
+                goto Done;
+        }
+
+    State241:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x55: case 0x75:
+                goto State260;
+            default:
+                goto Done;
+        }
+
+    State242:
+        advanced = charReader.Advance();
+        lastLexemeID = 26u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State243:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4D: case 0x6D:
+                goto State261;
+            default:
+                goto Done;
+        }
+
+    State244:
+        advanced = charReader.Advance();
+        lastLexemeID = 35u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State245:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State262;
+            default:
+                goto Done;
+        }
+
+    State246:
+        advanced = charReader.Advance();
+        lastLexemeID = 43u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State247:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State263;
+            default:
+                goto Done;
+        }
+
+    State248:
+        advanced = charReader.Advance();
+        lastLexemeID = 37u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State249:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State264;
+            default:
+                goto Done;
+        }
+
+    State250:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4C: case 0x6C:
+                goto State265;
+            default:
+                goto Done;
+        }
+
+    State251:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State266;
+            default:
+                goto Done;
+        }
+
+    State252:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State267;
+            default:
+                goto Done;
+        }
+
+    State253:
+        advanced = charReader.Advance();
+        lastLexemeID = 17u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State254:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State268;
+            default:
+                goto Done;
+        }
+
+    State255:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State269;
+            default:
+                goto Done;
+        }
+
+    State256:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State270;
+            default:
+                goto Done;
+        }
+
+    State257:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x47: case 0x67:
+                goto State271;
+            default:
+                goto Done;
+        }
+
+    State258:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4C: case 0x6C:
+                goto State272;
+            default:
+                goto Done;
+        }
+
+    State259:
+        advanced = charReader.Advance();
+        lastLexemeID = 22u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State260:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4E: case 0x6E:
+                goto State273;
+            default:
+                goto Done;
+        }
+
+    State261:
+        advanced = charReader.Advance();
+        lastLexemeID = 20u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State262:
+        advanced = charReader.Advance();
+        lastLexemeID = 39u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State263:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x44: case 0x64:
+                goto State274;
+            default:
+                goto Done;
+        }
+
+    State264:
+        advanced = charReader.Advance();
+        lastLexemeID = 40u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    State265:
+        advanced = charReader.Advance();
+        lastLexemeID = 28u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State266:
+        advanced = charReader.Advance();
+        lastLexemeID = 29u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State267:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State275;
+            default:
+                goto Done;
+        }
+
+    State268:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x47: case 0x67:
+                goto State276;
+            default:
+                goto Done;
+        }
+
+    State269:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State277;
+            default:
+                goto Done;
+        }
+
+    State270:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x55: case 0x75:
+                goto State278;
+            default:
+                goto Done;
+        }
+
+    State271:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State279;
+            default:
+                goto Done;
+        }
+
+    State272:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x45: case 0x65:
+                goto State280;
+            default:
+                goto Done;
+        }
+
+    State273:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x43: case 0x63:
+                goto State281;
+            default:
+                goto Done;
+        }
+
+    State274:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x55: case 0x75:
+                goto State282;
+            default:
+                goto Done;
+        }
+
+    State275:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State283;
+            default:
+                goto Done;
+        }
+
+    State276:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+            case 0x70: case 0x71: case 0x72: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x53: case 0x73:
+                goto State284;
+            default:
+                goto Done;
+        }
+
+    State277:
+        advanced = charReader.Advance();
+        lastLexemeID = 16u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State278:
+        advanced = charReader.Advance();
+        lastLexemeID = 4u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+            case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State24;
+            case 0x4D: case 0x6D:
+                goto State285;
+            default:
+                goto Done;
+        }
+
+    State279:
+        advanced = charReader.Advance();
+        lastLexemeID = 30u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State280:
+        advanced = charReader.Advance();
+        lastLexemeID = 25u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State281:
+        advanced = charReader.Advance();
+        lastLexemeID = 23u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State282:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x64: case 0x65: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x43: case 0x63:
+                goto State286;
+            default:
+                goto Done;
+        }
+
+    State283:
+        advanced = charReader.Advance();
+        lastLexemeID = 18u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State284:
+        advanced = charReader.Advance();
+        lastLexemeID = 19u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State285:
+        advanced = charReader.Advance();
+        lastLexemeID = 21u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State24;
+            default:
+                goto Done;
+        }
+
+    State286:
+        advanced = charReader.Advance();
+        lastLexemeID = 5u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x46: case 0x47: case 0x48: case 0x49:
+            case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51:
+            case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59:
+            case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x66: case 0x67: case 0x68:
+            case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70:
+            case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77: case 0x78:
+            case 0x79: case 0x7A:
+                goto State13;
+            case 0x45: case 0x65:
+                goto State287;
+            default:
+                goto Done;
+        }
+
+    State287:
+        advanced = charReader.Advance();
+        lastLexemeID = 44u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (charReader.GetChar()) {
+            case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48:
+            case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50:
+            case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58:
+            case 0x59: case 0x5A: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66:
+            case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E:
+            case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76:
+            case 0x77: case 0x78: case 0x79: case 0x7A:
+                goto State13;
+            default:
+                goto Done;
+        }
+
+    Dispatch288:
+        switch (const unsigned ch = charReader.GetChar(); ch) {
+            case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07: case 0x08:
+            case 0x09: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F: case 0x10: case 0x11:
+            case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17: case 0x18: case 0x19:
+            case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F: case 0x20: case 0x21:
+            case 0x23: case 0x24: case 0x25: case 0x26: case 0x27: case 0x28: case 0x29: case 0x2A:
+            case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F: case 0x30: case 0x31: case 0x32:
+            case 0x33: case 0x34: case 0x35: case 0x36: case 0x37: case 0x38: case 0x39: case 0x3A:
+            case 0x3B: case 0x3C: case 0x3D: case 0x3E: case 0x3F: case 0x40: case 0x41: case 0x42:
+            case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49: case 0x4A:
+            case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x5B: case 0x5D: case 0x5E: case 0x5F: case 0x60: case 0x61: case 0x62: case 0x63:
+            case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B:
+            case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73:
+            case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A: case 0x7B:
+            case 0x7C: case 0x7D: case 0x7E: case 0x7F: case 0x80: case 0x81: case 0x82: case 0x83:
+            case 0x84: case 0x85: case 0x86: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+            case 0x8C: case 0x8D: case 0x8E: case 0x8F: case 0x90: case 0x91: case 0x92: case 0x93:
+            case 0x94: case 0x95: case 0x96: case 0x97: case 0x98: case 0x99: case 0x9A: case 0x9B:
+            case 0x9C: case 0x9D: case 0x9E: case 0x9F: case 0xA0: case 0xA1: case 0xA2: case 0xA3:
+            case 0xA4: case 0xA5: case 0xA6: case 0xA7: case 0xA8: case 0xA9: case 0xAA: case 0xAB:
+            case 0xAC: case 0xAD: case 0xAE: case 0xAF: case 0xB0: case 0xB1: case 0xB2: case 0xB3:
+            case 0xB4: case 0xB5: case 0xB6: case 0xB7: case 0xB8: case 0xB9: case 0xBA: case 0xBB:
+            case 0xBC: case 0xBD: case 0xBE: case 0xBF: case 0xC0: case 0xC1: case 0xC2: case 0xC3:
+            case 0xC4: case 0xC5: case 0xC6: case 0xC7: case 0xC8: case 0xC9: case 0xCA: case 0xCB:
+            case 0xCC: case 0xCD: case 0xCE: case 0xCF: case 0xD0: case 0xD1: case 0xD2: case 0xD3:
+            case 0xD4: case 0xD5: case 0xD6: case 0xD7: case 0xD8: case 0xD9: case 0xDA: case 0xDB:
+            case 0xDC: case 0xDD: case 0xDE: case 0xDF: case 0xE0: case 0xE1: case 0xE2: case 0xE3:
+            case 0xE4: case 0xE5: case 0xE6: case 0xE7: case 0xE8: case 0xE9: case 0xEA: case 0xEB:
+            case 0xEC: case 0xED: case 0xEE: case 0xEF: case 0xF0: case 0xF1: case 0xF2: case 0xF3:
+            case 0xF4: case 0xF5: case 0xF6: case 0xF7: case 0xF8: case 0xF9: case 0xFA: case 0xFB:
+            case 0xFC: case 0xFD: case 0xFE: case 0xFF:
+                goto State289;
+            case 0x22:
+                goto State290;
+            case 0x5C:
+                goto State291;
+            default:
+                if (ch >= 0x0100 && ch <= 0x10FFFF)
+                    goto State289;
+                goto Done;
+        }
+
+    State289:
+        advanced = charReader.Advance();
+        lastLexemeID = 53u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (const unsigned ch = charReader.GetChar(); ch) {
+            case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07: case 0x08:
+            case 0x09: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F: case 0x10: case 0x11:
+            case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17: case 0x18: case 0x19:
+            case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F: case 0x20: case 0x21:
+            case 0x23: case 0x24: case 0x25: case 0x26: case 0x27: case 0x28: case 0x29: case 0x2A:
+            case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F: case 0x30: case 0x31: case 0x32:
+            case 0x33: case 0x34: case 0x35: case 0x36: case 0x37: case 0x38: case 0x39: case 0x3A:
+            case 0x3B: case 0x3C: case 0x3D: case 0x3E: case 0x3F: case 0x40: case 0x41: case 0x42:
+            case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49: case 0x4A:
+            case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x5B: case 0x5D: case 0x5E: case 0x5F: case 0x60: case 0x61: case 0x62: case 0x63:
+            case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B:
+            case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73:
+            case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A: case 0x7B:
+            case 0x7C: case 0x7D: case 0x7E: case 0x7F: case 0x80: case 0x81: case 0x82: case 0x83:
+            case 0x84: case 0x85: case 0x86: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+            case 0x8C: case 0x8D: case 0x8E: case 0x8F: case 0x90: case 0x91: case 0x92: case 0x93:
+            case 0x94: case 0x95: case 0x96: case 0x97: case 0x98: case 0x99: case 0x9A: case 0x9B:
+            case 0x9C: case 0x9D: case 0x9E: case 0x9F: case 0xA0: case 0xA1: case 0xA2: case 0xA3:
+            case 0xA4: case 0xA5: case 0xA6: case 0xA7: case 0xA8: case 0xA9: case 0xAA: case 0xAB:
+            case 0xAC: case 0xAD: case 0xAE: case 0xAF: case 0xB0: case 0xB1: case 0xB2: case 0xB3:
+            case 0xB4: case 0xB5: case 0xB6: case 0xB7: case 0xB8: case 0xB9: case 0xBA: case 0xBB:
+            case 0xBC: case 0xBD: case 0xBE: case 0xBF: case 0xC0: case 0xC1: case 0xC2: case 0xC3:
+            case 0xC4: case 0xC5: case 0xC6: case 0xC7: case 0xC8: case 0xC9: case 0xCA: case 0xCB:
+            case 0xCC: case 0xCD: case 0xCE: case 0xCF: case 0xD0: case 0xD1: case 0xD2: case 0xD3:
+            case 0xD4: case 0xD5: case 0xD6: case 0xD7: case 0xD8: case 0xD9: case 0xDA: case 0xDB:
+            case 0xDC: case 0xDD: case 0xDE: case 0xDF: case 0xE0: case 0xE1: case 0xE2: case 0xE3:
+            case 0xE4: case 0xE5: case 0xE6: case 0xE7: case 0xE8: case 0xE9: case 0xEA: case 0xEB:
+            case 0xEC: case 0xED: case 0xEE: case 0xEF: case 0xF0: case 0xF1: case 0xF2: case 0xF3:
+            case 0xF4: case 0xF5: case 0xF6: case 0xF7: case 0xF8: case 0xF9: case 0xFA: case 0xFB:
+            case 0xFC: case 0xFD: case 0xFE: case 0xFF:
+                goto State289;
+            case 0x5C:
+                goto State291;
+            default:
+                if (ch >= 0x0100 && ch <= 0x10FFFF)
+                    goto State289;
+                goto Done;
+        }
+
+    State290:
+        charReader.Advance();
+        lastLexemeID = 54u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        goto Done;
+
+    State291:
+        advanced = charReader.Advance();
+        lastLexemeID = 53u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (const unsigned ch = charReader.GetChar(); ch) {
+            case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07: case 0x08:
+            case 0x09: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F: case 0x10: case 0x11:
+            case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17: case 0x18: case 0x19:
+            case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F: case 0x20: case 0x21:
+            case 0x23: case 0x24: case 0x25: case 0x26: case 0x27: case 0x28: case 0x29: case 0x2A:
+            case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F: case 0x30: case 0x31: case 0x32:
+            case 0x33: case 0x34: case 0x35: case 0x36: case 0x37: case 0x38: case 0x39: case 0x3A:
+            case 0x3B: case 0x3C: case 0x3D: case 0x3E: case 0x3F: case 0x40: case 0x41: case 0x42:
+            case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49: case 0x4A:
+            case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x5B: case 0x5D: case 0x5E: case 0x5F: case 0x60: case 0x61: case 0x62: case 0x63:
+            case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B:
+            case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73:
+            case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A: case 0x7B:
+            case 0x7C: case 0x7D: case 0x7E: case 0x7F: case 0x80: case 0x81: case 0x82: case 0x83:
+            case 0x84: case 0x85: case 0x86: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+            case 0x8C: case 0x8D: case 0x8E: case 0x8F: case 0x90: case 0x91: case 0x92: case 0x93:
+            case 0x94: case 0x95: case 0x96: case 0x97: case 0x98: case 0x99: case 0x9A: case 0x9B:
+            case 0x9C: case 0x9D: case 0x9E: case 0x9F: case 0xA0: case 0xA1: case 0xA2: case 0xA3:
+            case 0xA4: case 0xA5: case 0xA6: case 0xA7: case 0xA8: case 0xA9: case 0xAA: case 0xAB:
+            case 0xAC: case 0xAD: case 0xAE: case 0xAF: case 0xB0: case 0xB1: case 0xB2: case 0xB3:
+            case 0xB4: case 0xB5: case 0xB6: case 0xB7: case 0xB8: case 0xB9: case 0xBA: case 0xBB:
+            case 0xBC: case 0xBD: case 0xBE: case 0xBF: case 0xC0: case 0xC1: case 0xC2: case 0xC3:
+            case 0xC4: case 0xC5: case 0xC6: case 0xC7: case 0xC8: case 0xC9: case 0xCA: case 0xCB:
+            case 0xCC: case 0xCD: case 0xCE: case 0xCF: case 0xD0: case 0xD1: case 0xD2: case 0xD3:
+            case 0xD4: case 0xD5: case 0xD6: case 0xD7: case 0xD8: case 0xD9: case 0xDA: case 0xDB:
+            case 0xDC: case 0xDD: case 0xDE: case 0xDF: case 0xE0: case 0xE1: case 0xE2: case 0xE3:
+            case 0xE4: case 0xE5: case 0xE6: case 0xE7: case 0xE8: case 0xE9: case 0xEA: case 0xEB:
+            case 0xEC: case 0xED: case 0xEE: case 0xEF: case 0xF0: case 0xF1: case 0xF2: case 0xF3:
+            case 0xF4: case 0xF5: case 0xF6: case 0xF7: case 0xF8: case 0xF9: case 0xFA: case 0xFB:
+            case 0xFC: case 0xFD: case 0xFE: case 0xFF:
+                goto State289;
+            case 0x5C:
+                goto State291;
+            case 0x22:
+                goto State292;
+            default:
+                if (ch >= 0x0100 && ch <= 0x10FFFF)
+                    goto State289;
+                goto Done;
+        }
+
+    State292:
+        advanced = charReader.Advance();
+        lastLexemeID = 53u;
+        lastTailPos  = TailPos;
+        lastTail     = GetTailPos();
+        if (!advanced)
+            goto Done;
+        switch (const unsigned ch = charReader.GetChar(); ch) {
+            case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07: case 0x08:
+            case 0x09: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F: case 0x10: case 0x11:
+            case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17: case 0x18: case 0x19:
+            case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F: case 0x20: case 0x21:
+            case 0x23: case 0x24: case 0x25: case 0x26: case 0x27: case 0x28: case 0x29: case 0x2A:
+            case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F: case 0x30: case 0x31: case 0x32:
+            case 0x33: case 0x34: case 0x35: case 0x36: case 0x37: case 0x38: case 0x39: case 0x3A:
+            case 0x3B: case 0x3C: case 0x3D: case 0x3E: case 0x3F: case 0x40: case 0x41: case 0x42:
+            case 0x43: case 0x44: case 0x45: case 0x46: case 0x47: case 0x48: case 0x49: case 0x4A:
+            case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F: case 0x50: case 0x51: case 0x52:
+            case 0x53: case 0x54: case 0x55: case 0x56: case 0x57: case 0x58: case 0x59: case 0x5A:
+            case 0x5B: case 0x5D: case 0x5E: case 0x5F: case 0x60: case 0x61: case 0x62: case 0x63:
+            case 0x64: case 0x65: case 0x66: case 0x67: case 0x68: case 0x69: case 0x6A: case 0x6B:
+            case 0x6C: case 0x6D: case 0x6E: case 0x6F: case 0x70: case 0x71: case 0x72: case 0x73:
+            case 0x74: case 0x75: case 0x76: case 0x77: case 0x78: case 0x79: case 0x7A: case 0x7B:
+            case 0x7C: case 0x7D: case 0x7E: case 0x7F: case 0x80: case 0x81: case 0x82: case 0x83:
+            case 0x84: case 0x85: case 0x86: case 0x87: case 0x88: case 0x89: case 0x8A: case 0x8B:
+            case 0x8C: case 0x8D: case 0x8E: case 0x8F: case 0x90: case 0x91: case 0x92: case 0x93:
+            case 0x94: case 0x95: case 0x96: case 0x97: case 0x98: case 0x99: case 0x9A: case 0x9B:
+            case 0x9C: case 0x9D: case 0x9E: case 0x9F: case 0xA0: case 0xA1: case 0xA2: case 0xA3:
+            case 0xA4: case 0xA5: case 0xA6: case 0xA7: case 0xA8: case 0xA9: case 0xAA: case 0xAB:
+            case 0xAC: case 0xAD: case 0xAE: case 0xAF: case 0xB0: case 0xB1: case 0xB2: case 0xB3:
+            case 0xB4: case 0xB5: case 0xB6: case 0xB7: case 0xB8: case 0xB9: case 0xBA: case 0xBB:
+            case 0xBC: case 0xBD: case 0xBE: case 0xBF: case 0xC0: case 0xC1: case 0xC2: case 0xC3:
+            case 0xC4: case 0xC5: case 0xC6: case 0xC7: case 0xC8: case 0xC9: case 0xCA: case 0xCB:
+            case 0xCC: case 0xCD: case 0xCE: case 0xCF: case 0xD0: case 0xD1: case 0xD2: case 0xD3:
+            case 0xD4: case 0xD5: case 0xD6: case 0xD7: case 0xD8: case 0xD9: case 0xDA: case 0xDB:
+            case 0xDC: case 0xDD: case 0xDE: case 0xDF: case 0xE0: case 0xE1: case 0xE2: case 0xE3:
+            case 0xE4: case 0xE5: case 0xE6: case 0xE7: case 0xE8: case 0xE9: case 0xEA: case 0xEB:
+            case 0xEC: case 0xED: case 0xEE: case 0xEF: case 0xF0: case 0xF1: case 0xF2: case 0xF3:
+            case 0xF4: case 0xF5: case 0xF6: case 0xF7: case 0xF8: case 0xF9: case 0xFA: case 0xFB:
+            case 0xFC: case 0xFD: case 0xFE: case 0xFF:
+                goto State289;
+            case 0x5C:
+                goto State291;
+            default:
+                if (ch >= 0x0100 && ch <= 0x10FFFF)
+                    goto State289;
+                goto Done;
+        }
+
+    Done:
+        if (lastLexemeID == 0u) {
+            if (charReader.IsEOF() && startHead == GetTailPos())
+                code = SGParser::TokenCode::TokenEOF;
+            else {
+                SetTailPos(startHead);
+                TailPos = HeadPos;
+                code    = SGParser::TokenCode::TokenError;
+                // Skip the character in error from the rewound tail
+                if (!charReader.IsEOF())
+                    InputCharReader{ByteReader{*this}, TailPos}.Advance();
+            }
+            token.CopyFromTokenizer(code, *this);
+            return token;
+        }
+
+        SetTailPos(lastTail);
+        TailPos = lastTailPos;
+
+        switch (lastLexemeID) {
+            case 2u:
+                code = 0u;
+                break;
+            case 3u:
+                code = 0u;
+                ExpressionStack.push_back(ExpressionStackTop);
+                ExpressionStackTop = 1u;
+                break;
+            case 4u:
+                code = 2u;
+                break;
+            case 5u:
+                code = 3u;
+                break;
+            case 6u:
+                code = 4u;
+                break;
+            case 7u:
+                code = 5u;
+                break;
+            case 8u:
+                code = 6u;
+                break;
+            case 9u:
+                code = 7u;
+                break;
+            case 10u:
+                code = 8u;
+                break;
+            case 11u:
+                code = 9u;
+                break;
+            case 12u:
+                code = 10u;
+                break;
+            case 13u:
+                code = 11u;
+                break;
+            case 14u:
+                code = 12u;
+                break;
+            case 15u:
+                code = 13u;
+                break;
+            case 16u:
+                code = 14u;
+                break;
+            case 17u:
+                code = 15u;
+                break;
+            case 18u:
+                code = 16u;
+                break;
+            case 19u:
+                code = 17u;
+                break;
+            case 20u:
+                code = 18u;
+                break;
+            case 21u:
+                code = 19u;
+                break;
+            case 22u:
+                code = 20u;
+                break;
+            case 23u:
+                code = 21u;
+                break;
+            case 24u:
+                code = 22u;
+                break;
+            case 25u:
+                code = 23u;
+                break;
+            case 26u:
+                code = 24u;
+                break;
+            case 27u:
+                code = 25u;
+                break;
+            case 28u:
+                code = 26u;
+                break;
+            case 29u:
+                code = 27u;
+                break;
+            case 30u:
+                code = 28u;
+                break;
+            case 31u:
+                code = 29u;
+                break;
+            case 32u:
+                code = 30u;
+                break;
+            case 33u:
+                code = 31u;
+                break;
+            case 34u:
+                code = 32u;
+                break;
+            case 35u:
+                code = 33u;
+                break;
+            case 36u:
+                code = 34u;
+                break;
+            case 37u:
+                code = 35u;
+                break;
+            case 38u:
+                code = 36u;
+                break;
+            case 39u:
+                code = 37u;
+                break;
+            case 40u:
+                code = 38u;
+                break;
+            case 41u:
+                code = 39u;
+                break;
+            case 42u:
+                code = 40u;
+                break;
+            case 43u:
+                code = 41u;
+                break;
+            case 44u:
+                code = 42u;
+                break;
+            case 45u:
+                code = 43u;
+                break;
+            case 46u:
+                code = 44u;
+                break;
+            case 47u:
+                code = 45u;
+                break;
+            case 48u:
+                code = 46u;
+                break;
+            case 49u:
+                code = 47u;
+                break;
+            case 50u:
+                code = 48u;
+                break;
+            case 51u:
+                code = 49u;
+                break;
+            case 52u:
+                code = 50u;
+                break;
+            case 53u:
+                code = 51u;
+                break;
+            case 54u:
+                code = 0u;
+                if (ExpressionStack.empty()) {
+                    ExpressionStackTop = 0u;
+                    token.CopyFromTokenizer(SGParser::TokenCode::TokenError, *this);
+                    return token;
+                }
+                ExpressionStackTop = ExpressionStack.back();
+                ExpressionStack.pop_back();
+                break;
+            default:
+                code = 0u;
+                break;
+        }
+
+        // if code == 0, then ignore token
+    } while (code == 0u);
+
+    token.CopyFromTokenizer(code, *this);
+    return token;
+}
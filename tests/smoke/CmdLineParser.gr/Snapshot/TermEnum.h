@@ -29,27 +29,32 @@ enum TermEnum
     /*21*/ TE_opReduceFunc,
     /*22*/ TE_opStaticDFA,
     /*23*/ TE_opStaticParseTable,
-    /*24*/ TE_opCanonical,
-    /*25*/ TE_opConflictReport,
-    /*26*/ TE_opNoWarnings,
-    /*27*/ TE_opNotes,
-    /*28*/ TE_opStats,
-    /*29*/ TE_opHelp,
-    /*30*/ TE_opQuietMode,
-    /*31*/ TE_opVersion,
-    /*32*/ TE_opCLGrammar,
-    /*33*/ TE_fileNameParam,
-    /*34*/ TE_namespaceNameParam,
-    /*35*/ TE_classNameParam,
-    /*36*/ TE_stackNameParam,
-    /*37*/ TE_prefixParam,
-    /*38*/ TE_stringParam,
-    /*39*/ TE_optionParam,
-    /*40*/ TE_messageParam,
-    /*41*/ TE_dfaParam,
-    /*42*/ TE_linesParam,
-    /*43*/ TE_labelsParam,
-    /*44*/ TE_pointsParam,
-    /*45*/ TE_displayParam,
-    /*46*/ TE_string
+    /*24*/ TE_opScanner,
+    /*25*/ TE_opScan,
+    /*26*/ TE_opCanonical,
+    /*27*/ TE_opConflictReport,
+    /*28*/ TE_opNoWarnings,
+    /*29*/ TE_opNotes,
+    /*30*/ TE_opStats,
+    /*31*/ TE_opHelp,
+    /*32*/ TE_opQuietMode,
+    /*33*/ TE_opVersion,
+    /*34*/ TE_opCLGrammar,
+    /*35*/ TE_fileNameParam,
+    /*36*/ TE_namespaceNameParam,
+    /*37*/ TE_classNameParam,
+    /*38*/ TE_stackNameParam,
+    /*39*/ TE_prefixParam,
+    /*40*/ TE_strideParam,
+    /*41*/ TE_compressParam,
+    /*42*/ TE_defaultReduceParam,
+    /*43*/ TE_stringParam,
+    /*44*/ TE_optionParam,
+    /*45*/ TE_messageParam,
+    /*46*/ TE_dfaParam,
+    /*47*/ TE_linesParam,
+    /*48*/ TE_labelsParam,
+    /*49*/ TE_pointsParam,
+    /*50*/ TE_displayParam,
+    /*51*/ TE_string
 };
@@ -32,29 +32,34 @@ enum class TermEnum
     /*21*/ opReduceFunc,
     /*22*/ opStaticDFA,
     /*23*/ opStaticParseTable,
-    /*24*/ opCanonical,
-    /*25*/ opConflictReport,
-    /*26*/ opNoWarnings,
-    /*27*/ opNotes,
-    /*28*/ opStats,
-    /*29*/ opHelp,
-    /*30*/ opQuietMode,
-    /*31*/ opVersion,
-    /*32*/ opCLGrammar,
-    /*33*/ fileNameParam,
-    /*34*/ namespaceNameParam,
-    /*35*/ classNameParam,
-    /*36*/ stackNameParam,
-    /*37*/ prefixParam,
-    /*38*/ stringParam,
-    /*39*/ optionParam,
-    /*40*/ messageParam,
-    /*41*/ dfaParam,
-    /*42*/ linesParam,
-    /*43*/ labelsParam,
-    /*44*/ pointsParam,
-    /*45*/ displayParam,
-    /*46*/ string
+    /*24*/ opScanner,
+    /*25*/ opScan,
+    /*26*/ opCanonical,
+    /*27*/ opConflictReport,
+    /*28*/ opNoWarnings,
+    /*29*/ opNotes,
+    /*30*/ opStats,
+    /*31*/ opHelp,
+    /*32*/ opQuietMode,
+    /*33*/ opVersion,
+    /*34*/ opCLGrammar,
+    /*35*/ fileNameParam,
+    /*36*/ namespaceNameParam,
+    /*37*/ classNameParam,
+    /*38*/ stackNameParam,
+    /*39*/ prefixParam,
+    /*40*/ strideParam,
+    /*41*/ compressParam,
+    /*42*/ defaultReduceParam,
+    /*43*/ stringParam,
+    /*44*/ optionParam,
+    /*45*/ messageParam,
+    /*46*/ dfaParam,
+    /*47*/ linesParam,
+    /*48*/ labelsParam,
+    /*49*/ pointsParam,
+    /*50*/ displayParam,
+    /*51*/ string
 };
 
 constexpr char const* const StringifyEnumTermEnum[] =
@@ -83,29 +88,34 @@ constexpr char const* const StringifyEnumTermEnum[] =
     /*21*/ "opReduceFunc",
     /*22*/ "opStaticDFA",
     /*23*/ "opStaticParseTable",
-    /*24*/ "opCanonical",
-    /*25*/ "opConflictReport",
-    /*26*/ "opNoWarnings",
-    /*27*/ "opNotes",
-    /*28*/ "opStats",
-    /*29*/ "opHelp",
-    /*30*/ "opQuietMode",
-    /*31*/ "opVersion",
-    /*32*/ "opCLGrammar",
-    /*33*/ "fileNameParam",
-    /*34*/ "namespaceNameParam",
-    /*35*/ "classNameParam",
-    /*36*/ "stackNameParam",
-    /*37*/ "prefixParam",
-    /*38*/ "stringParam",
-    /*39*/ "optionParam",
-    /*40*/ "messageParam",
-    /*41*/ "dfaParam",
-    /*42*/ "linesParam",
-    /*43*/ "labelsParam",
-    /*44*/ "pointsParam",
-    /*45*/ "displayParam",
-    /*46*/ "string"
+    /*24*/ "opScanner",
+    /*25*/ "opScan",
+    /*26*/ "opCanonical",
+    /*27*/ "opConflictReport",
+    /*28*/ "opNoWarnings",
+    /*29*/ "opNotes",
+    /*30*/ "opStats",
+    /*31*/ "opHelp",
+    /*32*/ "opQuietMode",
+    /*33*/ "opVersion",
+    /*34*/ "opCLGrammar",
+    /*35*/ "fileNameParam",
+    /*36*/ "namespaceNameParam",
+    /*37*/ "classNameParam",
+    /*38*/ "stackNameParam",
+    /*39*/ "prefixParam",
+    /*40*/ "strideParam",
+    /*41*/ "compressParam",
+    /*42*/ "defaultReduceParam",
+    /*43*/ "stringParam",
+    /*44*/ "optionParam",
+    /*45*/ "messageParam",
+    /*46*/ "dfaParam",
+    /*47*/ "linesParam",
+    /*48*/ "labelsParam",
+    /*49*/ "pointsParam",
+    /*50*/ "displayParam",
+    /*51*/ "string"
 };
 
 } // namespace XC
@@ -99,6 +99,7 @@ process {
       -prodenum +f:$OutputDir/"ProdEnum.h" `
       -pt +f:$OutputDir/"StaticParseTable.h" `
       -rf +f:$OutputDir/"ReduceFunction.h" `
+      -scanner +f:$OutputDir/"Scanner.h" `
       -termenum +f:$OutputDir/"TermEnum.h" `
       | Out-String
 
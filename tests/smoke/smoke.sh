@@ -78,6 +78,7 @@ do
     -prodenum +f:"${output_dir}/ProdEnum.h" \
     -pt +f:"${output_dir}/StaticParseTable.h" \
     -rf +f:"${output_dir}/ReduceFunction.h" \
+    -scanner +f:"${output_dir}/Scanner.h" \
     -termenum +f:"${output_dir}/TermEnum.h")
 
   # Exit if no output.
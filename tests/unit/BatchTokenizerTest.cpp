@@ -0,0 +1,55 @@
+// Filename:  BatchTokenizerTest.cpp
+// Content:   BatchTokenizer compared with DFATokenizer on every record
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+#include "BatchTokenizer.h"
+
+// Tokenizes the records with the given number of lanes and checks the tokens of each
+template <size_t LaneCount>
+void TestLanes(const SGParser::DFA& dfa, const std::vector<std::string>& records) {
+    using namespace SGParser;
+    using namespace Test;
+
+    std::vector<typename BatchTokenizer<LaneCount>::Record> views{records.begin(), records.end()};
+    std::vector<std::vector<ViewToken>>                     tokens;
+    BatchTokenizer<LaneCount>{&dfa}.Tokenize(views.data(), views.size(), tokens);
+
+    if (!SG_TEST_CHECK(tokens.size() == records.size()))
+        return;
+    for (size_t i = 0u; i < records.size(); ++i) {
+        const auto expected = TokenizeAll<ViewToken>(dfa, records[i].data(), records[i].size());
+        if (!SG_TEST_CHECK(tokens[i].size() == expected.size() &&
+                           FindMismatch(tokens[i], expected) == expected.size())) {
+            std::fprintf(stderr, "%zu lanes, record %zu: \"%s\"\n",
+                         LaneCount, i, records[i].c_str());
+            break;
+        }
+    }
+}
+
+int main() {
+    using namespace SGParser;
+    using namespace Test;
+
+    Generator::DFAGen dfa;
+    if (!MakeTestDFA(dfa))
+        return TestResult();
+
+    // Records of very different lengths, so that the lanes finish at different times
+    // Some of them end within a comment or a string
+    std::mt19937             random{3u};
+    std::vector<std::string> records;
+    for (unsigned i = 0u; i < 1000u; ++i)
+        records.push_back(i % 10u == 0u ? std::string{} : GenerateTestInput(random() % 300u, i));
+
+    TestLanes<1u>(dfa, records);
+    TestLanes<3u>(dfa, records);
+    TestLanes<8u>(dfa, records);
+
+    // Fewer records than lanes
+    records.resize(5u);
+    TestLanes<8u>(dfa, records);
+
+    return TestResult();
+}
@@ -0,0 +1,122 @@
+// Filename:  DefaultReduceTest.cpp
+// Content:   Parsing with default reductions compared with parsing without them
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+
+#include <algorithm>
+
+namespace
+{
+
+using namespace SGParser;
+using namespace SGParser::Test;
+
+// Returns whether the reductions are of the same productions on the same tokens
+// The lookahead read may differ
+bool SameProductions(const std::vector<TestReduction>& a, const std::vector<TestReduction>& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                      [](const TestReduction& x, const TestReduction& y) {
+                          return x.Production == y.Production && x.FirstToken == y.FirstToken;
+                      });
+}
+
+// Returns the number of reductions of the production
+size_t CountReductions(const std::vector<TestReduction>& reductions, unsigned production) {
+    return size_t(std::count_if(reductions.begin(), reductions.end(),
+                                [&](const TestReduction& reduction) {
+                                    return reduction.Production == production;
+                                }));
+}
+
+} // anonymous namespace
+
+int main() {
+    Generator::StdGrammarParseData parseData;
+    Generator::DFAGen              dfa;
+    if (!SG_TEST_CHECK(LoadTestGrammar(parseData)) || !SG_TEST_CHECK(parseData.MakeDFA(dfa)))
+        return TestResult();
+
+    const auto numberId    = FindTestProduction(parseData, "Number");
+    const auto badTargetId = FindTestProduction(parseData, "BadTarget");
+    const auto catchId     = FindTestProduction(parseData, "BadTargetClause");
+    if (!SG_TEST_CHECK(numberId != unsigned(-1) && badTargetId != unsigned(-1) &&
+                       catchId != unsigned(-1)))
+        return TestResult();
+
+    const auto statements = GenerateTestStatements(20000u);
+    const auto malformed  = GenerateTestInput(20000u);
+
+    for (const auto tableType : {ParseTableType::LALR, ParseTableType::CLR})
+        for (const auto compress : {false, true}) {
+            Generator::ParseTableGen plain;
+            Generator::ParseTableGen reducing;
+            if (!SG_TEST_CHECK(parseData.MakeParseTable(plain, tableType)) ||
+                !SG_TEST_CHECK(parseData.MakeParseTable(reducing, tableType)) ||
+                !SG_TEST_CHECK(reducing.SetDefaultReductions() != 0u))
+                break;
+            if (compress) {
+                plain.Compress();
+                reducing.Compress();
+            }
+
+            std::vector<TestReduction> plainReductions;
+            std::vector<TestReduction> reducingReductions;
+            GenericToken               plainLastToken;
+            GenericToken               reducingLastToken;
+
+            // The same productions are reduced on the same tokens; some of them before
+            // the lookahead is read, and none after it
+            SG_TEST_CHECK(ParseTestInput(dfa, plain, statements, plainReductions,
+                                         plainLastToken));
+            SG_TEST_CHECK(ParseTestInput(dfa, reducing, statements, reducingReductions,
+                                         reducingLastToken));
+            SG_TEST_CHECK(!plainReductions.empty() &&
+                          SameProductions(reducingReductions, plainReductions));
+            size_t earlyCount = 0u;
+            for (size_t i = 0u; i < plainReductions.size() && i < reducingReductions.size(); ++i) {
+                SG_TEST_CHECK(reducingReductions[i].LastToken <= plainReductions[i].LastToken);
+                earlyCount += reducingReductions[i].LastToken < plainReductions[i].LastToken
+                                  ? 1u : 0u;
+            }
+            SG_TEST_CHECK(earlyCount != 0u);
+
+            // A number in parentheses is reduced with the number as the last token read,
+            // instead of the closing parenthesis after it
+            const TestReduction::Position numberPos{0u, 1u};
+            const TestReduction::Position closePos{0u, 3u};
+            SG_TEST_CHECK(ParseTestInput(dfa, plain, "(12)\n", plainReductions, plainLastToken));
+            SG_TEST_CHECK(ParseTestInput(dfa, reducing, "(12)\n", reducingReductions,
+                                         reducingLastToken));
+            SG_TEST_CHECK(!plainReductions.empty() && plainReductions[0u].Production == numberId &&
+                          plainReductions[0u].LastToken == closePos);
+            SG_TEST_CHECK(!reducingReductions.empty() &&
+                          reducingReductions[0u].Production == numberId &&
+                          reducingReductions[0u].LastToken == numberPos);
+
+            // Named errors are thrown and caught the same way
+            const std::string badTarget = "1 := 2\nx := 3\n4 := 5 + 6\n7\n";
+            SG_TEST_CHECK(ParseTestInput(dfa, plain, badTarget, plainReductions, plainLastToken));
+            SG_TEST_CHECK(ParseTestInput(dfa, reducing, badTarget, reducingReductions,
+                                         reducingLastToken));
+            SG_TEST_CHECK(CountReductions(plainReductions, badTargetId) == 2u &&
+                          CountReductions(plainReductions, catchId) == 2u);
+            SG_TEST_CHECK(SameProductions(reducingReductions, plainReductions));
+
+            // Syntax errors stop the parse on the same token, with the same reductions
+            // (the default reductions may only add more of them before the error)
+            SG_TEST_CHECK(!ParseTestInput(dfa, plain, malformed, plainReductions,
+                                          plainLastToken));
+            SG_TEST_CHECK(!ParseTestInput(dfa, reducing, malformed, reducingReductions,
+                                          reducingLastToken));
+            SG_TEST_CHECK(reducingLastToken.Line == plainLastToken.Line &&
+                          reducingLastToken.Offset == plainLastToken.Offset);
+            SG_TEST_CHECK(reducingReductions.size() >= plainReductions.size() &&
+                          SameProductions({reducingReductions.begin(),
+                                           reducingReductions.begin() +
+                                               ptrdiff_t(plainReductions.size())},
+                                          plainReductions));
+        }
+
+    return TestResult();
+}
@@ -0,0 +1,74 @@
+// Filename:  IncrementalTokenizerTest.cpp
+// Content:   IncrementalTokenizer re-tokenizing random edits
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+#include "IncrementalTokenizer.h"
+
+#include <algorithm>
+#include <iterator>
+
+int main() {
+    using namespace SGParser;
+    using namespace Test;
+
+    Generator::DFAGen dfa;
+    if (!MakeTestDFA(dfa))
+        return TestResult();
+
+    // Edits open and close comments and strings, so that the expression state changes
+    static const char* const snippets[] = {"", " ", "\n", "\r\n", "/*", "*/", "\"", "12.5",
+                                           "x", "+ y", "#", "/* a */", "\"s\""};
+
+    std::mt19937 random{7u};
+    auto         document = GenerateTestInput(30000u);
+
+    IncrementalTokenizer<ViewToken> tokenizer{&dfa};
+    tokenizer.Tokenize(document.data(), document.size());
+    SG_TEST_CHECK(FindMismatch(tokenizer.GetTokens(),
+                               TokenizeAll<ViewToken>(dfa, document.data(), document.size())) ==
+                  tokenizer.GetTokens().size());
+
+    for (unsigned edit = 0u; edit < 500u; ++edit) {
+        // Edits are mostly short, some remove a larger part of the document
+        const auto editBegin = size_t(random() % (document.size() + 1u));
+        const auto maxRemove = edit % 50u == 0u ? 2000u : 4u;
+        const auto editEnd   = std::min(document.size(), editBegin + random() % (maxRemove + 1u));
+        const std::string insert = snippets[random() % std::size(snippets)];
+
+        auto oldTokens = tokenizer.GetTokens();
+        document.replace(editBegin, editEnd - editBegin, insert);
+        const auto diff = tokenizer.Retokenize(document.data(), document.size(),
+                                               editBegin, editEnd, insert.size());
+
+        // The tokens are the same as when tokenizing the whole document
+        const auto  expected = TokenizeAll<ViewToken>(dfa, document.data(), document.size());
+        const auto& tokens   = tokenizer.GetTokens();
+        if (!SG_TEST_CHECK(tokens.size() == expected.size() &&
+                           FindMismatch(tokens, expected) == tokens.size())) {
+            std::fprintf(stderr, "edit %u at [%zu, %zu): first mismatch at %zu\n",
+                         edit, editBegin, editEnd, FindMismatch(tokens, expected));
+            break;
+        }
+
+        // Applying the diff to the old tokens gives the new ones
+        if (!SG_TEST_CHECK(diff.First + diff.RemovedCount <= oldTokens.size()))
+            break;
+        const auto delta = ptrdiff_t(insert.size()) - ptrdiff_t(editEnd - editBegin);
+        for (auto it = oldTokens.begin() + ptrdiff_t(diff.First + diff.RemovedCount);
+             it != oldTokens.end(); ++it)
+            it->Offset = size_t(ptrdiff_t(it->Offset) + delta);
+        const auto pfirst = oldTokens.begin() + ptrdiff_t(diff.First);
+        oldTokens.erase(pfirst, pfirst + ptrdiff_t(diff.RemovedCount));
+        oldTokens.insert(oldTokens.begin() + ptrdiff_t(diff.First),
+                         diff.Inserted.begin(), diff.Inserted.end());
+        if (!SG_TEST_CHECK(oldTokens.size() == expected.size() &&
+                           FindMismatch(oldTokens, expected) == oldTokens.size())) {
+            std::fprintf(stderr, "edit %u at [%zu, %zu): diff mismatch\n",
+                         edit, editBegin, editEnd);
+            break;
+        }
+    }
+
+    return TestResult();
+}
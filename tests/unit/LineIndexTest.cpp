@@ -0,0 +1,68 @@
+// Filename:  LineIndexTest.cpp
+// Content:   LineIndex positions compared with the tracked ones
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+#include "LineIndex.h"
+
+#include <algorithm>
+
+int main() {
+    using namespace SGParser;
+    using namespace Test;
+
+    Generator::DFAGen dfa;
+    if (!MakeTestDFA(dfa))
+        return TestResult();
+
+    // The input has tabs and both "\n" and "\r\n" line ends, spanning many index blocks
+    const auto input = GenerateTestInput(LineIndex::BlockSize * 20u + 123u);
+
+    // Token positions tracked by the tokenizer
+    const auto tracked = TokenizeAll<GenericToken>(dfa, input.data(), input.size());
+    const auto views   = TokenizeAll<ViewToken>(dfa, input.data(), input.size());
+    if (!SG_TEST_CHECK(tracked.size() == views.size()))
+        return TestResult();
+
+    // Query from the end first, and then in order, once the index is complete
+    LineIndex index{input.data(), input.size()};
+    for (size_t i = views.size(); i-- > 0u;) {
+        const auto pos = index.GetPos(views[i].Offset);
+        if (!SG_TEST_CHECK(pos.Line == tracked[i].Line && pos.Offset == tracked[i].Offset)) {
+            std::fprintf(stderr, "token %zu at %zu\n", i, views[i].Offset);
+            break;
+        }
+    }
+
+    // Every byte position, on a new index queried in order
+    index.SetData(input.data(), input.size());
+    LineOffsetPosTracker expected;
+    for (size_t offset = 0u; offset <= input.size(); ++offset) {
+        const auto pos = index.GetPos(offset);
+        if (!SG_TEST_CHECK(pos.Line == expected.Line && pos.Offset == expected.Offset)) {
+            std::fprintf(stderr, "byte %zu\n", offset);
+            break;
+        }
+        if (offset < input.size())
+            expected.AdvanceChar(uint8_t(input[offset]));
+    }
+
+    SG_TEST_CHECK(index.GetLine(input.size()) == expected.Line);
+    SG_TEST_CHECK(LineIndex::CountNewlines(input.data(), input.data() + input.size()) ==
+                  size_t(std::count(input.begin(), input.end(), '\n')));
+
+    // UTF-8 characters are counted once
+    const std::string utf8 = "\xD0\xBF\xD1\x80\xD0\xB8\tx\r\n\xE2\x82\xAC y\n\xF0\x9F\x98\x80z";
+    index.SetData(utf8.data(), utf8.size());
+    LineOffsetPosTracker utf8Expected;
+    for (size_t offset = 0u; offset <= utf8.size(); ++offset) {
+        if (offset == utf8.size() || (uint8_t(utf8[offset]) & 0xC0u) != 0x80u) {
+            const auto pos = index.GetUTF8Pos(offset);
+            SG_TEST_CHECK(pos.Line == utf8Expected.Line && pos.Offset == utf8Expected.Offset);
+        }
+        if (offset < utf8.size())
+            utf8Expected.AdvanceUTF8Range(utf8.data() + offset, utf8.data() + offset + 1u);
+    }
+
+    return TestResult();
+}
@@ -0,0 +1,44 @@
+// Filename:  ParallelTokenizerTest.cpp
+// Content:   ParallelTokenizer compared with sequential tokenizing
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+#include "ParallelTokenizer.h"
+
+int main() {
+    using namespace SGParser;
+    using namespace Test;
+
+    Generator::DFAGen dfa;
+    if (!MakeTestDFA(dfa))
+        return TestResult();
+
+    // Large enough to be split into several chunks
+    for (unsigned seed = 1u; seed <= 3u; ++seed) {
+        const auto input    = GenerateTestInput(ParallelTokenizer<ViewToken>::MinChunkSize * 5u +
+                                                seed * 997u, seed);
+        const auto expected = TokenizeAll<ViewToken>(dfa, input.data(), input.size());
+
+        for (const unsigned threadCount : {2u, 4u}) {
+            ParallelTokenizer<ViewToken> tokenizer{&dfa};
+            std::vector<ViewToken>       tokens;
+            tokenizer.Tokenize(input.data(), input.size(), tokens, threadCount);
+
+            const auto mismatch = FindMismatch(tokens, expected);
+            if (!SG_TEST_CHECK(tokens.size() == expected.size() && mismatch == tokens.size()))
+                std::fprintf(stderr, "seed %u, %u threads: %zu tokens, %zu expected, "
+                                     "first mismatch at %zu\n",
+                             seed, threadCount, tokens.size(), expected.size(), mismatch);
+        }
+    }
+
+    // Small input is tokenized sequentially
+    const auto input = GenerateTestInput(1000u);
+    ParallelTokenizer<ViewToken> tokenizer{&dfa};
+    std::vector<ViewToken>       tokens;
+    tokenizer.Tokenize(input.data(), input.size(), tokens, 4u);
+    const auto expected = TokenizeAll<ViewToken>(dfa, input.data(), input.size());
+    SG_TEST_CHECK(tokens.size() == expected.size() && FindMismatch(tokens, expected) == tokens.size());
+
+    return TestResult();
+}
@@ -0,0 +1,105 @@
+// Filename:  ParseStackTest.cpp
+// Content:   Deeply nested input parsed with the growing parse stack and its size limit
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+#include "Parser.h"
+
+namespace
+{
+
+using namespace SGParser;
+
+using TestParse = Parse<ParseStackGenericElement>;
+using TestStack = ParseStack<ParseStackGenericElement>;
+
+// Accepts every reduction, recording the deepest stack reached
+class DepthHandler final : public ParseHandler<ParseStackGenericElement>
+{
+public:
+    size_t MaxStackPosition = 0u;
+
+    bool Reduce(TestParse& parse, unsigned) override {
+        MaxStackPosition = std::max(MaxStackPosition, parse.GetStackPosition());
+        return true;
+    }
+};
+
+// Returns an expression line nested depth parentheses deep
+std::string MakeNestedInput(size_t depth) {
+    return std::string(depth, '(') + "1" + std::string(depth, ')') + "\n";
+}
+
+// Parses the input with the parser, returning the DoParse result
+bool ParseInput(const DFA& dfa, TestParse& parse, const std::string& input, bool& overflow,
+                size_t& depth) {
+    MemBufferInputStream       stream{input.data(), input.size()};
+    DFATokenizer<GenericToken> tokenizer{&dfa, &stream};
+    DepthHandler               handler;
+    parse.SetTokenStream(&tokenizer);
+
+    const auto result = parse.DoParse(handler);
+    overflow          = parse.IsStackOverflow();
+    depth             = handler.MaxStackPosition;
+    // The stack is cleaned up after a failed parse
+    SG_TEST_CHECK(result || parse.GetStackPosition() == 0u);
+    parse.SetTokenStream(nullptr);
+    return result;
+}
+
+} // anonymous namespace
+
+int main() {
+    using namespace Test;
+
+    Generator::StdGrammarParseData parseData;
+    Generator::DFAGen              dfa;
+    Generator::ParseTableGen       table;
+    if (!SG_TEST_CHECK(LoadTestGrammar(parseData)) || !SG_TEST_CHECK(parseData.MakeDFA(dfa)) ||
+        !SG_TEST_CHECK(parseData.MakeParseTable(table, ParseTableType::LALR)))
+        return TestResult();
+
+    bool   overflow = false;
+    size_t depth    = 0u;
+
+    // Nesting much deeper than the first stack segment
+    TestParse deepParse{&table, size_t(1u) << 20u};
+    SG_TEST_CHECK(ParseInput(dfa, deepParse, MakeNestedInput(100000u), overflow, depth));
+    SG_TEST_CHECK(!overflow && depth >= 100000u);
+
+    // Nesting around the segment boundaries, where the stack grows
+    for (const auto segments : {1u, 2u, 3u})
+        for (auto nesting = segments * TestStack::SegmentSize - 3u;
+             nesting <= segments * TestStack::SegmentSize + 3u; ++nesting) {
+            if (!SG_TEST_CHECK(ParseInput(dfa, deepParse, MakeNestedInput(nesting), overflow,
+                                          depth)))
+                std::fprintf(stderr, "nesting %zu\n", nesting);
+            SG_TEST_CHECK(!overflow && depth >= nesting);
+        }
+
+    // Nesting up to the limit parses, and any deeper nesting fails as a stack overflow
+    // The same parser is used for all, so it's usable again after an overflow
+    constexpr size_t maxStackSize = 300u;
+    TestParse        limitedParse{&table, maxStackSize};
+    size_t           maxNesting   = 0u;
+    for (size_t nesting = 1u; nesting <= maxStackSize; ++nesting) {
+        const auto parsed = ParseInput(dfa, limitedParse, MakeNestedInput(nesting), overflow,
+                                       depth);
+        SG_TEST_CHECK(parsed != overflow);
+        SG_TEST_CHECK(depth < maxStackSize);
+        if (parsed && !SG_TEST_CHECK(maxNesting == nesting - 1u))
+            std::fprintf(stderr, "nesting %zu parsed after a stack overflow\n", nesting);
+        maxNesting = parsed ? nesting : maxNesting;
+    }
+    SG_TEST_CHECK(maxNesting > maxStackSize / 2u && maxNesting < maxStackSize);
+    SG_TEST_CHECK(!ParseInput(dfa, limitedParse, MakeNestedInput(400u), overflow, depth));
+    SG_TEST_CHECK(overflow);
+    SG_TEST_CHECK(ParseInput(dfa, limitedParse, MakeNestedInput(maxNesting), overflow, depth));
+    SG_TEST_CHECK(!overflow);
+
+    // Syntax errors aren't reported as a stack overflow
+    SG_TEST_CHECK(!ParseInput(dfa, limitedParse, "(1\n", overflow, depth));
+    SG_TEST_CHECK(!overflow);
+
+    return TestResult();
+}
@@ -0,0 +1,85 @@
+// Filename:  ParseTableTest.cpp
+// Content:   Compressed parse tables compared with the dense ones, and table lookups
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+
+int main() {
+    using namespace SGParser;
+    using namespace Test;
+
+    Generator::StdGrammarParseData parseData;
+    Generator::DFAGen              dfa;
+    if (!SG_TEST_CHECK(LoadTestGrammar(parseData)) || !SG_TEST_CHECK(parseData.MakeDFA(dfa)))
+        return TestResult();
+
+    const auto statements = GenerateTestStatements(20000u);
+    const auto malformed  = GenerateTestInput(20000u);
+
+    for (const auto tableType : {ParseTableType::LALR, ParseTableType::CLR}) {
+        Generator::ParseTableGen dense;
+        Generator::ParseTableGen packed;
+        if (!SG_TEST_CHECK(parseData.MakeParseTable(dense, tableType)) ||
+            !SG_TEST_CHECK(parseData.MakeParseTable(packed, tableType)))
+            break;
+        packed.Compress();
+        if (!SG_TEST_CHECK(!dense.IsCompressed() && packed.IsCompressed()) ||
+            !SG_TEST_CHECK(packed.GetStateCount() == dense.GetStateCount() &&
+                           packed.GetTerminalCount() == dense.GetTerminalCount() &&
+                           packed.GetNonTerminalCount() == dense.GetNonTerminalCount()))
+            break;
+
+        // Every entry is the same, including the empty ones
+        size_t emptyGotoCount = 0u;
+        for (unsigned state = 0u; state < dense.GetStateCount(); ++state) {
+            for (unsigned terminal = 0u; terminal < dense.GetTerminalCount(); ++terminal)
+                if (!SG_TEST_CHECK(packed.GetAction(state, terminal) ==
+                                   dense.GetAction(state, terminal)))
+                    std::fprintf(stderr, "action of state %u on terminal %u\n", state, terminal);
+
+            for (unsigned left = 0u; left < dense.GetNonTerminalCount(); ++left) {
+                const auto expected = dense.GetLeftReduceState(state, left);
+                if (expected == ParseTable::InvalidState)
+                    ++emptyGotoCount;
+                if (!SG_TEST_CHECK(packed.GetLeftReduceState(state, left) == expected))
+                    std::fprintf(stderr, "goto of state %u on nonterminal %u\n", state, left);
+            }
+        }
+        SG_TEST_CHECK(emptyGotoCount != 0u);
+        SG_TEST_CHECK(packed.GetTableSize() < dense.GetTableSize());
+
+        // Parsing with either table reduces the same productions, up to the same error
+        std::vector<TestReduction> denseReductions;
+        std::vector<TestReduction> packedReductions;
+        GenericToken               denseLastToken;
+        GenericToken               packedLastToken;
+        SG_TEST_CHECK(ParseTestInput(dfa, dense, statements, denseReductions, denseLastToken));
+        SG_TEST_CHECK(ParseTestInput(dfa, packed, statements, packedReductions, packedLastToken));
+        SG_TEST_CHECK(denseLastToken.Code == TokenCode::TokenEOF);
+        SG_TEST_CHECK(!denseReductions.empty() && packedReductions == denseReductions);
+
+        SG_TEST_CHECK(!ParseTestInput(dfa, dense, malformed, denseReductions, denseLastToken));
+        SG_TEST_CHECK(!ParseTestInput(dfa, packed, malformed, packedReductions, packedLastToken));
+        SG_TEST_CHECK(packedReductions == denseReductions &&
+                      packedLastToken.Line == denseLastToken.Line &&
+                      packedLastToken.Offset == denseLastToken.Offset);
+    }
+
+    // Production error terminals are found by both the production and the nonterminal,
+    // also when the production ids don't fit 16 bits
+    const ParseTable::ProductionErrorTerminal errorTerminals[] = {
+        {ParseTable::GetProductionErrorKey(0x10001u, 0u), 7u},
+        {ParseTable::GetProductionErrorKey(1u, 1u), 8u},
+        {ParseTable::GetProductionErrorKey(0x20000u, 0x10000u), 9u}};
+    StaticParseTable staticTable{};
+    staticTable.ProductionErrorTerminalCount = std::size(errorTerminals);
+    staticTable.pProductionErrorTerminals    = errorTerminals;
+    ParseTable errorTable{staticTable};
+    SG_TEST_CHECK(errorTable.GetProductionErrorTerminal(0x10001u, 0u) == 7u);
+    SG_TEST_CHECK(errorTable.GetProductionErrorTerminal(1u, 1u) == 8u);
+    SG_TEST_CHECK(errorTable.GetProductionErrorTerminal(0x20000u, 0x10000u) == 9u);
+    SG_TEST_CHECK(errorTable.GetProductionErrorTerminal(0x10001u, 1u) == ParseTable::InvalidState);
+    SG_TEST_CHECK(errorTable.GetProductionErrorTerminal(1u, 0u) == ParseTable::InvalidState);
+
+    return TestResult();
+}
@@ -0,0 +1,152 @@
+// Filename:  PrefetchInputStreamTest.cpp
+// Content:   PrefetchInputStream read through buffers and through Read()
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+#include "PrefetchInputStream.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+// Source returning the data in reads of random sizes, which may throw after some data
+class ChunkedInputStream final : public SGParser::InputStream
+{
+public:
+    static constexpr size_t NoFailure = size_t(-1);
+
+    ChunkedInputStream(const std::string& data, size_t failOffset = NoFailure)
+        : Data{data}, FailOffset{failOffset} {}
+
+    SGParser::StreamSize Read(uint8_t* pbuffer, SGParser::StreamSize numBytes) override {
+        if (Pos >= FailOffset)
+            throw std::runtime_error{"read failed"};
+        const auto size = std::min({size_t(numBytes), size_t(Random() % 3000u) + 1u,
+                                    Data.size() - Pos, FailOffset - Pos});
+        std::copy_n(Data.data() + Pos, size, pbuffer);
+        Pos += size;
+        return SGParser::StreamSize(size);
+    }
+
+    bool Close() override { return true; }
+
+private:
+    const std::string& Data;
+    size_t             FailOffset;
+    size_t             Pos = 0u;
+    std::mt19937       Random{5u};
+};
+
+// Reads the stream with Read() in pieces of random sizes
+std::string ReadAll(SGParser::InputStream& stream) {
+    std::mt19937 random{9u};
+    std::string  data;
+    for (;;) {
+        uint8_t    buffer[5000];
+        const auto size = stream.Read(buffer, SGParser::StreamSize(random() % sizeof(buffer)) + 1);
+        if (size <= 0)
+            break;
+        data.append(reinterpret_cast<const char*>(buffer), size_t(size));
+    }
+    return data;
+}
+
+// Returns true if the function throws the source exception
+template <class Function>
+bool ThrowsReadFailure(Function&& function) {
+    try {
+        function();
+    } catch (const std::runtime_error& error) {
+        return std::string{error.what()} == "read failed";
+    }
+    return false;
+}
+
+int main() {
+    using namespace SGParser;
+    using namespace Test;
+
+    Generator::DFAGen dfa;
+    if (!MakeTestDFA(dfa))
+        return TestResult();
+
+    const auto input    = GenerateTestInput(200000u);
+    const auto expected = TokenizeAll<GenericToken>(dfa, input.data(), input.size());
+
+    // Tokenizer taking the buffers, small ones so that many tokens span two buffers
+    for (const size_t depth : {1u, 2u, 4u}) {
+        ChunkedInputStream         source{input};
+        PrefetchInputStream        stream{&source, depth};
+        TokenizerBufferPool        pool{1000u};
+        DFATokenizer<GenericToken> tokenizer;
+        tokenizer.SetBufferPool(&pool);
+        tokenizer.Create(&dfa, &stream);
+
+        std::vector<GenericToken> tokens;
+        do
+            tokenizer.GetNextToken(tokens.emplace_back());
+        while (tokens.back().Code != TokenCode::TokenEOF);
+        SG_TEST_CHECK(tokens.size() == expected.size() &&
+                      FindMismatch(tokens, expected) == tokens.size());
+    }
+
+    // Buffers taken directly, up to EOF
+    {
+        ChunkedInputStream  source{input};
+        PrefetchInputStream stream{&source};
+        TokenizerBufferPool pool{4096u};
+        std::string         data;
+        while (const auto pbuffer = stream.TakeBuffer(pool)) {
+            data.append(pbuffer->Buffer, pbuffer->pBufferTail);
+            pool.Release(pbuffer);
+        }
+        SG_TEST_CHECK(data == input);
+        SG_TEST_CHECK(stream.TakeBuffer(pool) == nullptr);
+    }
+
+    // Data copied out with Read()
+    {
+        ChunkedInputStream  source{input};
+        PrefetchInputStream stream{&source, 3u};
+        SG_TEST_CHECK(ReadAll(stream) == input);
+    }
+
+    // Exceptions thrown by the source are rethrown to the reader, after the data read before
+    {
+        ChunkedInputStream  source{input, 50000u};
+        PrefetchInputStream stream{&source};
+        TokenizerBufferPool pool{4096u};
+        std::string         data;
+        SG_TEST_CHECK(ThrowsReadFailure([&]() {
+            while (const auto pbuffer = stream.TakeBuffer(pool)) {
+                data.append(pbuffer->Buffer, pbuffer->pBufferTail);
+                pool.Release(pbuffer);
+            }
+        }));
+        SG_TEST_CHECK(data == input.substr(0u, 50000u));
+    }
+    {
+        ChunkedInputStream  source{input, 50000u};
+        PrefetchInputStream stream{&source};
+        SG_TEST_CHECK(ThrowsReadFailure([&]() { ReadAll(stream); }));
+    }
+    {
+        ChunkedInputStream         source{input, 50000u};
+        PrefetchInputStream        stream{&source};
+        DFATokenizer<GenericToken> tokenizer{&dfa, &stream};
+        GenericToken               token;
+        SG_TEST_CHECK(ThrowsReadFailure([&]() {
+            while (tokenizer.GetNextToken(token).Code != TokenCode::TokenEOF) {}
+        }));
+    }
+
+    // Closed before all the data is read
+    {
+        ChunkedInputStream  source{input};
+        PrefetchInputStream stream{&source};
+        uint8_t             buffer[100];
+        SG_TEST_CHECK(stream.Read(buffer, sizeof(buffer)) == sizeof(buffer));
+        SG_TEST_CHECK(stream.Close());
+    }
+
+    return TestResult();
+}
@@ -0,0 +1,79 @@
+// Filename:  PushTokenizerTest.cpp
+// Content:   PushTokenizer fed in chunks compared with DFATokenizer
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#include "TestGrammar.h"
+#include "PushTokenizer.h"
+
+#include <algorithm>
+
+// Feeds the input in random-sized chunks, including empty ones, polling the tokens
+// after each chunk
+template <class Token>
+std::vector<Token> PushAll(const SGParser::DFA& dfa, const std::string& input, unsigned seed,
+                           size_t maxChunkSize) {
+    SGParser::PushTokenizer<Token> tokenizer{&dfa};
+    std::vector<Token>             tokens;
+    std::mt19937                   random{seed};
+    Token                          token;
+
+    for (size_t pos = 0u; pos < input.size();) {
+        const auto size = std::min<size_t>(random() % (maxChunkSize + 1u), input.size() - pos);
+        tokenizer.Feed(input.data() + pos, size);
+        pos += size;
+        while (tokenizer.PollToken(token))
+            tokens.push_back(token);
+    }
+
+    tokenizer.Finish();
+    do {
+        if (!SG_TEST_CHECK(tokenizer.PollToken(token)))
+            break;
+        tokens.push_back(token);
+    } while (token.Code != SGParser::TokenCode::TokenEOF);
+    return tokens;
+}
+
+template <class Token>
+void TestChunks(const SGParser::DFA& dfa, const std::string& input, size_t maxChunkSize) {
+    using namespace SGParser::Test;
+
+    const auto expected = TokenizeAll<Token>(dfa, input.data(), input.size());
+    for (unsigned seed = 1u; seed <= 5u; ++seed) {
+        const auto tokens   = PushAll<Token>(dfa, input, seed, maxChunkSize);
+        const auto mismatch = FindMismatch(tokens, expected);
+        if (!SG_TEST_CHECK(tokens.size() == expected.size() && mismatch == tokens.size()))
+            std::fprintf(stderr, "seed %u, chunks up to %zu: %zu tokens, %zu expected, "
+                                 "first mismatch at %zu\n",
+                         seed, maxChunkSize, tokens.size(), expected.size(), mismatch);
+    }
+}
+
+int main() {
+    using namespace SGParser;
+    using namespace Test;
+
+    Generator::DFAGen dfa;
+    if (!MakeTestDFA(dfa))
+        return TestResult();
+
+    const auto input = GenerateTestInput(20000u);
+    for (const size_t maxChunkSize : {1u, 3u, 16u, 1000u}) {
+        TestChunks<GenericToken>(dfa, input, maxChunkSize);
+        TestChunks<ViewToken>(dfa, input, maxChunkSize);
+    }
+
+    // Empty input
+    TestChunks<GenericToken>(dfa, std::string{}, 4u);
+
+    // GetNextToken finishes the input when more is needed
+    PushTokenizer<GenericToken> tokenizer{&dfa};
+    GenericToken                token;
+    tokenizer.Feed("12 ab", 5u);
+    SG_TEST_CHECK(tokenizer.PollToken(token) && token.Str == "12");
+    SG_TEST_CHECK(!tokenizer.PollToken(token));
+    SG_TEST_CHECK(tokenizer.GetNextToken(token).Str == "ab" && tokenizer.IsFinished());
+    SG_TEST_CHECK(tokenizer.GetNextToken(token).Code == TokenCode::TokenEOF);
+
+    return TestResult();
+}
@@ -0,0 +1,327 @@
+// Filename:  TestGrammar.h
+// Content:   Grammar, input generator and checks shared by the unit tests
+// Provided AS IS under MIT License; see LICENSE file in root folder.
+
+#ifndef INC_SGPARSER_TESTS_TESTGRAMMAR_H
+#define INC_SGPARSER_TESTS_TESTGRAMMAR_H
+
+#include "DFAGen.h"
+#include "DFATokenizer.h"
+#include "ParseData.h"
+#include "ParseTableGen.h"
+#include "Parser.h"
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SGParser
+{
+namespace Test
+{
+
+// Calculator grammar with nested comments and string literals, so that tokenizing
+// depends on the expression stack and not only on the input position
+// Assigning to a number throws a named error, which is caught by the clause
+inline String const testGrammar = R"~grammar(
+%expression Main
+
+'[0-9]*\.?[0-9]+'               Number,         'number';
+'[a-zA-Z_]+[a-zA-Z0-9_]*'       Identifier,     'identifier';
+
+'\+'                            Plus,           '+';
+'\-'                            Minus,          '-';
+'\*'                            Multiply,       '*';
+'\/'                            Divide,         '/';
+'\^'                            Power,          '^';
+'\:='                           Assign,         ':=';
+'\('                            OpenParen,      '(';
+'\)'                            CloseParen,     ')';
+
+'[ \t]+'                        %ignore;
+'\r?\n'                         EndOfLine,      'eol';
+
+'/\*'                           CommentStart,   'comment_start', %push Comment;
+'\"'                            StringStart,    'string_start', %push String;
+
+%expression Comment
+
+'/\*'                           CommentStart,   'comment_start', %push Comment;
+'\*/'                           CommentEnd,     'comment_end', %pop;
+'[^\*/]+|\*|/'                  CommentText,    'comment_text';
+
+%expression String
+
+'[^\"\n]+'                      StringText,     'string_text';
+'\"'                            StringEnd,      'string_end', %pop;
+
+%prec
+
+%right  ':=' ;
+%left   '+', '-' ;
+%left   '*', '/' ;
+%right  '^' ;
+
+%production unit
+
+Unit            unit        -> unit clause ;
+Oneliner        unit        -> clause ;
+
+ExpressionClause clause     -> expression 'eol' ;
+AssignmentClause clause     -> assignment 'eol' ;
+CommentClause   clause      -> comment ;
+EmptyClause     clause      -> 'eol' ;
+BadTargetClause clause      -> %error(BadTarget) 'eol' ;
+
+Comment         comment     -> 'comment_start' commentBody 'comment_end' ;
+CommentText     commentBody -> commentBody 'comment_text' ;
+CommentNested   commentBody -> commentBody comment ;
+CommentEmpty    commentBody -> ;
+
+Number          expression  -> 'number' ;
+Identifier      expression  -> 'identifier' ;
+String          expression  -> 'string_start' string 'string_end' ;
+Negation        expression  -> '-' expression ;
+Expression      expression  -> '(' expression ')' ;
+Addition        expression  -> expression '+' expression ;
+Substruction    expression  -> expression '-' expression ;
+Multiplication  expression  -> expression '*' expression ;
+Division        expression  -> expression '/' expression ;
+Exponentiation  expression  -> expression '^' expression ;
+
+StringText      string      -> string 'string_text' ;
+StringEmpty     string      -> ;
+
+Assignment      assignment  -> 'identifier' ':=' expression ;
+Replication     assignment  -> 'identifier' ':=' assignment ;
+BadTarget       assignment %error(BadTarget) -> 'number' ':=' expression ;
+)~grammar";
+
+
+// Reports a failed check and counts it
+#define SG_TEST_CHECK(condition)                                                        \
+    ((condition) ? true                                                                 \
+                 : (std::fprintf(stderr, "%s(%d): check failed: %s\n", __FILE__, __LINE__, \
+                                 #condition),                                           \
+                    ++SGParser::Test::FailureCount, false))
+
+inline unsigned FailureCount = 0u;
+
+// Returns the exit code of a test, printing the failures count
+inline int TestResult() {
+    if (FailureCount != 0u)
+        std::fprintf(stderr, "%u check(s) failed\n", FailureCount);
+    return FailureCount == 0u ? 0 : 1;
+}
+
+
+// Loads the test grammar, printing the messages on failure
+// The message buffers are detached again before returning, so that the tables made
+// from the parse data later don't report to the local buffer
+inline bool LoadTestGrammar(Generator::StdGrammarParseData& parseData) {
+    std::vector<Generator::ParseMessage> messages;
+    const auto setMessageBuffer = [&](std::vector<Generator::ParseMessage>* pmessages) {
+        parseData.GetMessageBuffer().SetMessageBuffer(pmessages);
+        parseData.GetLex().GetMessageBuffer().SetMessageBuffer(pmessages);
+        parseData.GetGrammar().GetMessageBuffer().SetMessageBuffer(pmessages);
+    };
+
+    setMessageBuffer(&messages);
+    MemBufferInputStream grammarStream{testGrammar};
+    const auto           loaded = parseData.LoadGrammar(&grammarStream);
+    setMessageBuffer(nullptr);
+
+    if (!loaded)
+        for (const auto& message : messages)
+            std::fprintf(stderr, "%s\n", message.Message.data());
+    return loaded;
+}
+
+// Creates the DFA of the test grammar
+inline bool MakeTestDFA(Generator::DFAGen& dfa) {
+    Generator::StdGrammarParseData parseData;
+    return SG_TEST_CHECK(LoadTestGrammar(parseData)) && SG_TEST_CHECK(parseData.MakeDFA(dfa));
+}
+
+
+// Returns the id of the test grammar production with the name, or -1 if there is none
+inline unsigned FindTestProduction(Generator::StdGrammarParseData& parseData,
+                                   const char* pname) {
+    std::vector<Generator::Production*> productions;
+    parseData.GetGrammar().CreateProductionVector(productions);
+    for (const auto pproduction : productions)
+        if (pproduction && pproduction->Name == pname)
+            return pproduction->Id;
+    return unsigned(-1);
+}
+
+
+// Generates random lines of the test grammar, about size bytes long
+// A few characters no lexeme matches are mixed in, so error tokens are tested as well
+inline std::string GenerateTestInput(size_t size, unsigned seed = 1u) {
+    static const char* const operators[] = {" + ", "-", " * ", "/", "^", " := ", "(", ")"};
+    static const char* const words[]     = {"x", "alpha", "_tmp1", "Value", "b2"};
+
+    std::mt19937 random{seed};
+    const auto   pick = [&](unsigned count) { return unsigned(random() % count); };
+
+    std::string input;
+    unsigned    commentDepth = 0u;
+    while (input.size() < size) {
+        if (commentDepth != 0u) {
+            switch (pick(8u)) {
+                case 0u: input += "/*"; ++commentDepth; break;
+                case 1u: case 2u: input += "*/"; --commentDepth; break;
+                case 3u: input += "\n * "; break;
+                default: input += words[pick(5u)]; input += pick(2u) ? " " : " / "; break;
+            }
+            continue;
+        }
+        switch (pick(16u)) {
+            case 0u: input += "/* "; ++commentDepth; break;
+            case 1u: input += "\"some text * / \""; break;
+            case 2u: input += pick(2u) ? "\n" : "\r\n"; break;
+            case 3u: input += "\t"; break;
+            case 4u: input += pick(8u) ? " " : "#"; break;
+            case 5u: case 6u: case 7u:
+                input += std::to_string(random() % 1000u);
+                if (pick(4u) == 0u)
+                    input += "." + std::to_string(pick(100u));
+                break;
+            case 8u: case 9u: input += words[pick(5u)]; break;
+            default: input += operators[pick(8u)]; break;
+        }
+    }
+    return input;
+}
+
+// Appends a random expression of the test grammar, nested up to depth levels
+inline void AddTestExpression(std::string& input, std::mt19937& random, unsigned depth) {
+    static const char* const operators[] = {" + ", " - ", " * ", " / ", " ^ "};
+    static const char* const words[]     = {"x", "alpha", "_tmp1", "Value", "b2"};
+
+    switch (random() % (depth == 0u ? 3u : 6u)) {
+        case 0u: input += std::to_string(random() % 1000u); break;
+        case 1u: input += words[random() % 5u]; break;
+        case 2u: input += "\"some text\""; break;
+        case 3u: input += "-"; AddTestExpression(input, random, depth - 1u); break;
+        case 4u:
+            input += "(";
+            AddTestExpression(input, random, depth - 1u);
+            input += ")";
+            break;
+        default:
+            AddTestExpression(input, random, depth - 1u);
+            input += operators[random() % 5u];
+            AddTestExpression(input, random, depth - 1u);
+            break;
+    }
+}
+
+// Generates random lines of the test grammar without syntax errors, about size bytes long
+inline std::string GenerateTestStatements(size_t size, unsigned seed = 1u) {
+    std::mt19937 random{seed};
+    std::string  input;
+    while (input.size() < size) {
+        switch (random() % 8u) {
+            case 0u: input += "/* note /* nested */ */"; break;
+            case 1u: input += "\n"; break;
+            case 2u: case 3u:
+                input += "x := ";
+                AddTestExpression(input, random, unsigned(random() % 5u));
+                input += "\n";
+                break;
+            default:
+                AddTestExpression(input, random, unsigned(random() % 5u));
+                input += random() % 4u ? "\n" : "\r\n";
+                break;
+        }
+    }
+    return input;
+}
+
+
+// Reduction reported by Parse, with the (line, offset) positions of the first token of
+// the production and of the last token read by the parser (the lookahead, unless it
+// wasn't read yet)
+struct TestReduction final
+{
+    using Position = std::pair<size_t, size_t>;
+
+    unsigned Production;
+    Position FirstToken;
+    Position LastToken;
+
+    bool operator==(const TestReduction& other) const noexcept {
+        return Production == other.Production && FirstToken == other.FirstToken &&
+               LastToken == other.LastToken;
+    }
+};
+
+// Parses the input with the table, recording every reduction
+// Returns the DoParse result, and the last token read in lastToken
+inline bool ParseTestInput(const DFA& dfa, const ParseTable& table, const std::string& input,
+                           std::vector<TestReduction>& reductions, GenericToken& lastToken) {
+    class Handler final : public ParseHandler<ParseStackGenericElement>
+    {
+    public:
+        std::vector<TestReduction>& Reductions;
+
+        explicit Handler(std::vector<TestReduction>& reductions) : Reductions{reductions} {}
+
+        bool Reduce(Parse<ParseStackGenericElement>& parse, unsigned productionID) override {
+            const auto& lastToken = parse.GetLastToken();
+            Reductions.push_back({productionID, {parse[0].Line, parse[0].Offset},
+                                  {lastToken.Line, lastToken.Offset}});
+            return true;
+        }
+    };
+
+    reductions.clear();
+    Handler                         handler{reductions};
+    MemBufferInputStream            stream{input.data(), input.size()};
+    DFATokenizer<GenericToken>      tokenizer{&dfa, &stream};
+    Parse<ParseStackGenericElement> parse;
+    if (!SG_TEST_CHECK(parse.Create(&table, &tokenizer)))
+        return false;
+    const auto result = parse.DoParse(handler);
+    lastToken         = parse.GetLastToken();
+    return result;
+}
+
+// Tokenizes the whole input with DFATokenizer, including the EOF token
+template <class Token>
+std::vector<Token> TokenizeAll(const DFA& dfa, const char* pdata, size_t size) {
+    MemBufferInputStream stream{pdata, size};
+    DFATokenizer<Token>  tokenizer{&dfa, &stream};
+    std::vector<Token>   tokens;
+    do
+        tokenizer.GetNextToken(tokens.emplace_back());
+    while (tokens.back().Code != TokenCode::TokenEOF);
+    return tokens;
+}
+
+// Token comparison
+inline bool operator==(const ViewToken& a, const ViewToken& b) noexcept {
+    return a.Code == b.Code && a.Offset == b.Offset && a.Length == b.Length;
+}
+
+inline bool operator==(const GenericToken& a, const GenericToken& b) noexcept {
+    return a.Code == b.Code && a.Str == b.Str && a.Line == b.Line && a.Offset == b.Offset;
+}
+
+// Returns the index of the first different token, or the size of the shorter vector
+template <class Token>
+size_t FindMismatch(const std::vector<Token>& a, const std::vector<Token>& b) {
+    size_t index = 0u;
+    while (index < a.size() && index < b.size() && a[index] == b[index])
+        ++index;
+    return index;
+}
+
+} // namespace Test
+} // namespace SGParser
+
+#endif // INC_SGPARSER_TESTS_TESTGRAMMAR_H